@@ -1,40 +1,397 @@
 #include "src/auth/AuthRpcClient.hpp"
 
 #include <glog/logging.h>
-#include <functional>
+#include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <random>
+#include <thread>
 
+#include "RetryBudget.hpp"
 #include "rpc/RpcMetadata.hpp"
+#include "src/time/LatencyHistogram.hpp"
 
 namespace client_app::auth {
+    /// @brief Async call waiting in the completion queue
+    struct PendingCall {
+        virtual ~PendingCall() = default;
+
+        /// @brief Deliver the finished call to its callback
+        virtual auto complete() noexcept -> void = 0;
+    };
+
+    /// @brief Turn a failed status into a failed response and log the outcome
+    /// @tparam ResponseType Type of the response message
+    /// @param[in] operation_name Name of the operation for logging
+    /// @param[in] status Status the call finished with
+    /// @param[in,out] response Response to mark as failed
+    template<typename ResponseType>
+    static auto applyStatus(const std::string_view operation_name, const grpc::Status &status, ResponseType &response) noexcept -> void {
+        if (!status.ok()) {
+            LOG(WARNING) << "RPC " << operation_name << " failed: " << status.error_message();
+            response.set_success(false);
+            response.set_message("RPC failed: " + status.error_message());
+            response.set_error_code(status.error_code());
+        } else {
+            VLOG(1) << "RPC " << operation_name << " succeeded";
+        }
+    }
+
+    /// @brief State of one async unary call, owned by the completion queue until it finishes
+    /// @tparam ResponseType Type of the response message
+    /// @tparam OnComplete Callable taking the status and response
+    template<typename ResponseType, typename OnComplete>
+    struct AsyncCall final : PendingCall {
+        AsyncCall(std::shared_ptr<grpc::ClientContext> call_context, OnComplete callback) noexcept : context(std::move(call_context)), on_complete(std::move(callback)) {
+        }
+
+        auto complete() noexcept -> void override {
+            on_complete(status, response);
+        }
+
+        std::shared_ptr<grpc::ClientContext> context; ///< Shared with whoever may cancel the call
+        ResponseType response;
+        grpc::Status status;
+        OnComplete on_complete;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<ResponseType> > reader;
+    };
+
+    /// @brief Attempts of one hedged call racing for the first usable response
+    /// @tparam ResponseType Type of the response message
+    template<typename ResponseType>
+    struct HedgeState {
+        std::mutex mutex;
+        std::condition_variable finished;
+        size_t pending{0}; ///< Attempts sent and not yet completed
+        std::optional<std::pair<grpc::Status, ResponseType> > result; ///< First success, or the last failure
+        std::array<std::shared_ptr<grpc::ClientContext>, 2> contexts;
+    };
+
+    /// @brief Latencies of a hedgeable method, used to time its hedged attempts
+    struct MethodLatency {
+        common::time::LatencyHistogram histogram;
+        std::atomic<uint64_t> samples{0};
+        std::atomic<int64_t> hedge_delay_us{0}; ///< 0 until enough samples were seen
+    };
+
+    struct AuthRpcClient::CallPolicy {
+        /// @brief Successful attempts a method needs before it is hedged
+        static constexpr uint64_t HEDGE_MIN_SAMPLES = 100;
+
+        /// @brief Successful attempts between two updates of the hedge delay
+        static constexpr uint64_t HEDGE_REFRESH_INTERVAL = 256;
+
+        /// @brief Retries a quiet client can save up
+        static constexpr uint32_t RETRY_BUDGET_MAX_TOKENS = 10;
+
+        explicit CallPolicy(const app_client::auth::AuthRpcClientOptions &options) : default_deadline(std::max(options.deadlineMs(), 0)), max_attempts(static_cast<uint32_t>(std::max(options.retryMaxAttempts(), 1))), initial_backoff(std::max(options.retryInitialBackoffMs(), 0)), max_backoff(std::max(options.retryMaxBackoffMs(), options.retryInitialBackoffMs())), retry_budget(options.retryBudgetRatio(), RETRY_BUDGET_MAX_TOKENS), hedging_enabled(options.hedgingEnabled()), hedging_percentile(options.hedgingPercentile()) {
+            for (const auto &[method_name, deadline_ms]: options.methodDeadlinesMs()) {
+                method_deadlines.emplace(method_name, std::chrono::milliseconds{std::max(deadline_ms, 0)});
+            }
+            latencies.emplace("UserExists", std::make_unique<MethodLatency>());
+        }
+
+        /// @brief Record the latency of a successful attempt and refresh the hedge delay now and then
+        /// @param latency Latency tracker of the method
+        /// @param elapsed Time the attempt took
+        auto recordLatency(MethodLatency &latency, const std::chrono::steady_clock::duration elapsed) const noexcept -> void {
+            latency.histogram.record(elapsed);
+            if (const auto samples = latency.samples.fetch_add(1, std::memory_order_relaxed) + 1; samples >= HEDGE_MIN_SAMPLES && samples % HEDGE_REFRESH_INTERVAL == HEDGE_MIN_SAMPLES % HEDGE_REFRESH_INTERVAL) {
+                latency.hedge_delay_us.store(latency.histogram.snapshot().valueAtPercentile(hedging_percentile).count(), std::memory_order_relaxed);
+            }
+        }
+
+        std::chrono::milliseconds default_deadline;
+        std::map<std::string, std::chrono::milliseconds, std::less<> > method_deadlines;
+        uint32_t max_attempts;
+        std::chrono::milliseconds initial_backoff;
+        std::chrono::milliseconds max_backoff;
+        mutable RetryBudget retry_budget;
+        bool hedging_enabled;
+        double hedging_percentile;
+        std::map<std::string, std::unique_ptr<MethodLatency>, std::less<> > latencies;
+    };
+
+    /// @brief Pick a random backoff below a cap ("full jitter")
+    /// @param cap Largest backoff
+    /// @return Backoff between 0 and cap
+    static auto jitteredBackoff(const std::chrono::milliseconds cap) -> std::chrono::microseconds {
+        thread_local std::mt19937_64 rng{std::random_device{}()};
+        const auto cap_us = std::chrono::duration_cast<std::chrono::microseconds>(cap).count();
+        return std::chrono::microseconds{std::uniform_int_distribution<int64_t>{0, std::max<int64_t>(cap_us, 0)}(rng)};
+    }
+
+    class AuthRpcClient::CompletionPoller {
+    public:
+        CompletionPoller() : thread_([this] { poll(); }) {
+        }
+
+        CompletionPoller(const CompletionPoller &) = delete;
+
+        auto operator=(const CompletionPoller &) -> CompletionPoller & = delete;
+
+        /// @brief Shut the queue down once the calls in flight have completed
+        ~CompletionPoller() {
+            queue_.Shutdown();
+            thread_.join();
+        }
+
+        [[nodiscard]] auto queue() noexcept -> grpc::CompletionQueue * {
+            return &queue_;
+        }
+
+    private:
+        auto poll() noexcept -> void {
+            void *tag = nullptr;
+            bool ok = false;
+            while (queue_.Next(&tag, &ok)) {
+                // Finish always completes with its status set, so ok carries no extra information
+                const std::unique_ptr<PendingCall> call{static_cast<PendingCall *>(tag)};
+                call->complete();
+            }
+        }
+
+        grpc::CompletionQueue queue_;
+        std::thread thread_;
+    };
+
+    /// @brief Build a BatchUserExists request
+    /// @param[in] usernames The usernames to check
+    /// @return Request listing the usernames in order
+    static auto makeBatchUserExistsRequest(const std::vector<std::string> &usernames) -> rpc::BatchUserExistsRequest {
+        rpc::BatchUserExistsRequest request{};
+        request.mutable_usernames()->Reserve(static_cast<int>(usernames.size()));
+        for (const auto &username: usernames) {
+            request.add_usernames(username);
+        }
+        return request;
+    }
+
+    /// @brief Build a BatchRegisterUsers request
+    /// @param[in] users The username and password pairs to register
+    /// @return Request listing the users in order
+    static auto makeBatchRegisterUsersRequest(const std::vector<std::pair<std::string, std::string> > &users) -> rpc::BatchRegisterUsersRequest {
+        rpc::BatchRegisterUsersRequest request{};
+        request.mutable_users()->Reserve(static_cast<int>(users.size()));
+        for (const auto &[username, password]: users) {
+            auto *const user = request.add_users();
+            user->set_username(username);
+            user->set_password(password);
+        }
+        return request;
+    }
+
     /// @brief Construct a new AuthRpcClient object
     /// @param channel The gRPC channel to use for communication
-    AuthRpcClient::AuthRpcClient(const std::shared_ptr<grpc::Channel> &channel) noexcept : stub_(rpc::AuthService::NewStub(channel)), channel_(channel) {
-        LOG_IF(FATAL, !channel) << "RPC channel cannot be null";
+    AuthRpcClient::AuthRpcClient(const std::shared_ptr<grpc::Channel> &channel) noexcept : AuthRpcClient(std::vector{channel}) {
+    }
+
+    /// @brief Construct a new AuthRpcClient object that spreads calls over several channels
+    /// @param channels The gRPC channels to use for communication, at least one
+    AuthRpcClient::AuthRpcClient(std::vector<std::shared_ptr<grpc::Channel> > channels) noexcept : AuthRpcClient(std::move(channels), app_client::auth::AuthRpcClientOptions::builder().build()) {
+    }
+
+    /// @brief Construct a new AuthRpcClient object with deadlines, retries and hedging from options
+    /// @param channels The gRPC channels to use for communication, at least one
+    /// @param options Client options providing the deadline, retry and hedging settings
+    AuthRpcClient::AuthRpcClient(std::vector<std::shared_ptr<grpc::Channel> > channels, const app_client::auth::AuthRpcClientOptions &options) noexcept : channels_(std::move(channels)), next_stub_(std::make_unique<std::atomic<size_t> >(0)), policy_(std::make_unique<CallPolicy>(options)), poller_(std::make_unique<CompletionPoller>()) {
+        LOG_IF(FATAL, channels_.empty() || std::ranges::any_of(channels_, [](const auto &channel) { return !channel; })) << "RPC channel cannot be null";
+        stubs_.reserve(channels_.size());
+        for (const auto &channel: channels_) {
+            stubs_.push_back(rpc::AuthService::NewStub(channel));
+        }
     }
 
+    AuthRpcClient::AuthRpcClient(AuthRpcClient &&) noexcept = default;
+
+    auto AuthRpcClient::operator=(AuthRpcClient &&) noexcept -> AuthRpcClient & = default;
+
+    AuthRpcClient::~AuthRpcClient() noexcept = default;
+
     /// @brief Execute RPC call with error handling and logging
     /// @tparam RequestType Type of the request message
     /// @tparam ResponseType Type of the response message
+    /// @tparam RpcCall Callable performing the blocking call on a stub
     /// @param[in] operation_name Name of the operation for logging
     /// @param[in] request The request message to send
-    /// @param[in] rpc_call Function that performs the actual RPC call
-    /// @return rpc::AuthResponse containing operation result
-    template<typename RequestType, typename ResponseType>
-    [[nodiscard]] auto AuthRpcClient::ExecuteRpcCall(const std::string &operation_name, const RequestType &request, const std::function<grpc::Status(grpc::ClientContext *, const RequestType &, ResponseType *)> &rpc_call) const noexcept -> ResponseType {
+    /// @param[in] rpc_call Callable that performs the actual RPC call
+    /// @return ResponseType containing operation result
+    template<typename RequestType, typename ResponseType, typename RpcCall>
+    [[nodiscard]] auto AuthRpcClient::ExecuteRpcCall(const std::string_view operation_name, const RequestType &request, RpcCall &&rpc_call) const noexcept -> ResponseType {
         ResponseType response{};
         grpc::ClientContext context{};
-
-        if (const grpc::Status status = rpc_call(&context, request, &response); !status.ok()) {
-            LOG_IF(WARNING, !status.ok()) << "RPC " << operation_name << " failed: " << status.error_message();
-            response.set_success(false);
-            response.set_message("RPC failed: " + status.error_message());
-            response.set_error_code(status.error_code());
-        } else {
-            LOG_IF(INFO, status.ok()) << "RPC " << operation_name << " succeeded";
+        if (const auto deadline = deadlineFor(operation_name)) {
+            context.set_deadline(*deadline);
         }
+
+        const grpc::Status status = rpc_call(nextStub(), &context, request, &response);
+        applyStatus(operation_name, status, response);
         return response;
     }
 
+    /// @brief Start an RPC call on the async stub
+    /// @tparam RequestType Type of the request message
+    /// @tparam ResponseType Type of the response message
+    /// @tparam PrepareCall Callable preparing the async call on a stub
+    /// @param[in] operation_name Name of the operation for logging
+    /// @param[in] request The request message to send, serialized before this returns
+    /// @param[in] prepare_call Callable that prepares the call on the client's completion queue
+    /// @return Future of the response, completed by the poller thread
+    template<typename RequestType, typename ResponseType, typename PrepareCall>
+    [[nodiscard]] auto AuthRpcClient::StartAsyncCall(const std::string_view operation_name, const RequestType &request, PrepareCall &&prepare_call) const noexcept -> std::future<ResponseType> {
+        std::promise<ResponseType> promise;
+        auto future = promise.get_future();
+
+        auto context = std::make_shared<grpc::ClientContext>();
+        if (const auto deadline = deadlineFor(operation_name)) {
+            context->set_deadline(*deadline);
+        }
+        LaunchAsyncCall<RequestType, ResponseType>(nextStub(), std::move(context), request, prepare_call, [operation_name, promise = std::move(promise)](const grpc::Status &status, ResponseType &response) mutable {
+            applyStatus(operation_name, status, response);
+            promise.set_value(std::move(response));
+        });
+        return future;
+    }
+
+    /// @brief Send an RPC call on the async stub and hand its outcome to a callback
+    /// @tparam RequestType Type of the request message
+    /// @tparam ResponseType Type of the response message
+    /// @tparam PrepareCall Callable preparing the async call on a stub
+    /// @tparam OnComplete Callable taking the status and response, run on the poller thread
+    /// @param[in] stub Stub to send the call on
+    /// @param[in] context Context of the call, kept alive until the call completes
+    /// @param[in] request The request message to send, serialized before this returns
+    /// @param[in] prepare_call Callable that prepares the call on the client's completion queue
+    /// @param[in] on_complete Callable receiving the outcome
+    template<typename RequestType, typename ResponseType, typename PrepareCall, typename OnComplete>
+    auto AuthRpcClient::LaunchAsyncCall(rpc::AuthService::Stub &stub, std::shared_ptr<grpc::ClientContext> context, const RequestType &request, const PrepareCall &prepare_call, OnComplete &&on_complete) const -> void {
+        auto call = std::make_unique<AsyncCall<ResponseType, std::decay_t<OnComplete> > >(std::move(context), std::forward<OnComplete>(on_complete));
+        call->reader = prepare_call(stub, call->context.get(), request, poller_->queue());
+        call->reader->StartCall();
+        call->reader->Finish(&call->response, &call->status, call.get());
+
+        // The completion queue hands the call back to the poller, which deletes it
+        static_cast<void>(call.release());
+    }
+
+    /// @brief Execute an idempotent RPC call with retries and hedging
+    /// @tparam RequestType Type of the request message
+    /// @tparam ResponseType Type of the response message
+    /// @tparam PrepareCall Callable preparing the async call on a stub
+    /// @param[in] operation_name Name of the operation for logging, deadlines and latency tracking
+    /// @param[in] hedgeable Whether slow attempts may be hedged, only for methods without side effects
+    /// @param[in] request The request message to send
+    /// @param[in] prepare_call Callable that prepares the call on the client's completion queue
+    /// @return ResponseType of the first successful attempt, or of the last one if all failed
+    template<typename RequestType, typename ResponseType, typename PrepareCall>
+    [[nodiscard]] auto AuthRpcClient::ExecuteIdempotentRpcCall(const std::string_view operation_name, const bool hedgeable, const RequestType &request, PrepareCall &&prepare_call) const noexcept -> ResponseType {
+        const auto deadline = deadlineFor(operation_name);
+        MethodLatency *latency = policy_->hedging_enabled && hedgeable ? policy_->latencies.find(operation_name)->second.get() : nullptr;
+        policy_->retry_budget.deposit();
+
+        std::pair<grpc::Status, ResponseType> outcome;
+        try {
+            for (uint32_t attempt = 1;; ++attempt) {
+                const auto hedge_delay = latency ? std::chrono::microseconds{latency->hedge_delay_us.load(std::memory_order_relaxed)} : std::chrono::microseconds{0};
+                const auto started = std::chrono::steady_clock::now();
+                outcome = HedgedAttempt<RequestType, ResponseType>(request, prepare_call, deadline, hedge_delay);
+                if (latency && outcome.first.ok()) {
+                    policy_->recordLatency(*latency, std::chrono::steady_clock::now() - started);
+                }
+
+                // Only calls the server never processed are safe to send again
+                if (outcome.first.error_code() != grpc::StatusCode::UNAVAILABLE || attempt >= policy_->max_attempts) {
+                    break;
+                }
+                const auto backoff = jitteredBackoff(std::min(policy_->max_backoff, policy_->initial_backoff * (1 << std::min<uint32_t>(attempt - 1, 16))));
+                if ((deadline && std::chrono::system_clock::now() + backoff >= *deadline) || !policy_->retry_budget.tryWithdraw()) {
+                    break;
+                }
+                VLOG(1) << "RPC " << operation_name << " unavailable, retrying in " << backoff.count() << "us";
+                std::this_thread::sleep_for(backoff);
+            }
+        } catch (const std::exception &e) {
+            outcome.first = grpc::Status{grpc::StatusCode::INTERNAL, e.what()};
+        }
+
+        applyStatus(operation_name, outcome.first, outcome.second);
+        return std::move(outcome.second);
+    }
+
+    /// @brief Send one attempt of an idempotent call, hedged if it is slow and the retry budget allows
+    /// @tparam RequestType Type of the request message
+    /// @tparam ResponseType Type of the response message
+    /// @tparam PrepareCall Callable preparing the async call on a stub
+    /// @param[in] request The request message to send
+    /// @param[in] prepare_call Callable that prepares the call on the client's completion queue
+    /// @param[in] deadline Deadline of the call, nullopt for none
+    /// @param[in] hedge_delay Time after which a second attempt is sent, 0 to never hedge
+    /// @return Status and response of the first attempt that succeeded, or of the last one to fail
+    template<typename RequestType, typename ResponseType, typename PrepareCall>
+    auto AuthRpcClient::HedgedAttempt(const RequestType &request, const PrepareCall &prepare_call, const std::optional<std::chrono::system_clock::time_point> deadline, const std::chrono::microseconds hedge_delay) const -> std::pair<grpc::Status, ResponseType> {
+        const auto state = std::make_shared<HedgeState<ResponseType> >();
+        const auto launch = [&](const size_t index) {
+            auto &context = state->contexts[index];
+            context = std::make_shared<grpc::ClientContext>();
+            if (deadline) {
+                context->set_deadline(*deadline);
+            }
+            LaunchAsyncCall<RequestType, ResponseType>(nextStub(), context, request, prepare_call, [state](const grpc::Status &status, ResponseType &response) {
+                {
+                    const std::lock_guard lock{state->mutex};
+                    --state->pending;
+                    if (state->result || (!status.ok() && state->pending > 0)) {
+                        return;
+                    }
+                    state->result.emplace(status, std::move(response));
+                }
+                state->finished.notify_one();
+            });
+        };
+
+        std::unique_lock lock{state->mutex};
+        ++state->pending;
+        launch(0);
+
+        // A second attempt on the next channel once the first is slower than the method's percentile. Hedges
+        // draw from the retry budget, so a server that slows down for everyone does not get every call twice.
+        if (hedge_delay.count() > 0 && !state->finished.wait_for(lock, hedge_delay, [&state] { return state->result.has_value(); }) && policy_->retry_budget.tryWithdraw()) {
+            ++state->pending;
+            launch(1);
+        }
+        state->finished.wait(lock, [&state] { return state->result.has_value(); });
+
+        // The losing attempt is no longer needed; cancelling a finished call does nothing
+        for (const auto &context: state->contexts) {
+            if (context) {
+                context->TryCancel();
+            }
+        }
+        return std::move(*state->result);
+    }
+
+    /// @brief Get the deadline of a call starting now
+    /// @param[in] operation_name Name of the operation
+    /// @return Deadline configured for the method, nullopt if it has none
+    auto AuthRpcClient::deadlineFor(const std::string_view operation_name) const noexcept -> std::optional<std::chrono::system_clock::time_point> {
+        const auto it = policy_->method_deadlines.find(operation_name);
+        const auto timeout = it != policy_->method_deadlines.end() ? it->second : policy_->default_deadline;
+        if (timeout.count() <= 0) {
+            return std::nullopt;
+        }
+        return std::chrono::system_clock::now() + timeout;
+    }
+
+    /// @brief Pick the stub of the next call
+    /// @return Stub of the next channel in round-robin order
+    auto AuthRpcClient::nextStub() const noexcept -> rpc::AuthService::Stub & {
+        if (stubs_.size() == 1) {
+            return *stubs_.front();
+        }
+        return *stubs_[next_stub_->fetch_add(1, std::memory_order_relaxed) % stubs_.size()];
+    }
+
     /// @brief Register a new user with username and password
     /// @param[in] username The username to register
     /// @param[in] password The password for the user
@@ -44,22 +401,22 @@ namespace client_app::auth {
         request.set_username(username);
         request.set_password(password);
 
-        return ExecuteRpcCall<rpc::RegisterUserRequest, rpc::AuthResponse>("RegisterUser", request, [this](grpc::ClientContext *context, const rpc::RegisterUserRequest &req, rpc::AuthResponse *response) -> grpc::Status {
-            return this->stub_->RegisterUser(context, req, response);
+        return ExecuteRpcCall<rpc::RegisterUserRequest, rpc::AuthResponse>("RegisterUser", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::RegisterUserRequest &req, rpc::AuthResponse *response) -> grpc::Status {
+            return stub.RegisterUser(context, req, response);
         });
     }
 
     /// @brief Authenticate a user with username and password
     /// @param[in] username The username to authenticate
     /// @param[in] password The password for the user
-    /// @return rpc::AuthResponse containing operation result
+    /// @return rpc::AuthResponse containing operation result and, on success, a session token
     [[nodiscard]] auto AuthRpcClient::AuthenticateUser(const std::string &username, const std::string &password) const noexcept -> rpc::AuthResponse {
         rpc::AuthenticateUserRequest request{};
         request.set_username(username);
         request.set_password(password);
 
-        return ExecuteRpcCall<rpc::AuthenticateUserRequest, rpc::AuthResponse>("AuthenticateUser", request, [this](grpc::ClientContext *context, const rpc::AuthenticateUserRequest &req, rpc::AuthResponse *response) -> grpc::Status {
-            return this->stub_->AuthenticateUser(context, req, response);
+        return ExecuteIdempotentRpcCall<rpc::AuthenticateUserRequest, rpc::AuthResponse>("AuthenticateUser", false, request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::AuthenticateUserRequest &req, grpc::CompletionQueue *queue) {
+            return stub.PrepareAsyncAuthenticateUser(context, req, queue);
         });
     }
 
@@ -70,8 +427,8 @@ namespace client_app::auth {
         rpc::UserExistsRequest request{};
         request.set_username(username);
 
-        return ExecuteRpcCall<rpc::UserExistsRequest, rpc::AuthResponse>("UserExists", request, [this](grpc::ClientContext *context, const rpc::UserExistsRequest &req, rpc::AuthResponse *response) -> grpc::Status {
-            return this->stub_->UserExists(context, req, response);
+        return ExecuteIdempotentRpcCall<rpc::UserExistsRequest, rpc::AuthResponse>("UserExists", true, request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::UserExistsRequest &req, grpc::CompletionQueue *queue) {
+            return stub.PrepareAsyncUserExists(context, req, queue);
         });
     }
 
@@ -86,8 +443,8 @@ namespace client_app::auth {
         request.set_current_password(current_password);
         request.set_new_password(new_password);
 
-        return ExecuteRpcCall<rpc::ChangePasswordRequest, rpc::AuthResponse>("ChangePassword", request, [this](grpc::ClientContext *context, const rpc::ChangePasswordRequest &req, rpc::AuthResponse *response) -> grpc::Status {
-            return this->stub_->ChangePassword(context, req, response);
+        return ExecuteRpcCall<rpc::ChangePasswordRequest, rpc::AuthResponse>("ChangePassword", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::ChangePasswordRequest &req, rpc::AuthResponse *response) -> grpc::Status {
+            return stub.ChangePassword(context, req, response);
         });
     }
 
@@ -100,8 +457,8 @@ namespace client_app::auth {
         request.set_username(username);
         request.set_new_password(new_password);
 
-        return ExecuteRpcCall<rpc::ResetPasswordRequest, rpc::AuthResponse>("ResetPassword", request, [this](grpc::ClientContext *context, const rpc::ResetPasswordRequest &req, rpc::AuthResponse *response) -> grpc::Status {
-            return this->stub_->ResetPassword(context, req, response);
+        return ExecuteRpcCall<rpc::ResetPasswordRequest, rpc::AuthResponse>("ResetPassword", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::ResetPasswordRequest &req, rpc::AuthResponse *response) -> grpc::Status {
+            return stub.ResetPassword(context, req, response);
         });
     }
 
@@ -112,34 +469,247 @@ namespace client_app::auth {
         rpc::DeleteUserRequest request{};
         request.set_username(username);
 
-        return ExecuteRpcCall<rpc::DeleteUserRequest, rpc::AuthResponse>("DeleteUser", request, [this](grpc::ClientContext *context, const rpc::DeleteUserRequest &req, rpc::AuthResponse *response) -> grpc::Status {
-            return this->stub_->DeleteUser(context, req, response);
+        return ExecuteRpcCall<rpc::DeleteUserRequest, rpc::AuthResponse>("DeleteUser", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::DeleteUserRequest &req, rpc::AuthResponse *response) -> grpc::Status {
+            return stub.DeleteUser(context, req, response);
         });
     }
 
-    /// @brief Get the underlying channel's current connectivity state
-    /// @return Current GrpcConnectivityState of the channel
-    auto AuthRpcClient::getConnectivityState() const noexcept -> common::rpc::GrpcConnectivityState {
-        const grpc_connectivity_state raw_state = channel_->GetState(false);
-        return common::rpc::RpcMetadata::grpcStateToEnum(raw_state);
+    /// @brief Validate a session token without sending the password again
+    /// @param[in] session_token The token returned by AuthenticateUser
+    /// @return rpc::ValidateTokenResponse with the token's username and expiry if it is valid
+    [[nodiscard]] auto AuthRpcClient::ValidateToken(const std::string &session_token) const noexcept -> rpc::ValidateTokenResponse {
+        rpc::ValidateTokenRequest request{};
+        request.set_session_token(session_token);
+
+        return ExecuteRpcCall<rpc::ValidateTokenRequest, rpc::ValidateTokenResponse>("ValidateToken", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::ValidateTokenRequest &req, rpc::ValidateTokenResponse *response) -> grpc::Status {
+            return stub.ValidateToken(context, req, response);
+        });
     }
 
-    /// @brief Check if the client channel is ready for RPC calls
-    /// @return True if channel is in READY state
-    auto AuthRpcClient::isReady() const noexcept -> bool {
-        return getConnectivityState() == common::rpc::GrpcConnectivityState::READY;
+    /// @brief Fetch latency percentiles, admission state and negative lookup cache counters of the server
+    /// @return rpc::GetServerStatsResponse with one entry per AuthService method
+    [[nodiscard]] auto AuthRpcClient::GetServerStats() const noexcept -> rpc::GetServerStatsResponse {
+        const rpc::GetServerStatsRequest request{};
+
+        return ExecuteRpcCall<rpc::GetServerStatsRequest, rpc::GetServerStatsResponse>("GetServerStats", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::GetServerStatsRequest &req, rpc::GetServerStatsResponse *response) -> grpc::Status {
+            return stub.GetServerStats(context, req, response);
+        });
+    }
+
+    /// @brief Check which of several users exist in one round trip
+    /// @param[in] usernames The usernames to check
+    /// @return rpc::BatchUserExistsResponse with one existence flag per username, in request order
+    [[nodiscard]] auto AuthRpcClient::BatchUserExists(const std::vector<std::string> &usernames) const noexcept -> rpc::BatchUserExistsResponse {
+        const auto request = makeBatchUserExistsRequest(usernames);
+
+        return ExecuteRpcCall<rpc::BatchUserExistsRequest, rpc::BatchUserExistsResponse>("BatchUserExists", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::BatchUserExistsRequest &req, rpc::BatchUserExistsResponse *response) -> grpc::Status {
+            return stub.BatchUserExists(context, req, response);
+        });
+    }
+
+    /// @brief Register several users in one round trip
+    /// @param[in] users The username and password pairs to register
+    /// @return rpc::BatchRegisterUsersResponse with one result per user, in request order
+    [[nodiscard]] auto AuthRpcClient::BatchRegisterUsers(const std::vector<std::pair<std::string, std::string> > &users) const noexcept -> rpc::BatchRegisterUsersResponse {
+        const auto request = makeBatchRegisterUsersRequest(users);
+
+        return ExecuteRpcCall<rpc::BatchRegisterUsersRequest, rpc::BatchRegisterUsersResponse>("BatchRegisterUsers", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::BatchRegisterUsersRequest &req, rpc::BatchRegisterUsersResponse *response) -> grpc::Status {
+            return stub.BatchRegisterUsers(context, req, response);
+        });
+    }
+
+    /// @brief Authenticate several users over a single bidirectional stream
+    /// @param[in] credentials The username and password pairs to authenticate
+    /// @return One rpc::AuthResponse per credential pair, in request order
+    [[nodiscard]] auto AuthRpcClient::AuthenticateStream(const std::vector<std::pair<std::string, std::string> > &credentials) const noexcept -> std::vector<rpc::AuthResponse> {
+        std::vector<rpc::AuthResponse> responses;
+        responses.reserve(credentials.size());
+
+        grpc::ClientContext context{};
+        if (const auto deadline = deadlineFor("AuthenticateStream")) {
+            context.set_deadline(*deadline);
+        }
+        const auto stream = nextStub().AuthenticateStream(&context);
+
+        // Write concurrently with reading so neither side stalls on flow control
+        std::thread writer([&stream, &credentials] {
+            rpc::AuthenticateUserRequest request{};
+            for (const auto &[username, password]: credentials) {
+                request.set_username(username);
+                request.set_password(password);
+                if (!stream->Write(request)) {
+                    break;
+                }
+            }
+            stream->WritesDone();
+        });
+
+        rpc::AuthResponse response{};
+        while (responses.size() < credentials.size() && stream->Read(&response)) {
+            responses.push_back(response);
+        }
+        writer.join();
+
+        if (const grpc::Status status = stream->Finish(); !status.ok()) {
+            LOG(WARNING) << "RPC AuthenticateStream failed after " << responses.size() << " of " << credentials.size() << " responses: " << status.error_message();
+            response.Clear();
+            response.set_success(false);
+            response.set_message("RPC failed: " + status.error_message());
+            response.set_error_code(status.error_code());
+            responses.resize(credentials.size(), response);
+        } else {
+            LOG(INFO) << "RPC AuthenticateStream succeeded with " << responses.size() << " responses";
+        }
+        return responses;
     }
-}
 
-// Explicit template instantiation for the methods used
-template auto client_app::auth::AuthRpcClient::ExecuteRpcCall<rpc::RegisterUserRequest, rpc::AuthResponse>(const std::string &, const rpc::RegisterUserRequest &, const std::function<grpc::Status(grpc::ClientContext *, const rpc::RegisterUserRequest &, rpc::AuthResponse *)> &) const noexcept -> rpc::AuthResponse;
+    /// @brief Start RegisterUser without waiting for the response
+    /// @param[in] username The username to register
+    /// @param[in] password The password for the user
+    /// @return Future of the rpc::AuthResponse, failures are reported in the response
+    [[nodiscard]] auto AuthRpcClient::RegisterUserAsync(const std::string &username, const std::string &password) const noexcept -> std::future<rpc::AuthResponse> {
+        rpc::RegisterUserRequest request{};
+        request.set_username(username);
+        request.set_password(password);
+
+        return StartAsyncCall<rpc::RegisterUserRequest, rpc::AuthResponse>("RegisterUser", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::RegisterUserRequest &req, grpc::CompletionQueue *queue) {
+            return stub.PrepareAsyncRegisterUser(context, req, queue);
+        });
+    }
+
+    /// @brief Start AuthenticateUser without waiting for the response
+    /// @param[in] username The username to authenticate
+    /// @param[in] password The password for the user
+    /// @return Future of the rpc::AuthResponse, failures are reported in the response
+    [[nodiscard]] auto AuthRpcClient::AuthenticateUserAsync(const std::string &username, const std::string &password) const noexcept -> std::future<rpc::AuthResponse> {
+        rpc::AuthenticateUserRequest request{};
+        request.set_username(username);
+        request.set_password(password);
 
-template auto client_app::auth::AuthRpcClient::ExecuteRpcCall<rpc::AuthenticateUserRequest, rpc::AuthResponse>(const std::string &, const rpc::AuthenticateUserRequest &, const std::function<grpc::Status(grpc::ClientContext *, const rpc::AuthenticateUserRequest &, rpc::AuthResponse *)> &) const noexcept -> rpc::AuthResponse;
+        return StartAsyncCall<rpc::AuthenticateUserRequest, rpc::AuthResponse>("AuthenticateUser", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::AuthenticateUserRequest &req, grpc::CompletionQueue *queue) {
+            return stub.PrepareAsyncAuthenticateUser(context, req, queue);
+        });
+    }
 
-template auto client_app::auth::AuthRpcClient::ExecuteRpcCall<rpc::UserExistsRequest, rpc::AuthResponse>(const std::string &, const rpc::UserExistsRequest &, const std::function<grpc::Status(grpc::ClientContext *, const rpc::UserExistsRequest &, rpc::AuthResponse *)> &) const noexcept -> rpc::AuthResponse;
+    /// @brief Start UserExists without waiting for the response
+    /// @param[in] username The username to check
+    /// @return Future of the rpc::AuthResponse, failures are reported in the response
+    [[nodiscard]] auto AuthRpcClient::UserExistsAsync(const std::string &username) const noexcept -> std::future<rpc::AuthResponse> {
+        rpc::UserExistsRequest request{};
+        request.set_username(username);
 
-template auto client_app::auth::AuthRpcClient::ExecuteRpcCall<rpc::ChangePasswordRequest, rpc::AuthResponse>(const std::string &, const rpc::ChangePasswordRequest &, const std::function<grpc::Status(grpc::ClientContext *, const rpc::ChangePasswordRequest &, rpc::AuthResponse *)> &) const noexcept -> rpc::AuthResponse;
+        return StartAsyncCall<rpc::UserExistsRequest, rpc::AuthResponse>("UserExists", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::UserExistsRequest &req, grpc::CompletionQueue *queue) {
+            return stub.PrepareAsyncUserExists(context, req, queue);
+        });
+    }
 
-template auto client_app::auth::AuthRpcClient::ExecuteRpcCall<rpc::ResetPasswordRequest, rpc::AuthResponse>(const std::string &, const rpc::ResetPasswordRequest &, const std::function<grpc::Status(grpc::ClientContext *, const rpc::ResetPasswordRequest &, rpc::AuthResponse *)> &) const noexcept -> rpc::AuthResponse;
+    /// @brief Start ChangePassword without waiting for the response
+    /// @param[in] username The username whose password to change
+    /// @param[in] current_password The current password
+    /// @param[in] new_password The new password to set
+    /// @return Future of the rpc::AuthResponse, failures are reported in the response
+    [[nodiscard]] auto AuthRpcClient::ChangePasswordAsync(const std::string &username, const std::string &current_password, const std::string &new_password) const noexcept -> std::future<rpc::AuthResponse> {
+        rpc::ChangePasswordRequest request{};
+        request.set_username(username);
+        request.set_current_password(current_password);
+        request.set_new_password(new_password);
+
+        return StartAsyncCall<rpc::ChangePasswordRequest, rpc::AuthResponse>("ChangePassword", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::ChangePasswordRequest &req, grpc::CompletionQueue *queue) {
+            return stub.PrepareAsyncChangePassword(context, req, queue);
+        });
+    }
+
+    /// @brief Start ResetPassword without waiting for the response
+    /// @param[in] username The username whose password to reset
+    /// @param[in] new_password The new password to set
+    /// @return Future of the rpc::AuthResponse, failures are reported in the response
+    [[nodiscard]] auto AuthRpcClient::ResetPasswordAsync(const std::string &username, const std::string &new_password) const noexcept -> std::future<rpc::AuthResponse> {
+        rpc::ResetPasswordRequest request{};
+        request.set_username(username);
+        request.set_new_password(new_password);
+
+        return StartAsyncCall<rpc::ResetPasswordRequest, rpc::AuthResponse>("ResetPassword", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::ResetPasswordRequest &req, grpc::CompletionQueue *queue) {
+            return stub.PrepareAsyncResetPassword(context, req, queue);
+        });
+    }
+
+    /// @brief Start DeleteUser without waiting for the response
+    /// @param[in] username The username to delete
+    /// @return Future of the rpc::AuthResponse, failures are reported in the response
+    [[nodiscard]] auto AuthRpcClient::DeleteUserAsync(const std::string &username) const noexcept -> std::future<rpc::AuthResponse> {
+        rpc::DeleteUserRequest request{};
+        request.set_username(username);
+
+        return StartAsyncCall<rpc::DeleteUserRequest, rpc::AuthResponse>("DeleteUser", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::DeleteUserRequest &req, grpc::CompletionQueue *queue) {
+            return stub.PrepareAsyncDeleteUser(context, req, queue);
+        });
+    }
+
+    /// @brief Start BatchUserExists without waiting for the response
+    /// @param[in] usernames The usernames to check
+    /// @return Future of the rpc::BatchUserExistsResponse, failures are reported in the response
+    [[nodiscard]] auto AuthRpcClient::BatchUserExistsAsync(const std::vector<std::string> &usernames) const noexcept -> std::future<rpc::BatchUserExistsResponse> {
+        const auto request = makeBatchUserExistsRequest(usernames);
+
+        return StartAsyncCall<rpc::BatchUserExistsRequest, rpc::BatchUserExistsResponse>("BatchUserExists", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::BatchUserExistsRequest &req, grpc::CompletionQueue *queue) {
+            return stub.PrepareAsyncBatchUserExists(context, req, queue);
+        });
+    }
+
+    /// @brief Start BatchRegisterUsers without waiting for the response
+    /// @param[in] users The username and password pairs to register
+    /// @return Future of the rpc::BatchRegisterUsersResponse, failures are reported in the response
+    [[nodiscard]] auto AuthRpcClient::BatchRegisterUsersAsync(const std::vector<std::pair<std::string, std::string> > &users) const noexcept -> std::future<rpc::BatchRegisterUsersResponse> {
+        const auto request = makeBatchRegisterUsersRequest(users);
+
+        return StartAsyncCall<rpc::BatchRegisterUsersRequest, rpc::BatchRegisterUsersResponse>("BatchRegisterUsers", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::BatchRegisterUsersRequest &req, grpc::CompletionQueue *queue) {
+            return stub.PrepareAsyncBatchRegisterUsers(context, req, queue);
+        });
+    }
+
+    /// @brief Start ValidateToken without waiting for the response
+    /// @param[in] session_token The token returned by AuthenticateUser
+    /// @return Future of the rpc::ValidateTokenResponse, failures are reported in the response
+    [[nodiscard]] auto AuthRpcClient::ValidateTokenAsync(const std::string &session_token) const noexcept -> std::future<rpc::ValidateTokenResponse> {
+        rpc::ValidateTokenRequest request{};
+        request.set_session_token(session_token);
+
+        return StartAsyncCall<rpc::ValidateTokenRequest, rpc::ValidateTokenResponse>("ValidateToken", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::ValidateTokenRequest &req, grpc::CompletionQueue *queue) {
+            return stub.PrepareAsyncValidateToken(context, req, queue);
+        });
+    }
+
+    /// @brief Start GetServerStats without waiting for the response
+    /// @return Future of the rpc::GetServerStatsResponse, failures are reported in the response
+    [[nodiscard]] auto AuthRpcClient::GetServerStatsAsync() const noexcept -> std::future<rpc::GetServerStatsResponse> {
+        const rpc::GetServerStatsRequest request{};
+
+        return StartAsyncCall<rpc::GetServerStatsRequest, rpc::GetServerStatsResponse>("GetServerStats", request, [](rpc::AuthService::Stub &stub, grpc::ClientContext *context, const rpc::GetServerStatsRequest &req, grpc::CompletionQueue *queue) {
+            return stub.PrepareAsyncGetServerStats(context, req, queue);
+        });
+    }
+
+    /// @brief Get the connectivity state of the client's channels
+    /// @return State of the first channel that is not READY, READY if all of them are
+    auto AuthRpcClient::getConnectivityState() const noexcept -> common::rpc::GrpcConnectivityState {
+        for (const auto &channel: channels_) {
+            if (const grpc_connectivity_state raw_state = channel->GetState(false); raw_state != GRPC_CHANNEL_READY) {
+                return common::rpc::RpcMetadata::grpcStateToEnum(raw_state);
+            }
+        }
+        return common::rpc::GrpcConnectivityState::READY;
+    }
+
+    /// @brief Check if the client channels are ready for RPC calls
+    /// @return True if every channel is in READY state
+    auto AuthRpcClient::isReady() const noexcept -> bool {
+        return getConnectivityState() == common::rpc::GrpcConnectivityState::READY;
+    }
+
+    /// @brief Get the number of channels calls are spread over
+    /// @return Number of channels
+    auto AuthRpcClient::channelCount() const noexcept -> size_t {
+        return channels_.size();
+    }
+}
 
-template auto client_app::auth::AuthRpcClient::ExecuteRpcCall<rpc::DeleteUserRequest, rpc::AuthResponse>(const std::string &, const rpc::DeleteUserRequest &, const std::function<grpc::Status(grpc::ClientContext *, const rpc::DeleteUserRequest &, rpc::AuthResponse *)> &) const noexcept -> rpc::AuthResponse;
@@ -1,14 +1,36 @@
 #pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 #include <grpcpp/grpcpp.h>
 
 #include "generated/RpcService.grpc.pb.h"
+#include "src/auth/AuthRpcClientOptions.hpp"
 #include "src/rpc/GrpcConnectivityState.hpp"
 
 namespace client_app::auth {
     /// @brief RPC client for communicating with the server.
-    /// @details This class provides methods to interact with the RPC service.
+    /// @details This class provides methods to interact with the RPC service. Calls are spread
+    /// round-robin over one or more channels, so a client built with several channels is not
+    /// capped by the stream limit and single-threaded framing of one HTTP/2 connection. Every
+    /// unary method also has an Async variant that starts the call on the generated async stub and
+    /// returns a future; completions are drained by one thread per client, so a single caller can
+    /// keep thousands of calls in flight.
+    ///
+    /// Every call carries the deadline configured for its method, shared by all of its attempts.
+    /// The idempotent UserExists and AuthenticateUser calls are retried with jittered exponential
+    /// backoff when the server is unavailable or sheds them, as long as the retry budget allows.
+    /// UserExists has no side effects and can also be hedged: once an attempt is slower than the
+    /// configured percentile, a second attempt goes out on another channel and the first response
+    /// wins. AuthenticateUser is never hedged, since a duplicate attempt would count a second
+    /// failure towards the lockout or rehash and issue a token twice.
     class AuthRpcClient {
     public:
         /// @brief Default constructor explicitly deleted to enforce parameterized construction
@@ -18,20 +40,31 @@ namespace client_app::auth {
         /// @param channel The gRPC channel to use for communication
         explicit AuthRpcClient(const std::shared_ptr<grpc::Channel> &channel) noexcept;
 
+        /// @brief Construct a new AuthRpcClient object that spreads calls over several channels
+        /// @param channels The gRPC channels to use for communication, at least one
+        /// @details Channels only use separate connections if they were created with distinct
+        /// arguments or GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL; otherwise gRPC shares one subchannel.
+        explicit AuthRpcClient(std::vector<std::shared_ptr<grpc::Channel> > channels) noexcept;
+
+        /// @brief Construct a new AuthRpcClient object with deadlines, retries and hedging from options
+        /// @param channels The gRPC channels to use for communication, at least one
+        /// @param options Client options providing the deadline, retry and hedging settings
+        AuthRpcClient(std::vector<std::shared_ptr<grpc::Channel> > channels, const app_client::auth::AuthRpcClientOptions &options) noexcept;
+
         /// @brief Copy constructor deleted to enforce unique ownership semantics
         AuthRpcClient(const AuthRpcClient &) = delete;
 
         /// @brief Move constructor with noexcept guarantee for efficient resource transfer
-        AuthRpcClient(AuthRpcClient &&) noexcept = default;
+        AuthRpcClient(AuthRpcClient &&) noexcept;
 
         /// @brief Copy assignment operator deleted to prevent unintended resource duplication
         auto operator=(const AuthRpcClient &) -> AuthRpcClient & = delete;
 
         /// @brief Move assignment operator with noexcept guarantee
-        auto operator=(AuthRpcClient &&) noexcept -> AuthRpcClient & = default;
+        auto operator=(AuthRpcClient &&) noexcept -> AuthRpcClient &;
 
-        /// @brief Virtual destructor with default implementation for proper polymorphic cleanup
-        virtual ~AuthRpcClient() noexcept = default;
+        /// @brief Virtual destructor, waits for the async calls still in flight
+        virtual ~AuthRpcClient() noexcept;
 
         /// @brief Register a new user with username and password
         /// @param[in] username The username to register
@@ -42,7 +75,7 @@ namespace client_app::auth {
         /// @brief Authenticate a user with username and password
         /// @param[in] username The username to authenticate
         /// @param[in] password The password for the user
-        /// @return rpc::AuthResponse containing operation result
+        /// @return rpc::AuthResponse containing operation result and, on success, a session token
         [[nodiscard]] auto AuthenticateUser(const std::string &username, const std::string &password) const noexcept -> rpc::AuthResponse;
 
         /// @brief Check if a user exists
@@ -68,29 +101,186 @@ namespace client_app::auth {
         /// @return rpc::AuthResponse containing operation result
         [[nodiscard]] auto DeleteUser(const std::string &username) const noexcept -> rpc::AuthResponse;
 
-        /// @brief Get the underlying channel's current connectivity state
-        /// @return Current GrpcConnectivityState of the channel
+        /// @brief Check which of several users exist in one round trip
+        /// @param[in] usernames The usernames to check
+        /// @return rpc::BatchUserExistsResponse with one existence flag per username, in request order
+        [[nodiscard]] auto BatchUserExists(const std::vector<std::string> &usernames) const noexcept -> rpc::BatchUserExistsResponse;
+
+        /// @brief Register several users in one round trip
+        /// @param[in] users The username and password pairs to register
+        /// @return rpc::BatchRegisterUsersResponse with one result per user, in request order
+        [[nodiscard]] auto BatchRegisterUsers(const std::vector<std::pair<std::string, std::string> > &users) const noexcept -> rpc::BatchRegisterUsersResponse;
+
+        /// @brief Authenticate several users over a single bidirectional stream
+        /// @param[in] credentials The username and password pairs to authenticate
+        /// @return One rpc::AuthResponse per credential pair, in request order
+        /// @details Requests are written from a separate thread while responses are read, so the server
+        /// can pipeline them. If the stream fails, the missing responses carry the failure status.
+        [[nodiscard]] auto AuthenticateStream(const std::vector<std::pair<std::string, std::string> > &credentials) const noexcept -> std::vector<rpc::AuthResponse>;
+
+        /// @brief Validate a session token without sending the password again
+        /// @param[in] session_token The token returned by AuthenticateUser
+        /// @return rpc::ValidateTokenResponse with the token's username and expiry if it is valid
+        [[nodiscard]] auto ValidateToken(const std::string &session_token) const noexcept -> rpc::ValidateTokenResponse;
+
+        /// @brief Fetch latency percentiles, admission state and negative lookup cache counters of the server
+        /// @return rpc::GetServerStatsResponse with one entry per AuthService method
+        [[nodiscard]] auto GetServerStats() const noexcept -> rpc::GetServerStatsResponse;
+
+        /// @brief Start RegisterUser without waiting for the response
+        /// @param[in] username The username to register
+        /// @param[in] password The password for the user
+        /// @return Future of the rpc::AuthResponse, failures are reported in the response
+        [[nodiscard]] auto RegisterUserAsync(const std::string &username, const std::string &password) const noexcept -> std::future<rpc::AuthResponse>;
+
+        /// @brief Start AuthenticateUser without waiting for the response
+        /// @param[in] username The username to authenticate
+        /// @param[in] password The password for the user
+        /// @return Future of the rpc::AuthResponse, failures are reported in the response
+        [[nodiscard]] auto AuthenticateUserAsync(const std::string &username, const std::string &password) const noexcept -> std::future<rpc::AuthResponse>;
+
+        /// @brief Start UserExists without waiting for the response
+        /// @param[in] username The username to check
+        /// @return Future of the rpc::AuthResponse, failures are reported in the response
+        [[nodiscard]] auto UserExistsAsync(const std::string &username) const noexcept -> std::future<rpc::AuthResponse>;
+
+        /// @brief Start ChangePassword without waiting for the response
+        /// @param[in] username The username whose password to change
+        /// @param[in] current_password The current password
+        /// @param[in] new_password The new password to set
+        /// @return Future of the rpc::AuthResponse, failures are reported in the response
+        [[nodiscard]] auto ChangePasswordAsync(const std::string &username, const std::string &current_password, const std::string &new_password) const noexcept -> std::future<rpc::AuthResponse>;
+
+        /// @brief Start ResetPassword without waiting for the response
+        /// @param[in] username The username whose password to reset
+        /// @param[in] new_password The new password to set
+        /// @return Future of the rpc::AuthResponse, failures are reported in the response
+        [[nodiscard]] auto ResetPasswordAsync(const std::string &username, const std::string &new_password) const noexcept -> std::future<rpc::AuthResponse>;
+
+        /// @brief Start DeleteUser without waiting for the response
+        /// @param[in] username The username to delete
+        /// @return Future of the rpc::AuthResponse, failures are reported in the response
+        [[nodiscard]] auto DeleteUserAsync(const std::string &username) const noexcept -> std::future<rpc::AuthResponse>;
+
+        /// @brief Start BatchUserExists without waiting for the response
+        /// @param[in] usernames The usernames to check
+        /// @return Future of the rpc::BatchUserExistsResponse, failures are reported in the response
+        [[nodiscard]] auto BatchUserExistsAsync(const std::vector<std::string> &usernames) const noexcept -> std::future<rpc::BatchUserExistsResponse>;
+
+        /// @brief Start BatchRegisterUsers without waiting for the response
+        /// @param[in] users The username and password pairs to register
+        /// @return Future of the rpc::BatchRegisterUsersResponse, failures are reported in the response
+        [[nodiscard]] auto BatchRegisterUsersAsync(const std::vector<std::pair<std::string, std::string> > &users) const noexcept -> std::future<rpc::BatchRegisterUsersResponse>;
+
+        /// @brief Start ValidateToken without waiting for the response
+        /// @param[in] session_token The token returned by AuthenticateUser
+        /// @return Future of the rpc::ValidateTokenResponse, failures are reported in the response
+        [[nodiscard]] auto ValidateTokenAsync(const std::string &session_token) const noexcept -> std::future<rpc::ValidateTokenResponse>;
+
+        /// @brief Start GetServerStats without waiting for the response
+        /// @return Future of the rpc::GetServerStatsResponse, failures are reported in the response
+        [[nodiscard]] auto GetServerStatsAsync() const noexcept -> std::future<rpc::GetServerStatsResponse>;
+
+        /// @brief Get the connectivity state of the client's channels
+        /// @return State of the first channel that is not READY, READY if all of them are
         [[nodiscard]] auto getConnectivityState() const noexcept -> common::rpc::GrpcConnectivityState;
 
-        /// @brief Check if the client channel is ready for RPC calls
-        /// @return True if channel is in READY state
+        /// @brief Check if the client channels are ready for RPC calls
+        /// @return True if every channel is in READY state
         [[nodiscard]] auto isReady() const noexcept -> bool;
 
+        /// @brief Get the number of channels calls are spread over
+        /// @return Number of channels
+        [[nodiscard]] auto channelCount() const noexcept -> size_t;
+
     private:
+        /// @brief Completion queue of the async calls and the thread that drains it
+        class CompletionPoller;
+
+        /// @brief Deadline, retry and hedging settings with the state they need
+        struct CallPolicy;
+
         /// @brief Execute RPC call with error handling and logging
         /// @tparam RequestType Type of the request message
         /// @tparam ResponseType Type of the response message
+        /// @tparam RpcCall Callable performing the blocking call on a stub
         /// @param[in] operation_name Name of the operation for logging
         /// @param[in] request The request message to send
-        /// @param[in] rpc_call Function that performs the actual RPC call
-        /// @return rpc::AuthResponse containing operation result
-        template<typename RequestType, typename ResponseType>
-        [[nodiscard]] auto ExecuteRpcCall(const std::string &operation_name, const RequestType &request, const std::function<grpc::Status(grpc::ClientContext *, const RequestType &, ResponseType *)> &rpc_call) const noexcept -> ResponseType;
+        /// @param[in] rpc_call Callable that performs the actual RPC call
+        /// @return ResponseType containing operation result
+        template<typename RequestType, typename ResponseType, typename RpcCall>
+        [[nodiscard]] auto ExecuteRpcCall(std::string_view operation_name, const RequestType &request, RpcCall &&rpc_call) const noexcept -> ResponseType;
+
+        /// @brief Execute an idempotent RPC call with retries and hedging
+        /// @tparam RequestType Type of the request message
+        /// @tparam ResponseType Type of the response message
+        /// @tparam PrepareCall Callable preparing the async call on a stub
+        /// @param[in] operation_name Name of the operation for logging, deadlines and latency tracking
+        /// @param[in] hedgeable Whether slow attempts may be hedged, only for methods without side effects
+        /// @param[in] request The request message to send
+        /// @param[in] prepare_call Callable that prepares the call on the client's completion queue
+        /// @return ResponseType of the first successful attempt, or of the last one if all failed
+        template<typename RequestType, typename ResponseType, typename PrepareCall>
+        [[nodiscard]] auto ExecuteIdempotentRpcCall(std::string_view operation_name, bool hedgeable, const RequestType &request, PrepareCall &&prepare_call) const noexcept -> ResponseType;
+
+        /// @brief Send one attempt of an idempotent call, hedged if it is slow and the retry budget allows
+        /// @tparam RequestType Type of the request message
+        /// @tparam ResponseType Type of the response message
+        /// @tparam PrepareCall Callable preparing the async call on a stub
+        /// @param[in] request The request message to send
+        /// @param[in] prepare_call Callable that prepares the call on the client's completion queue
+        /// @param[in] deadline Deadline of the call, nullopt for none
+        /// @param[in] hedge_delay Time after which a second attempt is sent, 0 to never hedge
+        /// @return Status and response of the first attempt that succeeded, or of the last one to fail
+        template<typename RequestType, typename ResponseType, typename PrepareCall>
+        [[nodiscard]] auto HedgedAttempt(const RequestType &request, const PrepareCall &prepare_call, std::optional<std::chrono::system_clock::time_point> deadline, std::chrono::microseconds hedge_delay) const -> std::pair<grpc::Status, ResponseType>;
+
+        /// @brief Start an RPC call on the async stub
+        /// @tparam RequestType Type of the request message
+        /// @tparam ResponseType Type of the response message
+        /// @tparam PrepareCall Callable preparing the async call on a stub
+        /// @param[in] operation_name Name of the operation for logging
+        /// @param[in] request The request message to send
+        /// @param[in] prepare_call Callable that prepares the call on the client's completion queue
+        /// @return Future of the response, completed by the poller thread
+        template<typename RequestType, typename ResponseType, typename PrepareCall>
+        [[nodiscard]] auto StartAsyncCall(std::string_view operation_name, const RequestType &request, PrepareCall &&prepare_call) const noexcept -> std::future<ResponseType>;
+
+        /// @brief Send an RPC call on the async stub and hand its outcome to a callback
+        /// @tparam RequestType Type of the request message
+        /// @tparam ResponseType Type of the response message
+        /// @tparam PrepareCall Callable preparing the async call on a stub
+        /// @tparam OnComplete Callable taking the status and response, run on the poller thread
+        /// @param[in] stub Stub to send the call on
+        /// @param[in] context Context of the call, kept alive until the call completes
+        /// @param[in] request The request message to send, serialized before this returns
+        /// @param[in] prepare_call Callable that prepares the call on the client's completion queue
+        /// @param[in] on_complete Callable receiving the outcome
+        template<typename RequestType, typename ResponseType, typename PrepareCall, typename OnComplete>
+        auto LaunchAsyncCall(rpc::AuthService::Stub &stub, std::shared_ptr<grpc::ClientContext> context, const RequestType &request, const PrepareCall &prepare_call, OnComplete &&on_complete) const -> void;
+
+        /// @brief Get the deadline of a call starting now
+        /// @param[in] operation_name Name of the operation
+        /// @return Deadline configured for the method, nullopt if it has none
+        [[nodiscard]] auto deadlineFor(std::string_view operation_name) const noexcept -> std::optional<std::chrono::system_clock::time_point>;
+
+        /// @brief Pick the stub of the next call
+        /// @return Stub of the next channel in round-robin order
+        [[nodiscard]] auto nextStub() const noexcept -> rpc::AuthService::Stub &;
+
+        /// @brief gRPC stubs for making RPC calls, one per channel
+        std::vector<std::unique_ptr<rpc::AuthService::Stub> > stubs_;
+
+        /// @brief Store references to the original channels to access connectivity state
+        std::vector<std::shared_ptr<grpc::Channel> > channels_;
+
+        /// @brief Round-robin position, on the heap so the client stays movable
+        std::unique_ptr<std::atomic<size_t> > next_stub_;
 
-        /// @brief gRPC stub for making RPC calls
-        std::unique_ptr<rpc::AuthService::Stub> stub_;
+        /// @brief Deadline, retry and hedging settings, on the heap so the client stays movable
+        std::unique_ptr<CallPolicy> policy_;
 
-        /// @brief Store reference to the original channel to access connectivity state
-        std::shared_ptr<grpc::Channel> channel_;
+        /// @brief Completion queue of the async calls, destroyed first so in-flight calls finish while the stubs exist
+        std::unique_ptr<CompletionPoller> poller_;
     };
 }
@@ -4,7 +4,7 @@
 #include <chrono>  // C++20
 
 namespace app_client::auth {
-    AuthRpcClientOptions::AuthRpcClientOptions(const int32_t keepalive_time_ms, const int32_t keepalive_timeout_ms, const int32_t keepalive_permit_without_calls, std::string server_address) noexcept : keepalive_time_ms_(keepalive_time_ms), keepalive_timeout_ms_(keepalive_timeout_ms), keepalive_permit_without_calls_(keepalive_permit_without_calls), server_address_(std::move(server_address)) {
+    AuthRpcClientOptions::AuthRpcClientOptions(const int32_t keepalive_time_ms, const int32_t keepalive_timeout_ms, const int32_t keepalive_permit_without_calls, std::string server_address, const int32_t channel_count, const int32_t connect_timeout_ms, const int32_t deadline_ms, std::map<std::string, int32_t> method_deadlines_ms, const int32_t retry_max_attempts, const double retry_budget_ratio, const int32_t retry_initial_backoff_ms, const int32_t retry_max_backoff_ms, const bool hedging_enabled, const double hedging_percentile) noexcept : keepalive_time_ms_(keepalive_time_ms), keepalive_timeout_ms_(keepalive_timeout_ms), keepalive_permit_without_calls_(keepalive_permit_without_calls), server_address_(std::move(server_address)), channel_count_(channel_count), connect_timeout_ms_(connect_timeout_ms), deadline_ms_(deadline_ms), method_deadlines_ms_(std::move(method_deadlines_ms)), retry_max_attempts_(retry_max_attempts), retry_budget_ratio_(retry_budget_ratio), retry_initial_backoff_ms_(retry_initial_backoff_ms), retry_max_backoff_ms_(retry_max_backoff_ms), hedging_enabled_(hedging_enabled), hedging_percentile_(hedging_percentile) {
         validate(); // Validate parameters after construction
     }
 
@@ -28,8 +28,58 @@ namespace app_client::auth {
         return *this;
     }
 
+    auto AuthRpcClientOptions::Builder::channelCount(const int32_t value) noexcept -> Builder & {
+        channel_count_ = value;
+        return *this;
+    }
+
+    auto AuthRpcClientOptions::Builder::connectTimeoutMs(const int32_t value) noexcept -> Builder & {
+        connect_timeout_ms_ = value;
+        return *this;
+    }
+
+    auto AuthRpcClientOptions::Builder::deadlineMs(const int32_t value) noexcept -> Builder & {
+        deadline_ms_ = value;
+        return *this;
+    }
+
+    auto AuthRpcClientOptions::Builder::methodDeadlinesMs(const std::map<std::string, int32_t> &value) noexcept -> Builder & {
+        method_deadlines_ms_ = value;
+        return *this;
+    }
+
+    auto AuthRpcClientOptions::Builder::retryMaxAttempts(const int32_t value) noexcept -> Builder & {
+        retry_max_attempts_ = value;
+        return *this;
+    }
+
+    auto AuthRpcClientOptions::Builder::retryBudgetRatio(const double value) noexcept -> Builder & {
+        retry_budget_ratio_ = value;
+        return *this;
+    }
+
+    auto AuthRpcClientOptions::Builder::retryInitialBackoffMs(const int32_t value) noexcept -> Builder & {
+        retry_initial_backoff_ms_ = value;
+        return *this;
+    }
+
+    auto AuthRpcClientOptions::Builder::retryMaxBackoffMs(const int32_t value) noexcept -> Builder & {
+        retry_max_backoff_ms_ = value;
+        return *this;
+    }
+
+    auto AuthRpcClientOptions::Builder::hedgingEnabled(const bool value) noexcept -> Builder & {
+        hedging_enabled_ = value;
+        return *this;
+    }
+
+    auto AuthRpcClientOptions::Builder::hedgingPercentile(const double value) noexcept -> Builder & {
+        hedging_percentile_ = value;
+        return *this;
+    }
+
     auto AuthRpcClientOptions::Builder::build() const -> AuthRpcClientOptions {
-        return AuthRpcClientOptions{keepalive_time_ms_, keepalive_timeout_ms_, keepalive_permit_without_calls_, server_address_};
+        return AuthRpcClientOptions{keepalive_time_ms_, keepalive_timeout_ms_, keepalive_permit_without_calls_, server_address_, channel_count_, connect_timeout_ms_, deadline_ms_, method_deadlines_ms_, retry_max_attempts_, retry_budget_ratio_, retry_initial_backoff_ms_, retry_max_backoff_ms_, hedging_enabled_, hedging_percentile_};
     }
 
     auto AuthRpcClientOptions::builder() -> Builder {
@@ -73,6 +123,96 @@ namespace app_client::auth {
         validate(); // Validate after setting new value
     }
 
+    auto AuthRpcClientOptions::channelCount() const noexcept -> int32_t {
+        return channel_count_;
+    }
+
+    auto AuthRpcClientOptions::channelCount(const int32_t value) noexcept -> void {
+        channel_count_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto AuthRpcClientOptions::connectTimeoutMs() const noexcept -> int32_t {
+        return connect_timeout_ms_;
+    }
+
+    auto AuthRpcClientOptions::connectTimeoutMs(const int32_t value) noexcept -> void {
+        connect_timeout_ms_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto AuthRpcClientOptions::deadlineMs() const noexcept -> int32_t {
+        return deadline_ms_;
+    }
+
+    auto AuthRpcClientOptions::deadlineMs(const int32_t value) noexcept -> void {
+        deadline_ms_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto AuthRpcClientOptions::methodDeadlinesMs() const noexcept -> const std::map<std::string, int32_t> & {
+        return method_deadlines_ms_;
+    }
+
+    auto AuthRpcClientOptions::methodDeadlinesMs(const std::map<std::string, int32_t> &value) noexcept -> void {
+        method_deadlines_ms_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto AuthRpcClientOptions::retryMaxAttempts() const noexcept -> int32_t {
+        return retry_max_attempts_;
+    }
+
+    auto AuthRpcClientOptions::retryMaxAttempts(const int32_t value) noexcept -> void {
+        retry_max_attempts_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto AuthRpcClientOptions::retryBudgetRatio() const noexcept -> double {
+        return retry_budget_ratio_;
+    }
+
+    auto AuthRpcClientOptions::retryBudgetRatio(const double value) noexcept -> void {
+        retry_budget_ratio_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto AuthRpcClientOptions::retryInitialBackoffMs() const noexcept -> int32_t {
+        return retry_initial_backoff_ms_;
+    }
+
+    auto AuthRpcClientOptions::retryInitialBackoffMs(const int32_t value) noexcept -> void {
+        retry_initial_backoff_ms_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto AuthRpcClientOptions::retryMaxBackoffMs() const noexcept -> int32_t {
+        return retry_max_backoff_ms_;
+    }
+
+    auto AuthRpcClientOptions::retryMaxBackoffMs(const int32_t value) noexcept -> void {
+        retry_max_backoff_ms_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto AuthRpcClientOptions::hedgingEnabled() const noexcept -> bool {
+        return hedging_enabled_;
+    }
+
+    auto AuthRpcClientOptions::hedgingEnabled(const bool value) noexcept -> void {
+        hedging_enabled_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto AuthRpcClientOptions::hedgingPercentile() const noexcept -> double {
+        return hedging_percentile_;
+    }
+
+    auto AuthRpcClientOptions::hedgingPercentile(const double value) noexcept -> void {
+        hedging_percentile_ = value;
+        validate(); // Validate after setting new value
+    }
+
     auto AuthRpcClientOptions::deserializedFromYamlFile(const std::filesystem::path &path) -> void {
         if (!std::filesystem::exists(path)) {
             throw std::runtime_error("Configuration file does not exist: " + path.string());
@@ -94,6 +234,36 @@ namespace app_client::auth {
             if (const auto serverAddressNode = grpcNode["serverAddress"]; serverAddressNode) {
                 server_address_ = serverAddressNode.as<std::string>();
             }
+            if (const auto channelCountNode = grpcNode["channelCount"]; channelCountNode) {
+                channel_count_ = channelCountNode.as<int32_t>();
+            }
+            if (const auto connectTimeoutMsNode = grpcNode["connectTimeoutMs"]; connectTimeoutMsNode) {
+                connect_timeout_ms_ = connectTimeoutMsNode.as<int32_t>();
+            }
+            if (const auto deadlineMsNode = grpcNode["deadlineMs"]; deadlineMsNode) {
+                deadline_ms_ = deadlineMsNode.as<int32_t>();
+            }
+            if (const auto methodDeadlinesMsNode = grpcNode["methodDeadlinesMs"]; methodDeadlinesMsNode) {
+                method_deadlines_ms_ = methodDeadlinesMsNode.as<std::map<std::string, int32_t> >();
+            }
+            if (const auto retryMaxAttemptsNode = grpcNode["retryMaxAttempts"]; retryMaxAttemptsNode) {
+                retry_max_attempts_ = retryMaxAttemptsNode.as<int32_t>();
+            }
+            if (const auto retryBudgetRatioNode = grpcNode["retryBudgetRatio"]; retryBudgetRatioNode) {
+                retry_budget_ratio_ = retryBudgetRatioNode.as<double>();
+            }
+            if (const auto retryInitialBackoffMsNode = grpcNode["retryInitialBackoffMs"]; retryInitialBackoffMsNode) {
+                retry_initial_backoff_ms_ = retryInitialBackoffMsNode.as<int32_t>();
+            }
+            if (const auto retryMaxBackoffMsNode = grpcNode["retryMaxBackoffMs"]; retryMaxBackoffMsNode) {
+                retry_max_backoff_ms_ = retryMaxBackoffMsNode.as<int32_t>();
+            }
+            if (const auto hedgingEnabledNode = grpcNode["hedgingEnabled"]; hedgingEnabledNode) {
+                hedging_enabled_ = hedgingEnabledNode.as<bool>();
+            }
+            if (const auto hedgingPercentileNode = grpcNode["hedgingPercentile"]; hedgingPercentileNode) {
+                hedging_percentile_ = hedgingPercentileNode.as<double>();
+            }
         } catch (const YAML::Exception &e) {
             throw std::runtime_error("Failed to parse YAML file '" + path.string() + "': " + e.what());
         } catch (const std::exception &e) {
@@ -120,6 +290,25 @@ namespace app_client::auth {
 
         // Validate server address
         LOG_IF(WARNING, server_address_.empty()) << "Server address is empty. Using default value localhost:50051.";
+
+        // Validate channel count (should be positive)
+        LOG_IF(WARNING, channel_count_ <= 0) << "Invalid channel count: " << channel_count_ << ". Using a single channel.";
+
+        // Validate timeouts and deadlines (should be positive, 0 disables the default deadline)
+        LOG_IF(WARNING, connect_timeout_ms_ <= 0) << "Invalid connection timeout: " << connect_timeout_ms_ << "ms. Channels will not wait to connect.";
+        LOG_IF(WARNING, deadline_ms_ < 0) << "Invalid call deadline: " << deadline_ms_ << "ms. Use 0 to send calls without a deadline.";
+        for (const auto &[method_name, deadline]: method_deadlines_ms_) {
+            LOG_IF(WARNING, deadline < 0) << "Invalid deadline for " << method_name << ": " << deadline << "ms. Use 0 to send its calls without a deadline.";
+        }
+
+        // Validate retry settings
+        LOG_IF(WARNING, retry_max_attempts_ < 1) << "Invalid retry max attempts: " << retry_max_attempts_ << ". Every call makes at least one attempt.";
+        LOG_IF(WARNING, retry_budget_ratio_ < 0.0) << "Invalid retry budget ratio: " << retry_budget_ratio_ << ". Using 0, which only allows the initial reserve of retries.";
+        LOG_IF(WARNING, retry_initial_backoff_ms_ < 0 || retry_max_backoff_ms_ < retry_initial_backoff_ms_) << "Invalid retry backoff: initial " << retry_initial_backoff_ms_ << "ms, max " << retry_max_backoff_ms_ << "ms. The initial backoff must be between 0 and the max backoff.";
+
+        // Validate hedging settings
+        LOG_IF(WARNING, hedging_percentile_ <= 0.0 || hedging_percentile_ >= 100.0) << "Invalid hedging percentile: " << hedging_percentile_ << ". Valid values are between 0 and 100.";
+        LOG_IF(WARNING, hedging_enabled_ && channel_count_ == 1) << "Hedging is enabled with a single channel. Hedged attempts will share the connection of the attempt they hedge.";
     }
 }
 
@@ -136,6 +325,36 @@ auto YAML::convert<app_client::auth::AuthRpcClientOptions>::decode(const YAML::N
     if (const auto serverAddressNode = node["serverAddress"]; serverAddressNode) {
         rhs.serverAddress(serverAddressNode.as<std::string>());
     }
+    if (const auto channelCountNode = node["channelCount"]; channelCountNode) {
+        rhs.channelCount(channelCountNode.as<int32_t>());
+    }
+    if (const auto connectTimeoutMsNode = node["connectTimeoutMs"]; connectTimeoutMsNode) {
+        rhs.connectTimeoutMs(connectTimeoutMsNode.as<int32_t>());
+    }
+    if (const auto deadlineMsNode = node["deadlineMs"]; deadlineMsNode) {
+        rhs.deadlineMs(deadlineMsNode.as<int32_t>());
+    }
+    if (const auto methodDeadlinesMsNode = node["methodDeadlinesMs"]; methodDeadlinesMsNode) {
+        rhs.methodDeadlinesMs(methodDeadlinesMsNode.as<std::map<std::string, int32_t> >());
+    }
+    if (const auto retryMaxAttemptsNode = node["retryMaxAttempts"]; retryMaxAttemptsNode) {
+        rhs.retryMaxAttempts(retryMaxAttemptsNode.as<int32_t>());
+    }
+    if (const auto retryBudgetRatioNode = node["retryBudgetRatio"]; retryBudgetRatioNode) {
+        rhs.retryBudgetRatio(retryBudgetRatioNode.as<double>());
+    }
+    if (const auto retryInitialBackoffMsNode = node["retryInitialBackoffMs"]; retryInitialBackoffMsNode) {
+        rhs.retryInitialBackoffMs(retryInitialBackoffMsNode.as<int32_t>());
+    }
+    if (const auto retryMaxBackoffMsNode = node["retryMaxBackoffMs"]; retryMaxBackoffMsNode) {
+        rhs.retryMaxBackoffMs(retryMaxBackoffMsNode.as<int32_t>());
+    }
+    if (const auto hedgingEnabledNode = node["hedgingEnabled"]; hedgingEnabledNode) {
+        rhs.hedgingEnabled(hedgingEnabledNode.as<bool>());
+    }
+    if (const auto hedgingPercentileNode = node["hedgingPercentile"]; hedgingPercentileNode) {
+        rhs.hedgingPercentile(hedgingPercentileNode.as<double>());
+    }
     return true;
 }
 
@@ -145,5 +364,15 @@ auto YAML::convert<app_client::auth::AuthRpcClientOptions>::encode(const app_cli
     node["keepaliveTimeoutMs"] = rhs.keepaliveTimeoutMs();
     node["keepalivePermitWithoutCalls"] = rhs.keepalivePermitWithoutCalls();
     node["serverAddress"] = rhs.serverAddress();
+    node["channelCount"] = rhs.channelCount();
+    node["connectTimeoutMs"] = rhs.connectTimeoutMs();
+    node["deadlineMs"] = rhs.deadlineMs();
+    node["methodDeadlinesMs"] = rhs.methodDeadlinesMs();
+    node["retryMaxAttempts"] = rhs.retryMaxAttempts();
+    node["retryBudgetRatio"] = rhs.retryBudgetRatio();
+    node["retryInitialBackoffMs"] = rhs.retryInitialBackoffMs();
+    node["retryMaxBackoffMs"] = rhs.retryMaxBackoffMs();
+    node["hedgingEnabled"] = rhs.hedgingEnabled();
+    node["hedgingPercentile"] = rhs.hedgingPercentile();
     return node;
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include <yaml-cpp/node/node.h>
 #include <filesystem>
+#include <map>
 #include <string>
 #include <chrono>    // C++20
 
@@ -20,6 +21,7 @@ namespace app_client::auth {
     ///     .keepaliveTimeoutMs(5000)
     ///     .keepalivePermitWithoutCalls(1)
     ///     .serverAddress("localhost:50051")
+    ///     .channelCount(4)
     ///     .build();
     /// @endcode
     class AuthRpcClientOptions final : public common::interfaces::IYamlConfigurable {
@@ -32,7 +34,17 @@ namespace app_client::auth {
         /// @param keepalive_timeout_ms Timeout for keepalive ping acknowledgment in milliseconds
         /// @param keepalive_permit_without_calls Flag to permit keepalive pings without active calls (1=true, 0=false)
         /// @param server_address The gRPC server address in format "host:port"
-        AuthRpcClientOptions(int32_t keepalive_time_ms, int32_t keepalive_timeout_ms, int32_t keepalive_permit_without_calls, std::string server_address) noexcept;
+        /// @param channel_count Number of channels, each with its own connection, calls are spread over
+        /// @param connect_timeout_ms Time to wait for each channel to connect at startup in milliseconds
+        /// @param deadline_ms Deadline of calls without a method-specific deadline in milliseconds, 0 for none
+        /// @param method_deadlines_ms Deadlines in milliseconds keyed by method name, overriding deadline_ms
+        /// @param retry_max_attempts Maximum number of attempts of an idempotent call, 1 disables retries
+        /// @param retry_budget_ratio Retries allowed per call sent, across all methods
+        /// @param retry_initial_backoff_ms Backoff cap before the first retry in milliseconds
+        /// @param retry_max_backoff_ms Largest backoff cap in milliseconds
+        /// @param hedging_enabled Whether slow read-only calls are hedged on another channel
+        /// @param hedging_percentile Latency percentile of a method after which a hedged attempt is sent
+        AuthRpcClientOptions(int32_t keepalive_time_ms, int32_t keepalive_timeout_ms, int32_t keepalive_permit_without_calls, std::string server_address, int32_t channel_count, int32_t connect_timeout_ms, int32_t deadline_ms, std::map<std::string, int32_t> method_deadlines_ms, int32_t retry_max_attempts, double retry_budget_ratio, int32_t retry_initial_backoff_ms, int32_t retry_max_backoff_ms, bool hedging_enabled, double hedging_percentile) noexcept;
 
         /// @brief Copy constructor deleted to prevent unintended resource duplication
         AuthRpcClientOptions(const AuthRpcClientOptions &) = delete;
@@ -92,6 +104,107 @@ namespace app_client::auth {
         /// in the format "host:port". IPv4, IPv6, and hostnames are supported.
         auto serverAddress(const std::string &value) noexcept -> void;
 
+        /// @brief Get the number of channels
+        /// @return The number of channels calls are spread over
+        /// @details Each channel opens its own HTTP/2 connection to the server, and the client sends
+        /// calls to them in round-robin order. One connection limits the number of concurrent streams
+        /// and serializes framing on one socket, which caps the throughput of a busy client.
+        [[nodiscard]] auto channelCount() const noexcept -> int32_t;
+
+        /// @brief Set the number of channels
+        /// @param value The number of channels calls are spread over
+        /// @details Each channel opens its own HTTP/2 connection to the server, and the client sends
+        /// calls to them in round-robin order.
+        auto channelCount(int32_t value) noexcept -> void;
+
+        /// @brief Get the connection timeout in milliseconds
+        /// @return The time to wait for each channel to connect at startup in milliseconds
+        [[nodiscard]] auto connectTimeoutMs() const noexcept -> int32_t;
+
+        /// @brief Set the connection timeout in milliseconds
+        /// @param value The time to wait for each channel to connect at startup in milliseconds
+        auto connectTimeoutMs(int32_t value) noexcept -> void;
+
+        /// @brief Get the default call deadline in milliseconds
+        /// @return The deadline of calls without a method-specific deadline in milliseconds, 0 for none
+        /// @details The deadline covers every attempt of a call, including retries, backoff and hedged
+        /// attempts, and is sent to the server, which stops working on calls whose deadline passed.
+        [[nodiscard]] auto deadlineMs() const noexcept -> int32_t;
+
+        /// @brief Set the default call deadline in milliseconds
+        /// @param value The deadline of calls without a method-specific deadline in milliseconds, 0 for none
+        auto deadlineMs(int32_t value) noexcept -> void;
+
+        /// @brief Get the method-specific call deadlines
+        /// @return Deadlines in milliseconds keyed by method name
+        /// @details Methods without an entry use deadlineMs. Batch methods typically need a longer
+        /// deadline than single-user calls.
+        [[nodiscard]] auto methodDeadlinesMs() const noexcept -> const std::map<std::string, int32_t> &;
+
+        /// @brief Set the method-specific call deadlines
+        /// @param value Deadlines in milliseconds keyed by method name
+        auto methodDeadlinesMs(const std::map<std::string, int32_t> &value) noexcept -> void;
+
+        /// @brief Get the maximum number of attempts of an idempotent call
+        /// @return The maximum number of attempts, including the first
+        /// @details Only UserExists and AuthenticateUser are retried, and only when the server was
+        /// unavailable or shed the call. Retries also draw from the retry budget.
+        [[nodiscard]] auto retryMaxAttempts() const noexcept -> int32_t;
+
+        /// @brief Set the maximum number of attempts of an idempotent call
+        /// @param value The maximum number of attempts, including the first; 1 disables retries
+        auto retryMaxAttempts(int32_t value) noexcept -> void;
+
+        /// @brief Get the retry budget ratio
+        /// @return The number of retries allowed per call sent
+        /// @details Caps retries at this fraction of the calls sent, so a failing server sees at most
+        /// that much extra load instead of retryMaxAttempts times its normal load.
+        [[nodiscard]] auto retryBudgetRatio() const noexcept -> double;
+
+        /// @brief Set the retry budget ratio
+        /// @param value The number of retries allowed per call sent
+        auto retryBudgetRatio(double value) noexcept -> void;
+
+        /// @brief Get the initial retry backoff in milliseconds
+        /// @return The backoff cap before the first retry in milliseconds
+        /// @details Each retry waits a random time between 0 and the cap, which doubles with every
+        /// retry up to retryMaxBackoffMs, so clients that failed together do not retry together.
+        [[nodiscard]] auto retryInitialBackoffMs() const noexcept -> int32_t;
+
+        /// @brief Set the initial retry backoff in milliseconds
+        /// @param value The backoff cap before the first retry in milliseconds
+        auto retryInitialBackoffMs(int32_t value) noexcept -> void;
+
+        /// @brief Get the maximum retry backoff in milliseconds
+        /// @return The largest backoff cap in milliseconds
+        [[nodiscard]] auto retryMaxBackoffMs() const noexcept -> int32_t;
+
+        /// @brief Set the maximum retry backoff in milliseconds
+        /// @param value The largest backoff cap in milliseconds
+        auto retryMaxBackoffMs(int32_t value) noexcept -> void;
+
+        /// @brief Check if hedging is enabled
+        /// @return True if slow read-only calls are hedged on another channel
+        /// @details When an attempt of UserExists or AuthenticateUser has not answered after the
+        /// hedgingPercentile latency of its method, a second attempt is sent on another channel and the
+        /// first response wins. This trims the tail caused by one slow connection or server thread at
+        /// the cost of a few percent extra calls.
+        [[nodiscard]] auto hedgingEnabled() const noexcept -> bool;
+
+        /// @brief Set whether hedging is enabled
+        /// @param value True to hedge slow read-only calls on another channel
+        auto hedgingEnabled(bool value) noexcept -> void;
+
+        /// @brief Get the hedging percentile
+        /// @return The latency percentile of a method after which a hedged attempt is sent
+        /// @details The percentile is taken from the latencies this client observed for the method, so
+        /// about 100 - percentile percent of calls are hedged.
+        [[nodiscard]] auto hedgingPercentile() const noexcept -> double;
+
+        /// @brief Set the hedging percentile
+        /// @param value The latency percentile of a method after which a hedged attempt is sent
+        auto hedgingPercentile(double value) noexcept -> void;
+
         /// @brief Deserialize gRPC options from a YAML file
         /// @param path Path to the YAML file containing the configuration
         /// @return true if successful, false otherwise
@@ -104,6 +217,17 @@ namespace app_client::auth {
         ///   keepalive-timeout-ms: 5000
         ///   keepalive-permit-without-calls: 1
         ///   server-address: "localhost:50051"
+        ///   channel-count: 4
+        ///   hedging-percentile: 95.0
+        ///   hedging-enabled: false
+        ///   retry-max-backoff-ms: 1000
+        ///   retry-initial-backoff-ms: 25
+        ///   retry-budget-ratio: 0.1
+        ///   retry-max-attempts: 3
+        ///   method-deadlines-ms:
+        ///     BatchRegisterUsers: 30000
+        ///   deadline-ms: 5000
+        ///   connect-timeout-ms: 5000
         /// @endcode
         auto deserializedFromYamlFile(const std::filesystem::path &path) -> void override;
 
@@ -132,6 +256,56 @@ namespace app_client::auth {
             /// @return Reference to this builder for method chaining
             [[nodiscard]] auto serverAddress(const std::string &value) noexcept -> Builder &;
 
+            /// @brief Set the number of channels
+            /// @param value The number of channels calls are spread over
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto channelCount(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the connection timeout in milliseconds
+            /// @param value The time to wait for each channel to connect at startup in milliseconds
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto connectTimeoutMs(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the default call deadline in milliseconds
+            /// @param value The deadline of calls without a method-specific deadline in milliseconds, 0 for none
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto deadlineMs(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the method-specific call deadlines
+            /// @param value Deadlines in milliseconds keyed by method name
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto methodDeadlinesMs(const std::map<std::string, int32_t> &value) noexcept -> Builder &;
+
+            /// @brief Set the maximum number of attempts of an idempotent call
+            /// @param value The maximum number of attempts, including the first
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto retryMaxAttempts(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the retry budget ratio
+            /// @param value The number of retries allowed per call sent
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto retryBudgetRatio(double value) noexcept -> Builder &;
+
+            /// @brief Set the initial retry backoff in milliseconds
+            /// @param value The backoff cap before the first retry in milliseconds
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto retryInitialBackoffMs(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the maximum retry backoff in milliseconds
+            /// @param value The largest backoff cap in milliseconds
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto retryMaxBackoffMs(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set whether hedging is enabled
+            /// @param value True to hedge slow read-only calls on another channel
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto hedgingEnabled(bool value) noexcept -> Builder &;
+
+            /// @brief Set the hedging percentile
+            /// @param value The latency percentile of a method after which a hedged attempt is sent
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto hedgingPercentile(double value) noexcept -> Builder &;
+
             /// @brief Build the AuthRpcClientOptions instance with the configured parameters
             /// @return A new AuthRpcClientOptions instance with the configured values
             [[nodiscard]] auto build() const -> AuthRpcClientOptions;
@@ -159,6 +333,47 @@ namespace app_client::auth {
             /// @details This parameter specifies the address and port of the gRPC server
             /// Default value is localhost:50051
             std::string server_address_{"localhost:50051"};
+
+            /// @brief Number of channels calls are spread over
+            /// @details Each channel opens its own HTTP/2 connection to the server.
+            /// Default value is 4.
+            int32_t channel_count_{4};
+
+            /// @brief Time to wait for each channel to connect at startup (in milliseconds)
+            /// @details Default value is 5 seconds (5000 ms).
+            int32_t connect_timeout_ms_{5 * 1000};
+
+            /// @brief Deadline of calls without a method-specific deadline (in milliseconds, 0 for none)
+            /// @details Default value is 5 seconds (5000 ms).
+            int32_t deadline_ms_{5 * 1000};
+
+            /// @brief Deadlines keyed by method name, overriding the default deadline (in milliseconds)
+            /// @details Default value is empty.
+            std::map<std::string, int32_t> method_deadlines_ms_{};
+
+            /// @brief Maximum number of attempts of an idempotent call
+            /// @details Default value is 3.
+            int32_t retry_max_attempts_{3};
+
+            /// @brief Retries allowed per call sent
+            /// @details Default value is 0.1 (one retry per ten calls).
+            double retry_budget_ratio_{0.1};
+
+            /// @brief Backoff cap before the first retry (in milliseconds)
+            /// @details Default value is 25 ms.
+            int32_t retry_initial_backoff_ms_{25};
+
+            /// @brief Largest backoff cap (in milliseconds)
+            /// @details Default value is 1 second (1000 ms).
+            int32_t retry_max_backoff_ms_{1000};
+
+            /// @brief Whether slow read-only calls are hedged on another channel
+            /// @details Default value is false.
+            bool hedging_enabled_{false};
+
+            /// @brief Latency percentile of a method after which a hedged attempt is sent
+            /// @details Default value is 95.0.
+            double hedging_percentile_{95.0};
         };
 
         /// @brief Create a new Builder instance for constructing AuthRpcClientOptions
@@ -193,6 +408,47 @@ namespace app_client::auth {
         /// @details This parameter specifies the address and port of the gRPC server
         /// Default value is localhost:50051
         std::string server_address_{"localhost:50051"};
+
+        /// @brief Number of channels calls are spread over
+        /// @details Each channel opens its own HTTP/2 connection to the server.
+        /// Default value is 4.
+        int32_t channel_count_{4};
+
+        /// @brief Time to wait for each channel to connect at startup (in milliseconds)
+        /// @details Default value is 5 seconds (5000 ms).
+        int32_t connect_timeout_ms_{5 * 1000};
+
+        /// @brief Deadline of calls without a method-specific deadline (in milliseconds, 0 for none)
+        /// @details Default value is 5 seconds (5000 ms).
+        int32_t deadline_ms_{5 * 1000};
+
+        /// @brief Deadlines keyed by method name, overriding the default deadline (in milliseconds)
+        /// @details Default value is empty.
+        std::map<std::string, int32_t> method_deadlines_ms_{};
+
+        /// @brief Maximum number of attempts of an idempotent call
+        /// @details Default value is 3.
+        int32_t retry_max_attempts_{3};
+
+        /// @brief Retries allowed per call sent
+        /// @details Default value is 0.1 (one retry per ten calls).
+        double retry_budget_ratio_{0.1};
+
+        /// @brief Backoff cap before the first retry (in milliseconds)
+        /// @details Default value is 25 ms.
+        int32_t retry_initial_backoff_ms_{25};
+
+        /// @brief Largest backoff cap (in milliseconds)
+        /// @details Default value is 1 second (1000 ms).
+        int32_t retry_max_backoff_ms_{1000};
+
+        /// @brief Whether slow read-only calls are hedged on another channel
+        /// @details Default value is false.
+        bool hedging_enabled_{false};
+
+        /// @brief Latency percentile of a method after which a hedged attempt is sent
+        /// @details Default value is 95.0.
+        double hedging_percentile_{95.0};
     };
 }
 
@@ -0,0 +1,25 @@
+#include "RetryBudget.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace client_app::auth {
+    RetryBudget::RetryBudget(const double ratio, const uint32_t max_tokens) noexcept : deposit_(static_cast<int64_t>(std::lround(std::max(ratio, 0.0) * TOKEN_SCALE))), max_balance_(static_cast<int64_t>(max_tokens) * TOKEN_SCALE), balance_(max_balance_) {
+    }
+
+    auto RetryBudget::deposit() noexcept -> void {
+        auto balance = balance_.load(std::memory_order_relaxed);
+        while (balance < max_balance_ && !balance_.compare_exchange_weak(balance, std::min(balance + deposit_, max_balance_), std::memory_order_relaxed)) {
+        }
+    }
+
+    auto RetryBudget::tryWithdraw() noexcept -> bool {
+        auto balance = balance_.load(std::memory_order_relaxed);
+        while (balance >= TOKEN_SCALE) {
+            if (balance_.compare_exchange_weak(balance, balance - TOKEN_SCALE, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+namespace client_app::auth {
+    /// @brief Token bucket limiting retries to a fraction of the calls sent
+    /// @details Every call deposits ratio tokens and every retry or hedged attempt withdraws one,
+    /// so over time at most ratio extra attempts are sent per call no matter how many a single call
+    /// would allow. When the server is overloaded and most calls fail, the bucket drains and
+    /// retries stop instead of multiplying the load. The bucket starts full with max_tokens so a
+    /// quiet client can still retry its first failures. Tokens are kept in thousandths in one
+    /// atomic, so neither operation locks.
+    class RetryBudget {
+    public:
+        /// @brief Construct a full budget
+        /// @param ratio Retries allowed per call, e.g. 0.1 for one retry per ten calls
+        /// @param max_tokens Largest number of retries that can be saved up
+        RetryBudget(double ratio, uint32_t max_tokens) noexcept;
+
+        /// @brief Copy constructor (deleted)
+        RetryBudget(const RetryBudget &) = delete;
+
+        /// @brief Copy assignment operator (deleted)
+        auto operator=(const RetryBudget &) -> RetryBudget & = delete;
+
+        /// @brief Credit the budget for a call about to be sent
+        auto deposit() noexcept -> void;
+
+        /// @brief Take one retry from the budget
+        /// @return True if the retry may be sent, false if the budget is exhausted
+        [[nodiscard]] auto tryWithdraw() noexcept -> bool;
+
+    private:
+        /// @brief Tokens per retry, the budget's fixed-point scale
+        static constexpr int64_t TOKEN_SCALE = 1000;
+
+        int64_t deposit_;
+        int64_t max_balance_;
+        std::atomic<int64_t> balance_;
+    };
+}
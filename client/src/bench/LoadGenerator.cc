@@ -0,0 +1,238 @@
+#include "LoadGenerator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <fmt/format.h>
+#include <glog/logging.h>
+
+namespace app_client::bench {
+    /// @brief Method names as used in the operation mix, indexed by BenchOperation
+    static constexpr std::array<std::string_view, BENCH_OPERATION_COUNT> OPERATION_NAMES{"RegisterUser", "AuthenticateUser", "ChangePassword", "ResetPassword", "DeleteUser", "UserExists"};
+
+    /// @brief Format the percentiles reported for a latency distribution
+    /// @param snapshot Latency distribution
+    /// @return Percentiles in milliseconds
+    static auto formatPercentiles(const common::time::LatencyHistogram::Snapshot &snapshot) -> std::string {
+        const auto ms = [](const std::chrono::microseconds value) { return static_cast<double>(value.count()) / 1000.0; };
+        return fmt::format("p50: {:.3f}ms, p90: {:.3f}ms, p99: {:.3f}ms, p99.9: {:.3f}ms, max: {:.3f}ms", ms(snapshot.valueAtPercentile(50.0)), ms(snapshot.valueAtPercentile(90.0)), ms(snapshot.valueAtPercentile(99.0)), ms(snapshot.valueAtPercentile(99.9)), ms(snapshot.max()));
+    }
+
+    UsernameSampler::UsernameSampler(const size_t user_count, const double zipf_exponent) : user_count_(std::max<size_t>(user_count, 1)) {
+        if (zipf_exponent <= 0.0) {
+            return;
+        }
+
+        cdf_.resize(user_count_);
+        double sum = 0.0;
+        for (size_t k = 0; k < user_count_; ++k) {
+            sum += 1.0 / std::pow(static_cast<double>(k + 1), zipf_exponent);
+            cdf_[k] = sum;
+        }
+        for (auto &probability: cdf_) {
+            probability /= sum;
+        }
+    }
+
+    auto UsernameSampler::operator()(std::mt19937_64 &rng) const -> size_t {
+        if (cdf_.empty()) {
+            return std::uniform_int_distribution<size_t>{0, user_count_ - 1}(rng);
+        }
+        const auto it = std::ranges::upper_bound(cdf_, std::uniform_real_distribution{0.0, 1.0}(rng));
+        return std::min(static_cast<size_t>(it - cdf_.begin()), user_count_ - 1);
+    }
+
+    LoadGenerator::LoadGenerator(const client_app::auth::AuthRpcClient &client, const LoadGeneratorOptions &options) : client_(client), open_loop_(options.mode() == "open"), target_rps_(options.targetRps()), concurrency_(static_cast<size_t>(std::max(options.concurrency(), 1))), duration_(options.durationSec()), user_count_(static_cast<size_t>(std::max(options.userCount(), 1))), sampler_(user_count_, options.usernameDistribution() == "zipf" ? options.zipfExponent() : 0.0) {
+        if (options.mode() != "open" && options.mode() != "closed") {
+            throw std::invalid_argument(fmt::format("Unknown benchmark mode: {}", options.mode()));
+        }
+        if (options.usernameDistribution() != "uniform" && options.usernameDistribution() != "zipf") {
+            throw std::invalid_argument(fmt::format("Unknown username distribution: {}", options.usernameDistribution()));
+        }
+        if ((open_loop_ && target_rps_ <= 0) || options.concurrency() <= 0 || options.durationSec() <= 0 || options.userCount() <= 0) {
+            throw std::invalid_argument("Benchmark rate, concurrency, duration and user count must be positive");
+        }
+
+        uint32_t total_weight = 0;
+        for (const auto &[operation, weight]: options.operationMix()) {
+            const auto it = std::ranges::find(OPERATION_NAMES, operation);
+            if (it == OPERATION_NAMES.end()) {
+                throw std::invalid_argument(fmt::format("Unknown operation in benchmark mix: {}", operation));
+            }
+            mix_cdf_[static_cast<size_t>(it - OPERATION_NAMES.begin())] = static_cast<uint32_t>(std::max(weight, 0));
+        }
+        for (auto &weight: mix_cdf_) {
+            total_weight += weight;
+            weight = total_weight;
+        }
+        if (total_weight == 0) {
+            throw std::invalid_argument("Benchmark operation mix has no positive weight");
+        }
+
+        if (open_loop_) {
+            interval_ = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::seconds{1}) / target_rps_;
+        }
+    }
+
+    auto LoadGenerator::run() -> void {
+        prepareUsers();
+
+        LOG(INFO) << fmt::format("Benchmark started - Mode: {} loop, Target Rate: {} calls/s, Concurrency: {}, Duration: {}s, Users: {}", open_loop_ ? "open" : "closed", target_rps_, concurrency_, duration_.count(), user_count_);
+        start_ = std::chrono::steady_clock::now();
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(concurrency_);
+            for (size_t i = 0; i < concurrency_; ++i) {
+                workers.emplace_back([this, i] { worker(i); });
+            }
+        }
+        logReport(std::chrono::steady_clock::now() - start_);
+    }
+
+    auto LoadGenerator::isLocalAddress(std::string_view server_address) noexcept -> bool {
+        if (server_address.starts_with("unix:")) {
+            return true;
+        }
+        for (const std::string_view scheme: {"dns:///", "ipv4:", "ipv6:"}) {
+            if (server_address.starts_with(scheme)) {
+                server_address.remove_prefix(scheme.size());
+            }
+        }
+
+        // Strip the port, keeping bracketed IPv6 hosts intact
+        std::string_view host = server_address;
+        if (host.starts_with('[')) {
+            host = host.substr(1, host.find(']') - 1);
+        } else if (const auto colon = host.rfind(':'); colon != std::string_view::npos && host.find(':') == colon) {
+            host = host.substr(0, colon);
+        }
+        return host == "localhost" || host == "::1" || host.starts_with("127.");
+    }
+
+    auto LoadGenerator::prepareUsers() const -> void {
+        LOG(INFO) << fmt::format("Registering {} benchmark users", user_count_);
+        const size_t batch_count = (user_count_ + REGISTER_BATCH_SIZE - 1) / REGISTER_BATCH_SIZE;
+        std::atomic<size_t> next_batch{0};
+        std::atomic<size_t> registered{0};
+        std::mutex failure_mutex;
+        std::string failure;
+        {
+            std::vector<std::jthread> registrars;
+            registrars.reserve(std::min(REGISTER_CONCURRENCY, batch_count));
+            for (size_t i = 0; i < std::min(REGISTER_CONCURRENCY, batch_count); ++i) {
+                registrars.emplace_back([&] {
+                    std::vector<std::pair<std::string, std::string> > batch;
+                    batch.reserve(REGISTER_BATCH_SIZE);
+                    for (auto index = next_batch.fetch_add(1); index < batch_count; index = next_batch.fetch_add(1)) {
+                        batch.clear();
+                        const auto first = index * REGISTER_BATCH_SIZE;
+                        for (size_t user = first; user < std::min(first + REGISTER_BATCH_SIZE, user_count_); ++user) {
+                            batch.emplace_back(username(user), BENCH_PASSWORD);
+                        }
+
+                        // Users left over from an earlier run are rejected as duplicates and kept as they are
+                        const auto response = client_.BatchRegisterUsers(batch);
+                        if (!response.success()) {
+                            const std::lock_guard lock{failure_mutex};
+                            failure = fmt::format("{} Error code: {}", response.message(), response.error_code());
+                            next_batch.store(batch_count);
+                            return;
+                        }
+                        registered.fetch_add(static_cast<size_t>(std::ranges::count_if(response.results(), [](const auto &result) { return result.success(); })));
+                    }
+                });
+            }
+        }
+        if (!failure.empty()) {
+            throw std::runtime_error(fmt::format("Failed to register benchmark users: {}", failure));
+        }
+        LOG(INFO) << fmt::format("Benchmark users ready - Newly registered: {}, Already present: {}", registered.load(), user_count_ - registered.load());
+    }
+
+    auto LoadGenerator::worker(const size_t worker_index) -> void {
+        std::mt19937_64 rng{std::random_device{}() ^ (static_cast<uint64_t>(worker_index) << 32)};
+        const auto end = start_ + duration_;
+
+        while (true) {
+            const auto operation = nextOperation(rng);
+            const auto user = username(sampler_(rng));
+
+            // Open loop calls are timed from their slot on the schedule, not from when they were sent
+            auto intended_start = std::chrono::steady_clock::now();
+            if (open_loop_) {
+                intended_start = start_ + interval_ * static_cast<int64_t>(next_call_.fetch_add(1, std::memory_order_relaxed));
+                if (intended_start >= end) {
+                    break;
+                }
+                std::this_thread::sleep_until(intended_start);
+            } else if (intended_start >= end) {
+                break;
+            }
+
+            const bool succeeded = execute(operation, user);
+            const auto latency = std::chrono::steady_clock::now() - intended_start;
+            latencies_[static_cast<size_t>(operation)].record(latency);
+            total_latency_.record(latency);
+            if (!succeeded) {
+                failures_[static_cast<size_t>(operation)].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    auto LoadGenerator::nextOperation(std::mt19937_64 &rng) const -> BenchOperation {
+        const auto pick = std::uniform_int_distribution<uint32_t>{0, mix_cdf_.back() - 1}(rng);
+        return static_cast<BenchOperation>(std::ranges::upper_bound(mix_cdf_, pick) - mix_cdf_.begin());
+    }
+
+    auto LoadGenerator::execute(const BenchOperation operation, const std::string &username) const -> bool {
+        const std::string password{BENCH_PASSWORD};
+        switch (operation) {
+            case BenchOperation::RegisterUser:
+                return client_.RegisterUser(username, password).success();
+            case BenchOperation::AuthenticateUser:
+                return client_.AuthenticateUser(username, password).success();
+            case BenchOperation::ChangePassword:
+                // Changing to the same password keeps every user's password known to the generator
+                return client_.ChangePassword(username, password, password).success();
+            case BenchOperation::ResetPassword:
+                return client_.ResetPassword(username, password).success();
+            case BenchOperation::DeleteUser:
+                return client_.DeleteUser(username).success();
+            case BenchOperation::UserExists:
+                return client_.UserExists(username).success();
+        }
+        return false;
+    }
+
+    auto LoadGenerator::logReport(const std::chrono::steady_clock::duration elapsed) const -> void {
+        // Closed loop workers stop sending while a call stalls; correct against the rate they should sustain
+        const auto expected_interval = !open_loop_ && target_rps_ > 0 ? std::chrono::microseconds{static_cast<int64_t>(concurrency_) * 1000000 / target_rps_} : std::chrono::microseconds{0};
+        const auto elapsed_sec = std::chrono::duration<double>(elapsed).count();
+
+        const auto total = total_latency_.snapshot();
+        uint64_t failures = 0;
+        for (const auto &counter: failures_) {
+            failures += counter.load(std::memory_order_relaxed);
+        }
+        LOG(INFO) << fmt::format("Benchmark finished - Mode: {} loop, Elapsed: {:.1f}s, Calls: {}, Throughput: {:.1f} calls/s, Unsuccessful: {}", open_loop_ ? "open" : "closed", elapsed_sec, total.count(), static_cast<double>(total.count()) / elapsed_sec, failures);
+        if (!open_loop_) {
+            LOG(INFO) << fmt::format("All methods (uncorrected) - {}", formatPercentiles(total));
+        }
+        LOG(INFO) << fmt::format("All methods - {}", formatPercentiles(total.correctedForCoordinatedOmission(expected_interval)));
+
+        for (size_t i = 0; i < BENCH_OPERATION_COUNT; ++i) {
+            const auto snapshot = latencies_[i].snapshot();
+            if (snapshot.count() == 0) {
+                continue;
+            }
+            LOG(INFO) << fmt::format("{} - Calls: {}, Unsuccessful: {}, {}", OPERATION_NAMES[i], snapshot.count(), failures_[i].load(std::memory_order_relaxed), formatPercentiles(snapshot.correctedForCoordinatedOmission(expected_interval)));
+        }
+    }
+
+    auto LoadGenerator::username(const size_t index) -> std::string {
+        return fmt::format("bench_{:07}", index);
+    }
+}
@@ -0,0 +1,137 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "LoadGeneratorOptions.hpp"
+#include "src/auth/AuthRpcClient.hpp"
+#include "src/time/LatencyHistogram.hpp"
+
+namespace app_client::bench {
+    /// @brief AuthService methods the load generator calls
+    enum class BenchOperation : uint8_t {
+        RegisterUser,
+        AuthenticateUser,
+        ChangePassword,
+        ResetPassword,
+        DeleteUser,
+        UserExists,
+    };
+
+    /// @brief Number of BenchOperation values, for tables indexed by the enum
+    inline constexpr size_t BENCH_OPERATION_COUNT = static_cast<size_t>(BenchOperation::UserExists) + 1;
+
+    /// @brief Draws benchmark user indices from a uniform or Zipf distribution
+    /// @details The Zipf distribution is sampled by binary search over its precomputed cumulative
+    /// distribution, which costs 8 bytes per user and O(log n) per draw.
+    class UsernameSampler {
+    public:
+        /// @brief Construct a sampler over user_count users
+        /// @param user_count Number of users, at least 1
+        /// @param zipf_exponent Skew of the Zipf distribution, 0 for a uniform distribution
+        UsernameSampler(size_t user_count, double zipf_exponent);
+
+        /// @brief Draw one user
+        /// @param rng Random number generator of the calling thread
+        /// @return User index in [0, user_count), 0 being the most popular under Zipf
+        [[nodiscard]] auto operator()(std::mt19937_64 &rng) const -> size_t;
+
+    private:
+        size_t user_count_;
+        std::vector<double> cdf_; ///< Cumulative probability of each user, empty for a uniform distribution
+    };
+
+    /// @brief Non-interactive load generator for the AuthService
+    /// @details Registers the benchmark users, then drives the server with the configured operation
+    /// mix for the configured duration and logs throughput and latency percentiles per method.
+    ///
+    /// In open loop mode every call has a scheduled start time on a fixed-rate timeline and its
+    /// latency is measured from that time rather than from when a worker got around to sending it,
+    /// so calls held back by a slow server are charged the wait (the coordinated-omission correction
+    /// of wrk2). In closed loop mode latencies are measured per call and the percentiles are corrected
+    /// afterwards against the interval implied by targetRps, as HdrHistogram does.
+    class LoadGenerator {
+    public:
+        /// @brief Construct a load generator
+        /// @param client RPC client connected to the server under test
+        /// @param options Benchmark settings
+        /// @throws std::invalid_argument If the settings cannot be run
+        LoadGenerator(const client_app::auth::AuthRpcClient &client, const LoadGeneratorOptions &options);
+
+        /// @brief Copy constructor (deleted)
+        LoadGenerator(const LoadGenerator &) = delete;
+
+        /// @brief Copy assignment operator (deleted)
+        auto operator=(const LoadGenerator &) -> LoadGenerator & = delete;
+
+        /// @brief Register the benchmark users, run the load and log the report
+        auto run() -> void;
+
+        /// @brief Check whether an address points at the local machine
+        /// @param server_address Address in "host:port" form
+        /// @return True for localhost, 127.0.0.0/8 and ::1
+        [[nodiscard]] static auto isLocalAddress(std::string_view server_address) noexcept -> bool;
+
+    private:
+        /// @brief Password every benchmark user is registered with and keeps
+        static constexpr std::string_view BENCH_PASSWORD = "Bench-Passw0rd!";
+
+        /// @brief Users per BatchRegisterUsers call
+        /// @details The server derives the keys of one batch one after another, so a batch has to stay
+        /// small enough to finish within the call's deadline even at production key-derivation costs.
+        static constexpr size_t REGISTER_BATCH_SIZE = 16;
+
+        /// @brief Most BatchRegisterUsers calls in flight while preparing users
+        /// @details Every call occupies one key-derivation worker of the server, more would only queue up.
+        static constexpr size_t REGISTER_CONCURRENCY = 4;
+
+        /// @brief Register every benchmark user that does not exist yet
+        auto prepareUsers() const -> void;
+
+        /// @brief Issue calls until the run ends
+        /// @param worker_index Index of the worker, used to seed its random number generator
+        auto worker(size_t worker_index) -> void;
+
+        /// @brief Pick the next operation from the mix
+        /// @param rng Random number generator of the calling thread
+        /// @return Operation to call
+        [[nodiscard]] auto nextOperation(std::mt19937_64 &rng) const -> BenchOperation;
+
+        /// @brief Call one AuthService method
+        /// @param operation Method to call
+        /// @param username Benchmark user to call it for
+        /// @return True if the server reported success
+        [[nodiscard]] auto execute(BenchOperation operation, const std::string &username) const -> bool;
+
+        /// @brief Log throughput and latency percentiles of the finished run
+        /// @param elapsed Measured duration of the run
+        auto logReport(std::chrono::steady_clock::duration elapsed) const -> void;
+
+        /// @brief Build the name of a benchmark user
+        /// @param index User index
+        /// @return Username
+        [[nodiscard]] static auto username(size_t index) -> std::string;
+
+        const client_app::auth::AuthRpcClient &client_;
+        bool open_loop_;
+        int32_t target_rps_;
+        size_t concurrency_;
+        std::chrono::seconds duration_;
+        size_t user_count_;
+        UsernameSampler sampler_;
+        std::array<uint32_t, BENCH_OPERATION_COUNT> mix_cdf_{}; ///< Cumulative weights of the operation mix
+
+        std::chrono::steady_clock::time_point start_;
+        std::chrono::steady_clock::duration interval_{0}; ///< Time between scheduled starts in open loop mode
+        std::atomic<uint64_t> next_call_{0}; ///< Next slot of the open loop schedule
+        std::array<common::time::LatencyHistogram, BENCH_OPERATION_COUNT> latencies_;
+        std::array<std::atomic<uint64_t>, BENCH_OPERATION_COUNT> failures_{};
+        common::time::LatencyHistogram total_latency_;
+    };
+}
@@ -0,0 +1,258 @@
+#include "LoadGeneratorOptions.hpp"
+
+#include <glog/logging.h>
+#include <utility>
+
+namespace app_client::bench {
+    LoadGeneratorOptions::LoadGeneratorOptions(const bool enabled, std::string mode, const int32_t target_rps, const int32_t concurrency, const int32_t duration_sec, const int32_t user_count, std::string username_distribution, const double zipf_exponent, std::map<std::string, int32_t> operation_mix) noexcept : enabled_(enabled), mode_(std::move(mode)), target_rps_(target_rps), concurrency_(concurrency), duration_sec_(duration_sec), user_count_(user_count), username_distribution_(std::move(username_distribution)), zipf_exponent_(zipf_exponent), operation_mix_(std::move(operation_mix)) {
+        validate(); // Validate parameters after construction
+    }
+
+    auto LoadGeneratorOptions::Builder::enabled(const bool value) noexcept -> Builder & {
+        enabled_ = value;
+        return *this;
+    }
+
+    auto LoadGeneratorOptions::Builder::mode(const std::string &value) noexcept -> Builder & {
+        mode_ = value;
+        return *this;
+    }
+
+    auto LoadGeneratorOptions::Builder::targetRps(const int32_t value) noexcept -> Builder & {
+        target_rps_ = value;
+        return *this;
+    }
+
+    auto LoadGeneratorOptions::Builder::concurrency(const int32_t value) noexcept -> Builder & {
+        concurrency_ = value;
+        return *this;
+    }
+
+    auto LoadGeneratorOptions::Builder::durationSec(const int32_t value) noexcept -> Builder & {
+        duration_sec_ = value;
+        return *this;
+    }
+
+    auto LoadGeneratorOptions::Builder::userCount(const int32_t value) noexcept -> Builder & {
+        user_count_ = value;
+        return *this;
+    }
+
+    auto LoadGeneratorOptions::Builder::usernameDistribution(const std::string &value) noexcept -> Builder & {
+        username_distribution_ = value;
+        return *this;
+    }
+
+    auto LoadGeneratorOptions::Builder::zipfExponent(const double value) noexcept -> Builder & {
+        zipf_exponent_ = value;
+        return *this;
+    }
+
+    auto LoadGeneratorOptions::Builder::operationMix(const std::map<std::string, int32_t> &value) noexcept -> Builder & {
+        operation_mix_ = value;
+        return *this;
+    }
+
+    auto LoadGeneratorOptions::Builder::build() const -> LoadGeneratorOptions {
+        return LoadGeneratorOptions{enabled_, mode_, target_rps_, concurrency_, duration_sec_, user_count_, username_distribution_, zipf_exponent_, operation_mix_};
+    }
+
+    auto LoadGeneratorOptions::builder() -> Builder {
+        return {};
+    }
+
+    auto LoadGeneratorOptions::enabled() const noexcept -> bool {
+        return enabled_;
+    }
+
+    auto LoadGeneratorOptions::enabled(const bool value) noexcept -> void {
+        enabled_ = value;
+    }
+
+    auto LoadGeneratorOptions::mode() const noexcept -> const std::string & {
+        return mode_;
+    }
+
+    auto LoadGeneratorOptions::mode(const std::string &value) noexcept -> void {
+        mode_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto LoadGeneratorOptions::targetRps() const noexcept -> int32_t {
+        return target_rps_;
+    }
+
+    auto LoadGeneratorOptions::targetRps(const int32_t value) noexcept -> void {
+        target_rps_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto LoadGeneratorOptions::concurrency() const noexcept -> int32_t {
+        return concurrency_;
+    }
+
+    auto LoadGeneratorOptions::concurrency(const int32_t value) noexcept -> void {
+        concurrency_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto LoadGeneratorOptions::durationSec() const noexcept -> int32_t {
+        return duration_sec_;
+    }
+
+    auto LoadGeneratorOptions::durationSec(const int32_t value) noexcept -> void {
+        duration_sec_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto LoadGeneratorOptions::userCount() const noexcept -> int32_t {
+        return user_count_;
+    }
+
+    auto LoadGeneratorOptions::userCount(const int32_t value) noexcept -> void {
+        user_count_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto LoadGeneratorOptions::usernameDistribution() const noexcept -> const std::string & {
+        return username_distribution_;
+    }
+
+    auto LoadGeneratorOptions::usernameDistribution(const std::string &value) noexcept -> void {
+        username_distribution_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto LoadGeneratorOptions::zipfExponent() const noexcept -> double {
+        return zipf_exponent_;
+    }
+
+    auto LoadGeneratorOptions::zipfExponent(const double value) noexcept -> void {
+        zipf_exponent_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto LoadGeneratorOptions::operationMix() const noexcept -> const std::map<std::string, int32_t> & {
+        return operation_mix_;
+    }
+
+    auto LoadGeneratorOptions::operationMix(const std::map<std::string, int32_t> &value) noexcept -> void {
+        operation_mix_ = value;
+        validate(); // Validate after setting new value
+    }
+
+    auto LoadGeneratorOptions::deserializedFromYamlFile(const std::filesystem::path &path) -> void {
+        if (!std::filesystem::exists(path)) {
+            throw std::runtime_error("Configuration file does not exist: " + path.string());
+        }
+
+        try {
+            const YAML::Node root = common::filesystem::YamlToolkit::read(path.string());
+            const YAML::Node benchmarkNode = common::filesystem::YamlToolkit::getNodeOrRoot(root, "benchmark");
+
+            if (const auto enabledNode = benchmarkNode["enabled"]; enabledNode) {
+                enabled_ = enabledNode.as<bool>();
+            }
+            if (const auto modeNode = benchmarkNode["mode"]; modeNode) {
+                mode_ = modeNode.as<std::string>();
+            }
+            if (const auto targetRpsNode = benchmarkNode["targetRps"]; targetRpsNode) {
+                target_rps_ = targetRpsNode.as<int32_t>();
+            }
+            if (const auto concurrencyNode = benchmarkNode["concurrency"]; concurrencyNode) {
+                concurrency_ = concurrencyNode.as<int32_t>();
+            }
+            if (const auto durationSecNode = benchmarkNode["durationSec"]; durationSecNode) {
+                duration_sec_ = durationSecNode.as<int32_t>();
+            }
+            if (const auto userCountNode = benchmarkNode["userCount"]; userCountNode) {
+                user_count_ = userCountNode.as<int32_t>();
+            }
+            if (const auto usernameDistributionNode = benchmarkNode["usernameDistribution"]; usernameDistributionNode) {
+                username_distribution_ = usernameDistributionNode.as<std::string>();
+            }
+            if (const auto zipfExponentNode = benchmarkNode["zipfExponent"]; zipfExponentNode) {
+                zipf_exponent_ = zipfExponentNode.as<double>();
+            }
+            if (const auto operationMixNode = benchmarkNode["operationMix"]; operationMixNode) {
+                operation_mix_ = operationMixNode.as<std::map<std::string, int32_t> >();
+            }
+        } catch (const YAML::Exception &e) {
+            throw std::runtime_error("Failed to parse YAML file '" + path.string() + "': " + e.what());
+        } catch (const std::exception &e) {
+            throw std::runtime_error("Error processing configuration file '" + path.string() + "': " + e.what());
+        }
+
+        validate(); // Validate after loading from YAML
+    }
+
+    auto LoadGeneratorOptions::validate() const noexcept -> void {
+        // Validate the load model and username distribution
+        LOG_IF(WARNING, mode_ != "open" && mode_ != "closed") << "Invalid benchmark mode: " << mode_ << ". Valid values are open or closed.";
+        LOG_IF(WARNING, username_distribution_ != "uniform" && username_distribution_ != "zipf") << "Invalid username distribution: " << username_distribution_ << ". Valid values are uniform or zipf.";
+
+        // Validate sizes (should be positive)
+        LOG_IF(WARNING, mode_ == "open" && target_rps_ <= 0) << "Invalid target rate: " << target_rps_ << " calls/s. Open loop mode needs a positive rate.";
+        LOG_IF(WARNING, target_rps_ < 0) << "Invalid target rate: " << target_rps_ << " calls/s. Use 0 to disable coordinated omission correction in closed loop mode.";
+        LOG_IF(WARNING, concurrency_ <= 0) << "Invalid concurrency: " << concurrency_ << ". At least one worker is required.";
+        LOG_IF(WARNING, duration_sec_ <= 0) << "Invalid benchmark duration: " << duration_sec_ << "s. The run needs a positive duration.";
+        LOG_IF(WARNING, user_count_ <= 0) << "Invalid user count: " << user_count_ << ". At least one benchmark user is required.";
+        LOG_IF(WARNING, username_distribution_ == "zipf" && zipf_exponent_ <= 0.0) << "Invalid Zipf exponent: " << zipf_exponent_ << ". The exponent must be positive.";
+
+        // Validate the operation mix
+        int64_t total_weight = 0;
+        for (const auto &[operation, weight]: operation_mix_) {
+            LOG_IF(WARNING, weight < 0) << "Invalid weight for " << operation << ": " << weight << ". Weights must not be negative.";
+            total_weight += weight;
+        }
+        LOG_IF(WARNING, total_weight <= 0) << "Operation mix has no positive weight. At least one method must be called.";
+
+        // Check for potentially problematic combinations
+        LOG_IF(WARNING, mode_ == "open" && concurrency_ > 0 && target_rps_ > 0 && concurrency_ < target_rps_ / 1000) << "Concurrency (" << concurrency_ << ") is low for " << target_rps_ << " calls/s. Calls slower than " << 1000 * concurrency_ / target_rps_ << "ms will delay the schedule.";
+    }
+}
+
+auto YAML::convert<app_client::bench::LoadGeneratorOptions>::decode(const YAML::Node &node, app_client::bench::LoadGeneratorOptions &rhs) -> bool {
+    if (const auto enabledNode = node["enabled"]; enabledNode) {
+        rhs.enabled(enabledNode.as<bool>());
+    }
+    if (const auto modeNode = node["mode"]; modeNode) {
+        rhs.mode(modeNode.as<std::string>());
+    }
+    if (const auto targetRpsNode = node["targetRps"]; targetRpsNode) {
+        rhs.targetRps(targetRpsNode.as<int32_t>());
+    }
+    if (const auto concurrencyNode = node["concurrency"]; concurrencyNode) {
+        rhs.concurrency(concurrencyNode.as<int32_t>());
+    }
+    if (const auto durationSecNode = node["durationSec"]; durationSecNode) {
+        rhs.durationSec(durationSecNode.as<int32_t>());
+    }
+    if (const auto userCountNode = node["userCount"]; userCountNode) {
+        rhs.userCount(userCountNode.as<int32_t>());
+    }
+    if (const auto usernameDistributionNode = node["usernameDistribution"]; usernameDistributionNode) {
+        rhs.usernameDistribution(usernameDistributionNode.as<std::string>());
+    }
+    if (const auto zipfExponentNode = node["zipfExponent"]; zipfExponentNode) {
+        rhs.zipfExponent(zipfExponentNode.as<double>());
+    }
+    if (const auto operationMixNode = node["operationMix"]; operationMixNode) {
+        rhs.operationMix(operationMixNode.as<std::map<std::string, int32_t> >());
+    }
+    return true;
+}
+
+auto YAML::convert<app_client::bench::LoadGeneratorOptions>::encode(const app_client::bench::LoadGeneratorOptions &rhs) -> YAML::Node {
+    YAML::Node node;
+    node["enabled"] = rhs.enabled();
+    node["mode"] = rhs.mode();
+    node["targetRps"] = rhs.targetRps();
+    node["concurrency"] = rhs.concurrency();
+    node["durationSec"] = rhs.durationSec();
+    node["userCount"] = rhs.userCount();
+    node["usernameDistribution"] = rhs.usernameDistribution();
+    node["zipfExponent"] = rhs.zipfExponent();
+    node["operationMix"] = rhs.operationMix();
+    return node;
+}
@@ -0,0 +1,292 @@
+#pragma once
+#include <yaml-cpp/node/node.h>
+#include <filesystem>
+#include <map>
+#include <string>
+
+#include "src/serializer/interface/IYamlConfigurable.hpp"
+#include "src/filesystem/type/YamlToolkit.hpp"
+
+namespace app_client::bench {
+    /// @brief A class that holds the settings of the client benchmark mode
+    /// @details When enabled, the client skips the interactive login and drives the AuthService
+    /// with generated load instead. The load is either open loop, where calls are started on a fixed
+    /// schedule of targetRps calls per second regardless of how fast the server answers, or closed
+    /// loop, where each of concurrency workers starts its next call as soon as the previous one
+    /// finished. The configuration parameters can be loaded from the benchmark section of a YAML
+    /// configuration file.
+    ///
+    /// Example usage:
+    /// @code
+    /// auto options = LoadGeneratorOptions::builder()
+    ///     .enabled(true)
+    ///     .mode("open")
+    ///     .targetRps(500)
+    ///     .concurrency(64)
+    ///     .durationSec(60)
+    ///     .userCount(10000)
+    ///     .usernameDistribution("zipf")
+    ///     .zipfExponent(0.99)
+    ///     .operationMix({{"AuthenticateUser", 90}, {"UserExists", 10}})
+    ///     .build();
+    /// @endcode
+    class LoadGeneratorOptions final : public common::interfaces::IYamlConfigurable {
+    public:
+        /// @brief Default constructor explicitly deleted to enforce parameterized construction
+        LoadGeneratorOptions() = delete;
+
+        /// @brief Constructor with explicit parameter initialization
+        /// @param enabled Whether the client runs the benchmark instead of the interactive login
+        /// @param mode Load model, "open" or "closed"
+        /// @param target_rps Calls started per second in open loop mode
+        /// @param concurrency Number of workers issuing calls
+        /// @param duration_sec Length of the measured run in seconds
+        /// @param user_count Number of benchmark users the calls are spread over
+        /// @param username_distribution Distribution usernames are drawn from, "uniform" or "zipf"
+        /// @param zipf_exponent Skew of the Zipf distribution
+        /// @param operation_mix Relative weight of each AuthService method, keyed by method name
+        LoadGeneratorOptions(bool enabled, std::string mode, int32_t target_rps, int32_t concurrency, int32_t duration_sec, int32_t user_count, std::string username_distribution, double zipf_exponent, std::map<std::string, int32_t> operation_mix) noexcept;
+
+        /// @brief Copy constructor deleted to prevent unintended resource duplication
+        LoadGeneratorOptions(const LoadGeneratorOptions &) = delete;
+
+        /// @brief Copy assignment operator deleted to prevent unintended resource duplication
+        auto operator=(const LoadGeneratorOptions &) -> LoadGeneratorOptions & = delete;
+
+        /// @brief Check if the benchmark mode is enabled
+        /// @return True if the client runs the benchmark instead of the interactive login
+        [[nodiscard]] auto enabled() const noexcept -> bool;
+
+        /// @brief Set whether the benchmark mode is enabled
+        /// @param value True to run the benchmark instead of the interactive login
+        auto enabled(bool value) noexcept -> void;
+
+        /// @brief Get the load model
+        /// @return "open" or "closed"
+        /// @details In open loop mode calls are started on a fixed schedule and their latency is
+        /// measured from the time they were scheduled, so a stalled server is charged for every call
+        /// it delayed. In closed loop mode every worker waits for its previous call before starting
+        /// the next, which caps the load at what the server sustains.
+        [[nodiscard]] auto mode() const noexcept -> const std::string &;
+
+        /// @brief Set the load model
+        /// @param value "open" or "closed"
+        auto mode(const std::string &value) noexcept -> void;
+
+        /// @brief Get the target call rate in calls per second
+        /// @return The target call rate
+        /// @details In open loop mode this is the rate calls are started at. In closed loop mode it
+        /// is the rate the workers are expected to sustain and only sets the interval used to correct
+        /// the latency percentiles for coordinated omission; 0 disables the correction.
+        [[nodiscard]] auto targetRps() const noexcept -> int32_t;
+
+        /// @brief Set the target call rate in calls per second
+        /// @param value The target call rate
+        auto targetRps(int32_t value) noexcept -> void;
+
+        /// @brief Get the number of workers
+        /// @return The number of workers issuing calls
+        /// @details In closed loop mode this is the number of calls in flight. In open loop mode it
+        /// caps the calls in flight; once all workers are busy, scheduled calls start late and the
+        /// delay shows up in their latency.
+        [[nodiscard]] auto concurrency() const noexcept -> int32_t;
+
+        /// @brief Set the number of workers
+        /// @param value The number of workers issuing calls
+        auto concurrency(int32_t value) noexcept -> void;
+
+        /// @brief Get the length of the measured run in seconds
+        /// @return The length of the run in seconds
+        [[nodiscard]] auto durationSec() const noexcept -> int32_t;
+
+        /// @brief Set the length of the measured run in seconds
+        /// @param value The length of the run in seconds
+        auto durationSec(int32_t value) noexcept -> void;
+
+        /// @brief Get the number of benchmark users
+        /// @return The number of users the calls are spread over
+        /// @details The users are registered before the measured run starts.
+        [[nodiscard]] auto userCount() const noexcept -> int32_t;
+
+        /// @brief Set the number of benchmark users
+        /// @param value The number of users the calls are spread over
+        auto userCount(int32_t value) noexcept -> void;
+
+        /// @brief Get the distribution usernames are drawn from
+        /// @return "uniform" or "zipf"
+        [[nodiscard]] auto usernameDistribution() const noexcept -> const std::string &;
+
+        /// @brief Set the distribution usernames are drawn from
+        /// @param value "uniform" or "zipf"
+        auto usernameDistribution(const std::string &value) noexcept -> void;
+
+        /// @brief Get the skew of the Zipf distribution
+        /// @return The Zipf exponent
+        /// @details The k-th most popular user is drawn with a probability proportional to 1/k^s.
+        /// Values around 1 model the hot accounts of a real user base.
+        [[nodiscard]] auto zipfExponent() const noexcept -> double;
+
+        /// @brief Set the skew of the Zipf distribution
+        /// @param value The Zipf exponent
+        auto zipfExponent(double value) noexcept -> void;
+
+        /// @brief Get the operation mix
+        /// @return Relative weight of each AuthService method, keyed by method name
+        /// @details Valid keys are RegisterUser, AuthenticateUser, ChangePassword, ResetPassword,
+        /// DeleteUser and UserExists. Methods without an entry are not called.
+        [[nodiscard]] auto operationMix() const noexcept -> const std::map<std::string, int32_t> &;
+
+        /// @brief Set the operation mix
+        /// @param value Relative weight of each AuthService method, keyed by method name
+        auto operationMix(const std::map<std::string, int32_t> &value) noexcept -> void;
+
+        /// @brief Deserialize benchmark options from a YAML file
+        /// @param path Path to the YAML file containing the configuration
+        /// @throws std::runtime_error If file cannot be opened or decoded
+        /// @details The expected YAML structure should contain keys matching the configuration parameters:
+        /// @code
+        /// benchmark:
+        ///   enabled: true
+        ///   mode: "open"
+        ///   targetRps: 200
+        ///   concurrency: 32
+        ///   durationSec: 30
+        ///   userCount: 1000
+        ///   usernameDistribution: "zipf"
+        ///   zipfExponent: 0.99
+        ///   operationMix:
+        ///     AuthenticateUser: 70
+        ///     UserExists: 20
+        /// @endcode
+        auto deserializedFromYamlFile(const std::filesystem::path &path) -> void override;
+
+        /// @brief Builder class for constructing LoadGeneratorOptions instances
+        /// @details Implements the Builder pattern to allow for flexible construction
+        /// of LoadGeneratorOptions objects with default values and selective parameter setting.
+        class Builder {
+        public:
+            /// @brief Set whether the benchmark mode is enabled
+            /// @param value True to run the benchmark instead of the interactive login
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto enabled(bool value) noexcept -> Builder &;
+
+            /// @brief Set the load model
+            /// @param value "open" or "closed"
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto mode(const std::string &value) noexcept -> Builder &;
+
+            /// @brief Set the target call rate in calls per second
+            /// @param value The target call rate
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto targetRps(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the number of workers
+            /// @param value The number of workers issuing calls
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto concurrency(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the length of the measured run in seconds
+            /// @param value The length of the run in seconds
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto durationSec(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the number of benchmark users
+            /// @param value The number of users the calls are spread over
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto userCount(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the distribution usernames are drawn from
+            /// @param value "uniform" or "zipf"
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto usernameDistribution(const std::string &value) noexcept -> Builder &;
+
+            /// @brief Set the skew of the Zipf distribution
+            /// @param value The Zipf exponent
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto zipfExponent(double value) noexcept -> Builder &;
+
+            /// @brief Set the operation mix
+            /// @param value Relative weight of each AuthService method, keyed by method name
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto operationMix(const std::map<std::string, int32_t> &value) noexcept -> Builder &;
+
+            /// @brief Build the LoadGeneratorOptions instance with the configured parameters
+            /// @return A new LoadGeneratorOptions instance with the configured values
+            [[nodiscard]] auto build() const -> LoadGeneratorOptions;
+
+        private:
+            bool enabled_{false};
+            std::string mode_{"open"};
+            int32_t target_rps_{200};
+            int32_t concurrency_{32};
+            int32_t duration_sec_{30};
+            int32_t user_count_{1000};
+            std::string username_distribution_{"zipf"};
+            double zipf_exponent_{0.99};
+            std::map<std::string, int32_t> operation_mix_{{"AuthenticateUser", 70}, {"UserExists", 20}, {"RegisterUser", 3}, {"ChangePassword", 3}, {"ResetPassword", 2}, {"DeleteUser", 2}};
+        };
+
+        /// @brief Create a new Builder instance for constructing LoadGeneratorOptions
+        /// @return A new Builder instance with default values
+        [[nodiscard]] static auto builder() -> Builder;
+
+        /// @brief Validate benchmark parameters for correctness
+        /// @details This function checks that the benchmark parameters are within reasonable ranges
+        /// and logs warnings for potentially problematic configurations
+        auto validate() const noexcept -> void;
+
+    private:
+        /// @brief Whether the client runs the benchmark instead of the interactive login
+        /// @details Default value is false.
+        bool enabled_{false};
+
+        /// @brief Load model, "open" or "closed"
+        /// @details Default value is "open".
+        std::string mode_{"open"};
+
+        /// @brief Calls started per second in open loop mode
+        /// @details Default value is 200.
+        int32_t target_rps_{200};
+
+        /// @brief Number of workers issuing calls
+        /// @details Default value is 32.
+        int32_t concurrency_{32};
+
+        /// @brief Length of the measured run in seconds
+        /// @details Default value is 30.
+        int32_t duration_sec_{30};
+
+        /// @brief Number of benchmark users the calls are spread over
+        /// @details Default value is 1000.
+        int32_t user_count_{1000};
+
+        /// @brief Distribution usernames are drawn from, "uniform" or "zipf"
+        /// @details Default value is "zipf".
+        std::string username_distribution_{"zipf"};
+
+        /// @brief Skew of the Zipf distribution
+        /// @details Default value is 0.99.
+        double zipf_exponent_{0.99};
+
+        /// @brief Relative weight of each AuthService method, keyed by method name
+        /// @details Default mix is read-heavy: 70% logins, 20% existence checks and 10% writes.
+        std::map<std::string, int32_t> operation_mix_{{"AuthenticateUser", 70}, {"UserExists", 20}, {"RegisterUser", 3}, {"ChangePassword", 3}, {"ResetPassword", 2}, {"DeleteUser", 2}};
+    };
+}
+
+/// @brief YAML serialization specialization for LoadGeneratorOptions.
+/// Provides methods to encode and decode LoadGeneratorOptions to/from YAML nodes.
+template<>
+struct YAML::convert<app_client::bench::LoadGeneratorOptions> {
+    /// @brief Decode a YAML node into a LoadGeneratorOptions object.
+    /// @param node The YAML node containing the configuration data.
+    /// @param rhs The LoadGeneratorOptions object to populate.
+    /// @return True if decoding was successful.
+    /// @details Missing values will retain their current values.
+    static auto decode(const YAML::Node &node, app_client::bench::LoadGeneratorOptions &rhs) -> bool;
+
+    /// @brief Encode a LoadGeneratorOptions object into a YAML node.
+    /// @param rhs The LoadGeneratorOptions object to encode.
+    /// @return A YAML node containing the configuration data.
+    static auto encode(const app_client::bench::LoadGeneratorOptions &rhs) -> YAML::Node;
+};
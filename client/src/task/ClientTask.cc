@@ -1,5 +1,7 @@
 #include "src/task/ClientTask.hpp"
 
+#include <algorithm>
+#include <vector>
 #include <fmt/format.h>
 #include <glog/logging.h>
 #include <grpcpp/grpcpp.h>
@@ -7,11 +9,12 @@
 #include "config/GLogConfigurator.hpp"
 #include "rpc/RpcMetadata.hpp"
 #include "src/auth/AuthRpcClient.hpp"
+#include "src/bench/LoadGenerator.hpp"
 #include "src/filesystem/io/Console.hpp"
 #include "src/system/SystemInfo.hpp"
 
 namespace app_client::task {
-    ClientTask::ClientTask(const std::string &project_name_) noexcept : rpc_options_{auth::AuthRpcClientOptions::builder().build()}, timer_{project_name_} {
+    ClientTask::ClientTask(const std::string &project_name_) noexcept : rpc_options_{auth::AuthRpcClientOptions::builder().build()}, bench_options_{bench::LoadGeneratorOptions::builder().build()}, timer_{project_name_} {
         timer_.recordStart();
     }
 
@@ -98,13 +101,33 @@ namespace app_client::task {
         LOG(INFO) << "Current connection state: " << common::rpc::RpcMetadata::grpcStateToString(auth_rpc_client.getConnectivityState());
     }
 
+    auto ClientTask::benchmark(const client_app::auth::AuthRpcClient &auth_rpc_client) const -> void {
+        // Generated load is only ever pointed at a server on this machine
+        if (!bench::LoadGenerator::isLocalAddress(rpc_options_.serverAddress())) {
+            const auto error_msg = fmt::format("Benchmark mode only runs against a local server, configured address: {}", rpc_options_.serverAddress());
+            LOG(ERROR) << error_msg;
+            throw std::runtime_error(error_msg);
+        }
+
+        bench::LoadGenerator load_generator{auth_rpc_client, bench_options_};
+        load_generator.run();
+    }
+
     auto ClientTask::run() -> void {
         init();
+        rpc_options_.deserializedFromYamlFile(application_dev_config_path_);
+        bench_options_.deserializedFromYamlFile(application_dev_config_path_);
         const auto client = createRpcClient();
 
         // Log initial connection state
         LOG(INFO) << "Initial connection state: " << common::rpc::RpcMetadata::grpcStateToString(client.getConnectivityState());
 
+        if (bench_options_.enabled()) {
+            benchmark(client);
+            exit();
+            return;
+        }
+
         const std::string username = logIn(client);
 
         task(client);
@@ -115,19 +138,24 @@ namespace app_client::task {
     }
 
     auto ClientTask::createRpcClient() const -> client_app::auth::AuthRpcClient {
-        LOG(INFO) << "Creating gRPC channel";
-        // Create channel using the existing createChannel method with custom arguments
-        const auto channel = createChannel();
-
-        // Get state using the new GrpcConnectivityState enum
-        const auto state_enum = common::rpc::RpcMetadata::grpcStateToEnum(channel->GetState(true));
-        const std::string state_str = common::rpc::RpcMetadata::grpcStateToString(state_enum);
-
-        LOG(INFO) << fmt::format("gRPC channel created with state: {}", state_str);
+        const auto channel_count = static_cast<size_t>(std::max(rpc_options_.channelCount(), 1));
+        LOG(INFO) << fmt::format("Creating {} gRPC channel(s)", channel_count);
+        // Create channels using the existing createChannel method with custom arguments
+        std::vector<std::shared_ptr<grpc::Channel> > channels;
+        channels.reserve(channel_count);
+        for (size_t i = 0; i < channel_count; ++i) {
+            const auto &channel = channels.emplace_back(createChannel());
+
+            // Get state using the new GrpcConnectivityState enum
+            const auto state_enum = common::rpc::RpcMetadata::grpcStateToEnum(channel->GetState(true));
+            const std::string state_str = common::rpc::RpcMetadata::grpcStateToString(state_enum);
+
+            LOG(INFO) << fmt::format("gRPC channel {} created with state: {}", i, state_str);
+        }
         LOG(INFO) << "Creating RPC client";
-        // Create client using the channel with custom arguments
-        client_app::auth::AuthRpcClient client{channel};
-        LOG(INFO) << "RPC client created successfully";
+        // Create client spreading calls over the channels, with deadlines, retries and hedging from the options
+        client_app::auth::AuthRpcClient client{std::move(channels), rpc_options_};
+        LOG(INFO) << fmt::format("RPC client created successfully - Deadline: {}ms, Retry Max Attempts: {}, Retry Budget Ratio: {}, Hedging: {} (p{})", rpc_options_.deadlineMs(), rpc_options_.retryMaxAttempts(), rpc_options_.retryBudgetRatio(), rpc_options_.hedgingEnabled(), rpc_options_.hedgingPercentile());
 
         return client;
     }
@@ -149,6 +177,8 @@ namespace app_client::task {
         channel_args.SetInt(GRPC_ARG_KEEPALIVE_TIME_MS, rpc_options_.keepaliveTimeMs());
         channel_args.SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, rpc_options_.keepaliveTimeoutMs());
         channel_args.SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, rpc_options_.keepalivePermitWithoutCalls());
+        // Channels with equal arguments share one connection through the global subchannel pool
+        channel_args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
 
         LOG(INFO) << fmt::format("Channel arguments set - Time: {}ms, Timeout: {}ms, Permit without calls: {}", rpc_options_.keepaliveTimeMs(), rpc_options_.keepaliveTimeoutMs(), rpc_options_.keepalivePermitWithoutCalls());
 
@@ -164,7 +194,7 @@ namespace app_client::task {
         LOG(INFO) << fmt::format("Channel state after creation: {}", state_str);
 
         // Give channel some time to connect
-        if (!channel->WaitForConnected(std::chrono::system_clock::now() + std::chrono::seconds(5))) {
+        if (!channel->WaitForConnected(std::chrono::system_clock::now() + std::chrono::milliseconds(rpc_options_.connectTimeoutMs()))) {
             const auto error_msg = fmt::format("Failed to connect to gRPC server at {} within timeout period", server_address);
             LOG(ERROR) << error_msg;
 
@@ -5,6 +5,7 @@
 
 #include "src/auth/AuthRpcClient.hpp"
 #include "src/auth/AuthRpcClientOptions.hpp"
+#include "src/bench/LoadGeneratorOptions.hpp"
 #include "src/time/FunctionProfiler.hpp"
 #include "task/interface/ITask.h"
 
@@ -30,7 +31,8 @@ namespace app_client::task {
 
         /// @brief Run the main task
         /// @details Initializes the client, creates a gRPC channel, sends a message to the server,
-        /// and exits cleanly
+        /// and exits cleanly. If the benchmark section of the configuration is enabled, runs the
+        /// load generator instead of the interactive login.
         auto run() -> void override;
 
         /// @brief Exit the client task
@@ -65,13 +67,19 @@ namespace app_client::task {
         /// @param auth_rpc_client Reference to the RPC client for executing tasks
         auto task(const client_app::auth::AuthRpcClient &auth_rpc_client) noexcept -> void;
 
+        /// @brief Run the configured benchmark against the server
+        /// @param auth_rpc_client Reference to the RPC client the load is sent through
+        /// @throws std::runtime_error if the server is not on the local machine
+        auto benchmark(const client_app::auth::AuthRpcClient &auth_rpc_client) const -> void;
+
         /// @brief Create a gRPC channel with custom arguments
-        /// @details This function sets up a gRPC channel with keepalive parameters and connects to the server
+        /// @details This function sets up a gRPC channel with keepalive parameters and its own connection
+        /// to the server
         /// @return A shared pointer to the created gRPC channel
         [[nodiscard]] auto createChannel() const -> std::shared_ptr<grpc::Channel>;
 
-        /// @brief Create RPC client with gRPC channel
-        /// @details This function creates an RPC client using a gRPC channel
+        /// @brief Create RPC client with gRPC channels
+        /// @details This function creates an RPC client spreading its calls over channelCount gRPC channels
         /// @return An RPC client instance
         [[nodiscard]] auto createRpcClient() const -> client_app::auth::AuthRpcClient;
 
@@ -81,6 +89,7 @@ namespace app_client::task {
 
         const std::string application_dev_config_path_{"../../client/src/application-dev.yml"};
         mutable auth::AuthRpcClientOptions rpc_options_;
+        mutable bench::LoadGeneratorOptions bench_options_;
         mutable common::time::FunctionProfiler timer_;
     };
 }
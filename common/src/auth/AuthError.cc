@@ -0,0 +1,25 @@
+#include "AuthError.hpp"
+
+#include <array>
+
+namespace common::auth {
+    /// @brief Client-facing messages indexed by AuthError
+    static constexpr std::array<std::string_view, AUTH_ERROR_COUNT> AUTH_ERROR_MESSAGES = {
+        "Invalid username format. Use alphanumeric characters, underscores, or hyphens (3-20 characters).",
+        "Username already exists",
+        "Password does not meet security requirements",
+        "New password does not meet security requirements",
+        "User not found",
+        "Account is locked due to too many failed attempts. Please try again later.",
+        "Invalid password",
+        "Current password is incorrect",
+        "Unsupported key derivation function",
+        "Password was changed concurrently, please retry",
+        "Credentials changed during authentication, please retry",
+        "Failed to store credentials in database",
+    };
+
+    auto auth_error_message(const AuthError error) noexcept -> std::string_view {
+        return AUTH_ERROR_MESSAGES[static_cast<size_t>(error)];
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <string_view>
+
+namespace common::auth {
+    /// @brief Expected failure of an authentication operation
+    /// @details Failures caused by the caller, such as a wrong password or an unknown user, are reported
+    /// through this enum instead of an exception, so a stream of failed logins costs no stack unwinding.
+    /// Values are dense and start at zero so callers can map them to codes through a plain array.
+    enum class AuthError : uint8_t {
+        InvalidUsername, ///< Username does not match the allowed format
+        UserAlreadyExists, ///< Username is already registered
+        WeakPassword, ///< Password does not meet the password policy
+        WeakNewPassword, ///< New password does not meet the password policy
+        UserNotFound, ///< No such user
+        AccountLocked, ///< Too many failed attempts
+        InvalidPassword, ///< Password does not match the stored credentials
+        IncorrectCurrentPassword, ///< Current password could not be verified during a password change
+        UnsupportedKdf, ///< Stored credentials use an unknown key derivation function
+        ConcurrentPasswordChange, ///< Credentials changed between verification and update
+        CredentialsChanged, ///< Credentials kept changing while being verified
+        StorageFailure, ///< Database rejected the mutation
+    };
+
+    /// @brief Number of AuthError values, for tables indexed by the enum
+    inline constexpr size_t AUTH_ERROR_COUNT = static_cast<size_t>(AuthError::StorageFailure) + 1;
+
+    /// @brief Result of an authentication operation, either a value or the reason it failed
+    template<typename T = void>
+    using AuthResult = std::expected<T, AuthError>;
+
+    /// @brief Get the human-readable description of an error
+    /// @param error Error to describe
+    /// @return Static message suitable for clients
+    [[nodiscard]] auto auth_error_message(AuthError error) noexcept -> std::string_view;
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace common::auth {
+    /// @brief Character classes used by username and password validation, combinable as bit flags
+    enum CharacterClass : uint8_t {
+        Upper = 1 << 0, ///< ASCII uppercase letter
+        Lower = 1 << 1, ///< ASCII lowercase letter
+        Digit = 1 << 2, ///< ASCII digit
+        Special = 1 << 3, ///< ASCII punctuation or whitespace
+        UsernameChar = 1 << 4, ///< Letter, digit, underscore or hyphen
+    };
+
+    /// @brief Classify one byte the way the "C" locale does
+    /// @param c Byte to classify
+    /// @return Bitwise OR of the CharacterClass flags the byte belongs to
+    [[nodiscard]] consteval auto classify_character(const unsigned char c) noexcept -> uint8_t {
+        uint8_t flags = 0;
+        if (c >= 'A' && c <= 'Z') {
+            flags |= Upper | UsernameChar;
+        } else if (c >= 'a' && c <= 'z') {
+            flags |= Lower | UsernameChar;
+        } else if (c >= '0' && c <= '9') {
+            flags |= Digit | UsernameChar;
+        } else if ((c >= '!' && c <= '~') || c == ' ' || (c >= '\t' && c <= '\r')) {
+            // Every printable non-alphanumeric character is punctuation, as with std::ispunct
+            flags |= Special;
+        }
+        if (c == '_' || c == '-') {
+            flags |= UsernameChar;
+        }
+        return flags;
+    }
+
+    /// @brief Class flags of every byte, computed at compile time
+    inline constexpr std::array<uint8_t, 256> CHARACTER_CLASSES = [] consteval {
+        std::array<uint8_t, 256> table{};
+        for (size_t c = 0; c < table.size(); ++c) {
+            table[c] = classify_character(static_cast<unsigned char>(c));
+        }
+        return table;
+    }();
+
+    /// @brief Look up the class flags of a character
+    /// @param c Character to look up
+    /// @return Bitwise OR of the CharacterClass flags the character belongs to
+    [[nodiscard]] constexpr auto character_classes(const char c) noexcept -> uint8_t {
+        return CHARACTER_CLASSES[static_cast<unsigned char>(c)];
+    }
+
+    /// @brief Check whether every character of a string belongs to a class
+    /// @param text String to check
+    /// @param character_class CharacterClass flag every character must carry
+    /// @return true if all characters carry the flag, also for an empty string
+    [[nodiscard]] constexpr auto all_of_class(const std::string_view text, const uint8_t character_class) noexcept -> bool {
+        for (const char c: text) {
+            if (!(character_classes(c) & character_class)) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdint>
+
+#include "src/crypto/CryptoToolKit.hpp"
+
+namespace common::auth {
+    /// @brief Key derivation function a credential was hashed with, persisted as an INTEGER column
+    enum class KdfId : uint8_t {
+        /// @brief PBKDF2 with HMAC-SHA256 (value 1)
+        Pbkdf2HmacSha256 = 1,
+    };
+
+    /// @brief Binary password credential as stored in the users table
+    /// @details Salt and hash are held inline, so a record is copied between the database, the cache and
+    /// the verifier without any allocation or string formatting.
+    struct CredentialRecord {
+        crypto::CryptoToolKit::Salt salt{}; ///< Raw salt bytes, BLOB column
+        crypto::CryptoToolKit::Hash hash{}; ///< Raw derived key bytes, BLOB column
+        KdfId kdf_id{KdfId::Pbkdf2HmacSha256}; ///< Key derivation function, INTEGER column
+        uint32_t iterations{crypto::CryptoToolKit::DEFAULT_ITERATIONS}; ///< Key derivation cost, INTEGER column
+    };
+}
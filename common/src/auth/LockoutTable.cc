@@ -0,0 +1,174 @@
+#include "LockoutTable.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+
+namespace common::auth {
+    /// @brief One SipHash round over the four state words
+    static auto sip_round(uint64_t &v0, uint64_t &v1, uint64_t &v2, uint64_t &v3) noexcept -> void {
+        v0 += v1;
+        v1 = std::rotl(v1, 13) ^ v0;
+        v0 = std::rotl(v0, 32);
+        v2 += v3;
+        v3 = std::rotl(v3, 16) ^ v2;
+        v0 += v3;
+        v3 = std::rotl(v3, 21) ^ v0;
+        v2 += v1;
+        v1 = std::rotl(v1, 17) ^ v2;
+        v2 = std::rotl(v2, 32);
+    }
+
+    /// @brief Keyed SipHash-2-4 of a string
+    /// @param key0 First half of the 128 bit key
+    /// @param key1 Second half of the 128 bit key
+    /// @param data String to hash
+    /// @return 64 bit hash that cannot be predicted without the key
+    static auto siphash24(const uint64_t key0, const uint64_t key1, const std::string_view data) noexcept -> uint64_t {
+        uint64_t v0 = key0 ^ 0x736f6d6570736575ULL;
+        uint64_t v1 = key1 ^ 0x646f72616e646f6dULL;
+        uint64_t v2 = key0 ^ 0x6c7967656e657261ULL;
+        uint64_t v3 = key1 ^ 0x7465646279746573ULL;
+
+        const auto load_le = [&data](const size_t offset, const size_t length) {
+            uint64_t word = 0;
+            for (size_t i = 0; i < length; ++i) {
+                word |= static_cast<uint64_t>(static_cast<unsigned char>(data[offset + i])) << (8 * i);
+            }
+            return word;
+        };
+
+        const size_t full_words = data.size() / 8;
+        for (size_t i = 0; i < full_words; ++i) {
+            const uint64_t m = load_le(i * 8, 8);
+            v3 ^= m;
+            sip_round(v0, v1, v2, v3);
+            sip_round(v0, v1, v2, v3);
+            v0 ^= m;
+        }
+
+        const uint64_t last = static_cast<uint64_t>(data.size()) << 56 | load_le(full_words * 8, data.size() % 8);
+        v3 ^= last;
+        sip_round(v0, v1, v2, v3);
+        sip_round(v0, v1, v2, v3);
+        v0 ^= last;
+
+        v2 ^= 0xFF;
+        for (int i = 0; i < 4; ++i) {
+            sip_round(v0, v1, v2, v3);
+        }
+        return v0 ^ v1 ^ v2 ^ v3;
+    }
+
+    LockoutTable::LockoutTable(const size_t capacity, const uint32_t max_attempts, const std::chrono::seconds lockout_duration) : mask_(std::bit_ceil(std::max(capacity, PROBE_WINDOW)) - 1), max_attempts_(std::min<uint32_t>(max_attempts, COUNT_MASK)), lockout_seconds_(static_cast<uint32_t>(lockout_duration.count())), epoch_(std::chrono::steady_clock::now()) {
+        if (capacity == 0 || max_attempts == 0) {
+            throw std::invalid_argument("LockoutTable: capacity and max attempts must be greater than 0");
+        }
+        slots_ = std::make_unique<std::atomic<uint64_t>[]>(mask_ + 1);
+
+        // A per-process key keeps attackers from computing usernames that share a victim's probe window
+        std::random_device random;
+        key0_ = static_cast<uint64_t>(random()) << 32 | random();
+        key1_ = static_cast<uint64_t>(random()) << 32 | random();
+    }
+
+    auto LockoutTable::is_locked(const std::string_view username) const noexcept -> bool {
+        const auto [home, tag] = key_of(username);
+        const auto now = now_seconds();
+        size_t locked_slots = 0;
+        for (size_t i = 0; i < PROBE_WINDOW; ++i) {
+            const auto word = slots_[(home + i) & mask_].load(std::memory_order_acquire);
+            if (!locks(word, now)) {
+                continue;
+            }
+            if (word >> TAG_SHIFT == tag) {
+                return true;
+            }
+            ++locked_slots;
+        }
+        // A window full of active lockouts cannot track this username's failures, so it is locked as well
+        return locked_slots == PROBE_WINDOW;
+    }
+
+    auto LockoutTable::record_failure(const std::string_view username) noexcept -> void {
+        const auto [home, tag] = key_of(username);
+        const auto now = now_seconds();
+        const auto pack = [tag, now](const uint64_t count) {
+            return tag << TAG_SHIFT | count << COUNT_SHIFT | now;
+        };
+
+        while (true) {
+            size_t victim = home & mask_;
+            uint64_t victim_word = 0;
+            std::tuple<int, uint64_t, uint64_t> victim_rank{3, 0, 0};
+            for (size_t i = 0; i < PROBE_WINDOW; ++i) {
+                auto &slot = slots_[(home + i) & mask_];
+                auto word = slot.load(std::memory_order_acquire);
+
+                // Known username: bump its count, restarting it if the previous failures expired
+                while (word >> TAG_SHIFT == tag) {
+                    const uint64_t count = expired(word, now) ? 1 : std::min(((word >> COUNT_SHIFT) & COUNT_MASK) + 1, COUNT_MASK);
+                    if (slot.compare_exchange_weak(word, pack(count), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        return;
+                    }
+                }
+
+                // Rank the slot as a place for a new entry: empty, then expired, then least evidence; an active
+                // lockout is never taken over
+                if (locks(word, now)) {
+                    continue;
+                }
+                const std::tuple<int, uint64_t, uint64_t> rank = word == 0 ? std::make_tuple(0, uint64_t{0}, uint64_t{0}) : expired(word, now) ? std::make_tuple(1, uint64_t{0}, uint64_t{0}) : std::make_tuple(2, (word >> COUNT_SHIFT) & COUNT_MASK, word & TIME_MASK);
+                if (rank < victim_rank) {
+                    victim = (home + i) & mask_;
+                    victim_word = word;
+                    victim_rank = rank;
+                }
+            }
+
+            // Every slot holds an active lockout, which is_locked already reports for this username too
+            if (std::get<0>(victim_rank) == 3) {
+                return;
+            }
+
+            // Unknown username: claim the chosen slot, or rescan if another thread changed it first
+            if (slots_[victim].compare_exchange_strong(victim_word, pack(1), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return;
+            }
+        }
+    }
+
+    auto LockoutTable::reset(const std::string_view username) noexcept -> void {
+        const auto [home, tag] = key_of(username);
+        for (size_t i = 0; i < PROBE_WINDOW; ++i) {
+            auto &slot = slots_[(home + i) & mask_];
+            auto word = slot.load(std::memory_order_acquire);
+            while (word >> TAG_SHIFT == tag && !slot.compare_exchange_weak(word, 0, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            }
+        }
+    }
+
+    auto LockoutTable::capacity() const noexcept -> size_t {
+        return mask_ + 1;
+    }
+
+    auto LockoutTable::key_of(const std::string_view username) const noexcept -> Key {
+        const uint64_t hash = siphash24(key0_, key1_, username);
+        const uint64_t tag = hash >> TAG_SHIFT;
+        return {static_cast<size_t>(hash) & mask_, tag != 0 ? tag : 1};
+    }
+
+    auto LockoutTable::now_seconds() const noexcept -> uint32_t {
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - epoch_).count());
+    }
+
+    auto LockoutTable::locks(const uint64_t word, const uint32_t now) const noexcept -> bool {
+        return ((word >> COUNT_SHIFT) & COUNT_MASK) >= max_attempts_ && !expired(word, now);
+    }
+
+    auto LockoutTable::expired(const uint64_t word, const uint32_t now) const noexcept -> bool {
+        return now - static_cast<uint32_t>(word & TIME_MASK) >= lockout_seconds_;
+    }
+}
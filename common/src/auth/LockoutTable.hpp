@@ -0,0 +1,99 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace common::auth {
+    /// @brief Fixed-size, lock-free table of failed login attempts keyed by username hash
+    /// @details Every slot is a single atomic word holding a tag derived from the username hash, a
+    /// saturating failure count and the time of the last failure, so checks and updates are one load or
+    /// one compare-and-swap loop without any mutex. A username is placed in a short window of slots
+    /// after its home slot (linear probing). Because the key is the hash rather than a database row,
+    /// usernames that do not exist are tracked too, and a lockout can be decided before any database or
+    /// key derivation work. When a username finds its whole window occupied it takes over the slot that
+    /// carries the least evidence: an expired one first, otherwise the one with the fewest failures. An
+    /// active lockout is never taken over; a username whose window holds nothing but active lockouts is
+    /// treated as locked itself. The hash is SipHash keyed with a random per-process key, so usernames
+    /// that share a victim's window or tag cannot be computed offline. Two usernames that share home
+    /// slot and tag share their counter, which only lets them lock each other.
+    class LockoutTable {
+    public:
+        /// @brief Construct an empty table
+        /// @param capacity Minimum number of slots, rounded up to a power of two
+        /// @param max_attempts Failed attempts after which a username is locked
+        /// @param lockout_duration Time after the last failure during which a locked username stays locked
+        /// @throws std::invalid_argument if capacity or max_attempts is zero
+        LockoutTable(size_t capacity, uint32_t max_attempts, std::chrono::seconds lockout_duration);
+
+        /// @brief Copy constructor (deleted)
+        LockoutTable(const LockoutTable &) = delete;
+
+        /// @brief Copy assignment operator (deleted)
+        auto operator=(const LockoutTable &) -> LockoutTable & = delete;
+
+        /// @brief Check whether a username is locked
+        /// @param username Username to check, existing or not
+        /// @return true if it reached the maximum number of failures and the lockout has not expired, or if
+        /// every slot of its window holds an active lockout
+        [[nodiscard]] auto is_locked(std::string_view username) const noexcept -> bool;
+
+        /// @brief Record a failed login attempt
+        /// @param username Username the attempt was made for, existing or not
+        auto record_failure(std::string_view username) noexcept -> void;
+
+        /// @brief Forget the failed attempts of a username
+        /// @param username Username that logged in successfully or whose password was replaced
+        auto reset(std::string_view username) noexcept -> void;
+
+        /// @brief Get the number of slots
+        /// @return Capacity of the table
+        [[nodiscard]] auto capacity() const noexcept -> size_t;
+
+    private:
+        /// @brief Number of slots after the home slot a username may occupy
+        static constexpr size_t PROBE_WINDOW = 8;
+
+        static constexpr uint32_t TAG_SHIFT = 40; ///< Slot bits 63..40 hold the username tag
+        static constexpr uint32_t COUNT_SHIFT = 32; ///< Slot bits 39..32 hold the failure count
+        static constexpr uint64_t COUNT_MASK = 0xFF; ///< Failure count saturates at 255
+        static constexpr uint64_t TIME_MASK = 0xFFFFFFFF; ///< Slot bits 31..0 hold the last failure in seconds since construction
+
+        /// @brief Home slot and tag of a username
+        struct Key {
+            size_t home;
+            uint64_t tag; ///< Never 0, which marks an empty slot
+        };
+
+        /// @brief Hash a username into its home slot and tag with the table's key
+        /// @param username Username to hash
+        /// @return Home slot index and non-zero tag
+        [[nodiscard]] auto key_of(std::string_view username) const noexcept -> Key;
+
+        /// @brief Get the current time in table seconds
+        /// @return Seconds elapsed since the table was constructed
+        [[nodiscard]] auto now_seconds() const noexcept -> uint32_t;
+
+        /// @brief Check whether a slot word describes an active lockout
+        /// @param word Slot word
+        /// @param now Current time in table seconds
+        /// @return true if the count reached the maximum and the lockout has not expired
+        [[nodiscard]] auto locks(uint64_t word, uint32_t now) const noexcept -> bool;
+
+        /// @brief Check whether a slot word only describes failures old enough to be forgotten
+        /// @param word Slot word
+        /// @param now Current time in table seconds
+        /// @return true if the last failure is older than the lockout duration
+        [[nodiscard]] auto expired(uint64_t word, uint32_t now) const noexcept -> bool;
+
+        std::unique_ptr<std::atomic<uint64_t>[]> slots_;
+        size_t mask_;
+        uint32_t max_attempts_;
+        uint32_t lockout_seconds_;
+        std::chrono::steady_clock::time_point epoch_;
+        uint64_t key0_{0}; ///< First half of the SipHash key, random per process
+        uint64_t key1_{0}; ///< Second half of the SipHash key, random per process
+    };
+}
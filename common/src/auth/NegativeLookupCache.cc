@@ -0,0 +1,98 @@
+#include "NegativeLookupCache.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <fmt/format.h>
+
+#include "src/container/BloomParameters.hpp"
+
+namespace common::auth {
+    NegativeLookupCache::NegativeLookupCache(const uint64_t expected_users, const double false_positive_rate) noexcept : expected_users_(expected_users), false_positive_rate_(false_positive_rate) {
+    }
+
+    auto NegativeLookupCache::rebuild(const std::function<std::vector<std::string>()> &load_usernames) -> void {
+        std::lock_guard rebuild_lock(rebuild_mutex_);
+        {
+            std::unique_lock lock(mutex_);
+            rebuilding_ = true;
+            inserted_during_rebuild_.clear();
+        }
+
+        try {
+            // Load and hash outside the lock, lookups keep using the current filter meanwhile
+            const auto usernames = load_usernames();
+
+            // Leave headroom for registrations until the next rebuild
+            container::BloomParameters parameters;
+            parameters.projected_element_count = std::max<uint64_t>(expected_users_, usernames.size() * 2);
+            parameters.false_positive_probability = false_positive_rate_;
+            if (!parameters.compute_optimal_parameters()) {
+                throw std::runtime_error(fmt::format("NegativeLookupCache::rebuild: cannot size a filter for {} users at false positive rate {}", parameters.projected_element_count, false_positive_rate_));
+            }
+
+            auto filter = std::make_unique<container::BloomFilter>(parameters);
+            for (const auto &username: usernames) {
+                filter->insert(username);
+            }
+
+            std::unique_lock lock(mutex_);
+            for (const auto &username: inserted_during_rebuild_) {
+                filter->insert(username);
+            }
+            filter_ = std::move(filter);
+            rebuilding_ = false;
+            inserted_during_rebuild_.clear();
+        } catch (...) {
+            std::unique_lock lock(mutex_);
+            rebuilding_ = false;
+            inserted_during_rebuild_.clear();
+            throw;
+        }
+    }
+
+    auto NegativeLookupCache::insert(const std::string_view username) -> void {
+        std::unique_lock lock(mutex_);
+        if (filter_) {
+            filter_->insert(username.data(), username.size());
+        }
+        if (rebuilding_) {
+            inserted_during_rebuild_.emplace_back(username);
+        }
+    }
+
+    auto NegativeLookupCache::might_contain(const std::string_view username) const -> bool {
+        std::shared_lock lock(mutex_);
+        if (!filter_) {
+            return true;
+        }
+        if (!filter_->contains(username.data(), username.size())) {
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    auto NegativeLookupCache::record_false_positive() noexcept -> void {
+        false_positives_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    auto NegativeLookupCache::is_ready() const noexcept -> bool {
+        std::shared_lock lock(mutex_);
+        return filter_ != nullptr;
+    }
+
+    auto NegativeLookupCache::stats() const -> Stats {
+        Stats stats;
+        stats.hits = hits_.load(std::memory_order_relaxed);
+        stats.misses = misses_.load(std::memory_order_relaxed);
+        stats.false_positives = false_positives_.load(std::memory_order_relaxed);
+
+        std::shared_lock lock(mutex_);
+        if (filter_) {
+            stats.element_count = filter_->element_count();
+            stats.estimated_false_positive_rate = filter_->effective_fpp();
+        }
+        return stats;
+    }
+}
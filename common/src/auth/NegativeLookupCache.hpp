@@ -0,0 +1,74 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "src/container/BloomFilter.hpp"
+
+namespace common::auth {
+    /// @brief Thread-safe Bloom filter over existing usernames that proves a username does not exist
+    /// @details A negative answer is definitive, so callers can skip the database for unknown usernames.
+    /// A positive answer only means the username may exist. Usernames are added on registration and
+    /// deletions are picked up by periodic rebuilds. Until the first rebuild every lookup is positive.
+    class NegativeLookupCache {
+    public:
+        /// @brief Counters describing how effective the cache is
+        struct Stats {
+            uint64_t hits{0}; ///< Lookups answered as absent without the database
+            uint64_t misses{0}; ///< Lookups that had to consult the database
+            uint64_t false_positives{0}; ///< Misses for which the database found no user
+            uint64_t element_count{0}; ///< Usernames inserted since the last rebuild
+            double estimated_false_positive_rate{0.0}; ///< False positive rate estimated from the filter fill
+        };
+
+        /// @brief Construct an empty cache
+        /// @param expected_users Minimum number of usernames the filter is sized for
+        /// @param false_positive_rate Target false positive rate
+        NegativeLookupCache(uint64_t expected_users, double false_positive_rate) noexcept;
+
+        /// @brief Replace the filter with one built from the given usernames
+        /// @param load_usernames Loader returning every existing username
+        /// @throws std::runtime_error if the filter parameters cannot be computed, or whatever the loader throws
+        /// @details Usernames inserted while the loader runs are carried over into the new filter, so a
+        /// registration racing with the rebuild is never lost.
+        auto rebuild(const std::function<std::vector<std::string>()> &load_usernames) -> void;
+
+        /// @brief Record an existing username
+        /// @param username Username to insert
+        auto insert(std::string_view username) -> void;
+
+        /// @brief Check whether a username may exist, counting a hit or a miss
+        /// @param username Username to check
+        /// @return false if the username definitely does not exist
+        [[nodiscard]] auto might_contain(std::string_view username) const -> bool;
+
+        /// @brief Record that a lookup passed the filter but the user did not exist
+        auto record_false_positive() noexcept -> void;
+
+        /// @brief Check whether the filter has been built at least once
+        /// @return true once lookups can return definitive negatives
+        [[nodiscard]] auto is_ready() const noexcept -> bool;
+
+        /// @brief Get a snapshot of the cache counters
+        /// @return Current counters and filter statistics
+        [[nodiscard]] auto stats() const -> Stats;
+
+    private:
+        uint64_t expected_users_;
+        double false_positive_rate_;
+        std::mutex rebuild_mutex_; ///< Serializes rebuilds, which share the carry-over list
+        mutable std::shared_mutex mutex_;
+        std::unique_ptr<container::BloomFilter> filter_; ///< Null until the first rebuild
+        bool rebuilding_{false};
+        std::vector<std::string> inserted_during_rebuild_;
+        mutable std::atomic<uint64_t> hits_{0};
+        mutable std::atomic<uint64_t> misses_{0};
+        std::atomic<uint64_t> false_positives_{0};
+    };
+}
@@ -1,57 +1,31 @@
 #include "PasswordPolicy.hpp"
-#include <cctype>
+
+#include "CharacterClass.hpp"
 
 namespace common::auth {
     PasswordPolicy::PasswordPolicy(const size_t min_length, const size_t max_length, const bool require_uppercase, const bool require_lowercase, const bool require_digits, const bool require_special, const size_t max_login_attempts) : min_length_(min_length), max_length_(max_length), require_uppercase_(require_uppercase), require_lowercase_(require_lowercase), require_digits_(require_digits), require_special_(require_special), max_login_attempts_(max_login_attempts) {
     }
 
-    auto PasswordPolicy::validate(const std::string &password) const noexcept -> bool {
+    auto PasswordPolicy::validate(const std::string_view password) const noexcept -> bool {
         // Check length requirements
         if (password.length() < min_length_ || password.length() > max_length_) {
             return false;
         }
 
-        // Initialize flags based on requirements (if requirement is false, set to true by default)
-        bool has_upper = !require_uppercase_;
-        bool has_lower = !require_lowercase_;
-        bool has_digit = !require_digits_;
-        bool has_special = !require_special_;
-
-        // Process each character in the password
+        // Collect the classes present in the password, stopping as soon as all required ones are seen
+        const uint8_t required = required_classes();
+        uint8_t present = 0;
         for (const char c: password) {
-            if (!has_upper && is_uppercase_char(c)) {
-                has_upper = true;
-            } else if (!has_lower && is_lowercase_char(c)) {
-                has_lower = true;
-            } else if (!has_digit && is_digit_char(c)) {
-                has_digit = true;
-            } else if (!has_special && is_special_char(c)) {
-                has_special = true;
-            }
-
-            // Early exit if all requirements are met
-            if (has_upper && has_lower && has_digit && has_special) {
-                break;
+            present |= character_classes(c);
+            if ((present & required) == required) {
+                return true;
             }
         }
-
-        return has_upper && has_lower && has_digit && has_special;
-    }
-
-    auto PasswordPolicy::is_uppercase_char(const char c) noexcept -> bool {
-        return std::isupper(static_cast<unsigned char>(c));
-    }
-
-    auto PasswordPolicy::is_lowercase_char(const char c) noexcept -> bool {
-        return std::islower(static_cast<unsigned char>(c));
-    }
-
-    auto PasswordPolicy::is_digit_char(const char c) noexcept -> bool {
-        return std::isdigit(static_cast<unsigned char>(c));
+        return (present & required) == required;
     }
 
-    auto PasswordPolicy::is_special_char(const char c) noexcept -> bool {
-        return std::ispunct(static_cast<unsigned char>(c)) || std::isspace(static_cast<unsigned char>(c));
+    auto PasswordPolicy::required_classes() const noexcept -> uint8_t {
+        return (require_uppercase_ ? Upper : 0) | (require_lowercase_ ? Lower : 0) | (require_digits_ ? Digit : 0) | (require_special_ ? Special : 0);
     }
 
     auto PasswordPolicy::set_min_length(const size_t length) noexcept -> void {
@@ -1,8 +1,12 @@
 #pragma once
-#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
 
 namespace common::auth {
     /// @brief Password policy configuration class with configurable security rules
+    /// @details Validation is a single pass over the password using the precomputed character class
+    /// table, so checking a password never allocates.
     class PasswordPolicy {
     public:
         /// @brief Constructor with default security parameters
@@ -18,7 +22,7 @@ namespace common::auth {
         /// @brief Validate password against current policy rules
         /// @param password Password string to validate
         /// @return true if password meets all requirements, false otherwise
-        [[nodiscard]] auto validate(const std::string &password) const noexcept -> bool;
+        [[nodiscard]] auto validate(std::string_view password) const noexcept -> bool;
 
         /// @brief Set minimum password length requirement
         /// @param length New minimum length value
@@ -59,17 +63,9 @@ namespace common::auth {
         [[nodiscard]] auto max_login_attempts() const noexcept -> size_t { return max_login_attempts_; }
 
     private:
-        /// @brief Check if character is uppercase letter
-        [[nodiscard]] static auto is_uppercase_char(char c) noexcept -> bool;
-
-        /// @brief Check if character is lowercase letter
-        [[nodiscard]] static auto is_lowercase_char(char c) noexcept -> bool;
-
-        /// @brief Check if character is digit
-        [[nodiscard]] static auto is_digit_char(char c) noexcept -> bool;
-
-        /// @brief Check if character is special character
-        [[nodiscard]] static auto is_special_char(char c) noexcept -> bool;
+        /// @brief CharacterClass flags a password must contain at least one character of
+        /// @return Bitwise OR of the required classes
+        [[nodiscard]] auto required_classes() const noexcept -> uint8_t;
 
         size_t min_length_;
         size_t max_length_;
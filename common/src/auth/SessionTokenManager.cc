@@ -0,0 +1,123 @@
+#include "SessionTokenManager.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
+
+namespace common::auth {
+    /// @brief Current time in microseconds since the epoch
+    [[nodiscard]] static auto now_micros() noexcept -> int64_t {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    /// @brief Append a timestamp in big-endian byte order
+    static auto append_timestamp(std::string &out, const int64_t value) -> void {
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            out.push_back(static_cast<char>(static_cast<uint64_t>(value) >> shift & 0xFF));
+        }
+    }
+
+    /// @brief Read a big-endian timestamp
+    [[nodiscard]] static auto read_timestamp(const std::string_view in) noexcept -> int64_t {
+        uint64_t value = 0;
+        for (size_t i = 0; i < sizeof(int64_t); ++i) {
+            value = value << 8 | static_cast<uint8_t>(in[i]);
+        }
+        return static_cast<int64_t>(value);
+    }
+
+    SessionTokenManager::SessionTokenManager(const std::chrono::seconds ttl) : ttl_(ttl) {
+        if (ttl_.count() <= 0) {
+            throw std::invalid_argument("SessionTokenManager::SessionTokenManager: ttl must be greater than 0");
+        }
+        if (RAND_bytes(key_.data(), static_cast<int>(key_.size())) != 1) {
+            throw std::runtime_error("SessionTokenManager::SessionTokenManager: Failed to generate signing key");
+        }
+    }
+
+    auto SessionTokenManager::issue(const std::string_view username) const -> IssuedToken {
+        if (username.empty()) {
+            throw std::invalid_argument("SessionTokenManager::issue: username cannot be empty");
+        }
+
+        const int64_t issued_at = now_micros();
+        const int64_t expires_at = issued_at + std::chrono::duration_cast<std::chrono::microseconds>(ttl_).count();
+
+        // Layout: version | issued_at | expires_at | username | HMAC of everything before it
+        std::string token;
+        token.reserve(HEADER_SIZE + username.size() + MAC_SIZE);
+        token.push_back(static_cast<char>(TOKEN_VERSION));
+        append_timestamp(token, issued_at);
+        append_timestamp(token, expires_at);
+        token.append(username);
+        const auto mac = sign(token);
+        token.append(reinterpret_cast<const char *>(mac.data()), mac.size());
+
+        return {std::move(token), std::chrono::system_clock::time_point(std::chrono::microseconds(expires_at))};
+    }
+
+    auto SessionTokenManager::validate(const std::string_view token) const -> std::optional<Claims> {
+        if (token.size() <= HEADER_SIZE + MAC_SIZE || static_cast<uint8_t>(token[0]) != TOKEN_VERSION) {
+            return std::nullopt;
+        }
+
+        const auto body = token.substr(0, token.size() - MAC_SIZE);
+        const auto mac = sign(body);
+        const auto *presented = reinterpret_cast<const uint8_t *>(token.data() + body.size());
+        if (!crypto::CryptoToolKit::secure_compare(mac, {presented, MAC_SIZE})) {
+            return std::nullopt;
+        }
+
+        const int64_t issued_at = read_timestamp(body.substr(1));
+        const int64_t expires_at = read_timestamp(body.substr(1 + TIMESTAMP_SIZE));
+        if (now_micros() >= expires_at) {
+            return std::nullopt;
+        }
+
+        const auto username = body.substr(HEADER_SIZE);
+        {
+            std::shared_lock lock(mutex_);
+            if (const auto it = revoked_before_.find(username); it != revoked_before_.end() && issued_at <= it->second) {
+                return std::nullopt;
+            }
+        }
+        return Claims{username, std::chrono::system_clock::time_point(std::chrono::microseconds(expires_at))};
+    }
+
+    auto SessionTokenManager::revoke(const std::string_view username) -> void {
+        const int64_t now = now_micros();
+        std::unique_lock lock(mutex_);
+        if (const auto it = revoked_before_.find(username); it != revoked_before_.end()) {
+            it->second = now;
+        } else {
+            revoked_before_.emplace(username, now);
+        }
+        if (revoked_before_.size() >= prune_threshold_) {
+            prune_revocations(now);
+        }
+    }
+
+    auto SessionTokenManager::revoked_count() const -> size_t {
+        std::shared_lock lock(mutex_);
+        return revoked_before_.size();
+    }
+
+    auto SessionTokenManager::sign(const std::string_view body) const -> crypto::CryptoToolKit::Hash {
+        crypto::CryptoToolKit::Hash mac;
+        unsigned int mac_size = 0;
+        if (!HMAC(EVP_sha256(), key_.data(), static_cast<int>(key_.size()), reinterpret_cast<const unsigned char *>(body.data()), body.size(), mac.data(), &mac_size) || mac_size != mac.size()) {
+            throw std::runtime_error("SessionTokenManager::sign: HMAC computation failed");
+        }
+        return mac;
+    }
+
+    auto SessionTokenManager::prune_revocations(const int64_t now) -> void {
+        // Tokens issued before now - ttl have expired, so their revocations are no longer needed
+        const int64_t horizon = now - std::chrono::duration_cast<std::chrono::microseconds>(ttl_).count();
+        std::erase_if(revoked_before_, [horizon](const auto &entry) { return entry.second < horizon; });
+        prune_threshold_ = std::max(MIN_PRUNE_THRESHOLD, revoked_before_.size() * 2);
+    }
+}
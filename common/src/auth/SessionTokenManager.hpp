@@ -0,0 +1,90 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "src/crypto/CryptoToolKit.hpp"
+
+namespace common::auth {
+    /// @brief Issues and validates signed, expiring session tokens
+    /// @details A token carries the username together with its issue and expiry time, authenticated
+    /// with HMAC-SHA256 under a key generated when the manager is created. Validation therefore costs
+    /// one HMAC and never touches the database. Tokens are revoked per user: revoking a username
+    /// invalidates every token issued to it up to that moment. The revocation set lives in memory,
+    /// which is sound because the signing key does too, so no token outlives the process.
+    class SessionTokenManager {
+    public:
+        /// @brief A freshly issued token
+        struct IssuedToken {
+            std::string token; ///< Opaque binary token to hand to the client
+            std::chrono::system_clock::time_point expires_at; ///< Time after which the token is rejected
+        };
+
+        /// @brief Contents of a token that passed validation
+        struct Claims {
+            std::string_view username; ///< Username the token was issued to, a view into the validated token
+            std::chrono::system_clock::time_point expires_at; ///< Time after which the token is rejected
+        };
+
+        /// @brief Construct a manager with a new random signing key
+        /// @param ttl Lifetime of issued tokens
+        /// @throws std::invalid_argument if ttl is not positive
+        /// @throws std::runtime_error if the signing key cannot be generated
+        explicit SessionTokenManager(std::chrono::seconds ttl);
+
+        /// @brief Issue a token for a user that has just been authenticated
+        /// @param username Username to issue the token to
+        /// @return Signed token and its expiry
+        /// @throws std::invalid_argument if the username is empty
+        [[nodiscard]] auto issue(std::string_view username) const -> IssuedToken;
+
+        /// @brief Validate a token
+        /// @param token Token as returned by issue
+        /// @return Claims of the token, nullopt if it is malformed, forged, expired or revoked
+        [[nodiscard]] auto validate(std::string_view token) const -> std::optional<Claims>;
+
+        /// @brief Revoke every token issued to a user so far
+        /// @param username Username whose tokens are revoked
+        auto revoke(std::string_view username) -> void;
+
+        /// @brief Get the number of users with revoked tokens that are still tracked
+        /// @return Size of the revocation set
+        [[nodiscard]] auto revoked_count() const -> size_t;
+
+    private:
+        /// @brief Transparent hash so revocations can be looked up by std::string_view
+        struct UsernameHash {
+            using is_transparent = void;
+
+            auto operator()(const std::string_view username) const noexcept -> size_t {
+                return std::hash<std::string_view>{}(username);
+            }
+        };
+
+        static constexpr uint8_t TOKEN_VERSION = 1; ///< Leading byte of every token, bumped on layout changes
+        static constexpr size_t TIMESTAMP_SIZE = sizeof(int64_t); ///< Size of one encoded timestamp
+        static constexpr size_t HEADER_SIZE = 1 + 2 * TIMESTAMP_SIZE; ///< Version, issue time and expiry time
+        static constexpr size_t MAC_SIZE = crypto::CryptoToolKit::HASH_SIZE; ///< Size of the trailing HMAC-SHA256
+        static constexpr size_t MIN_PRUNE_THRESHOLD = 1024; ///< Revocation set size below which expired entries are kept
+
+        /// @brief Compute the HMAC of a token body
+        /// @param body Token without its trailing MAC
+        /// @return HMAC-SHA256 of the body under the signing key
+        /// @throws std::runtime_error if the HMAC cannot be computed
+        [[nodiscard]] auto sign(std::string_view body) const -> crypto::CryptoToolKit::Hash;
+
+        /// @brief Drop revocations older than the token lifetime, which no valid token can predate
+        /// @param now Current time in microseconds since the epoch
+        auto prune_revocations(int64_t now) -> void;
+
+        std::chrono::seconds ttl_;
+        crypto::CryptoToolKit::Hash key_{};
+        mutable std::shared_mutex mutex_;
+        std::unordered_map<std::string, int64_t, UsernameHash, std::equal_to<> > revoked_before_; ///< Username to revocation time in microseconds
+        size_t prune_threshold_{MIN_PRUNE_THRESHOLD};
+    };
+}
@@ -1,232 +1,748 @@
 #include "UserAuthenticator.hpp"
 
-#include "src/exception/AuthenticationException.hpp"
-#include <sstream>
+#include "CharacterClass.hpp"
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <iterator>
+#include <string_view>
+#include <glog/logging.h>
+#include <fmt/format.h>
 
 #include "crypto/CryptoToolKit.hpp"
+#include "time/RequestPhaseTimer.hpp"
 
 namespace common::auth {
-    UserAuthenticator::UserAuthenticator(const std::string &db_path, const PasswordPolicy &policy) : password_policy_(policy), password_sql_(db_path) {
+    /// @brief Timer task that periodically rebuilds the negative lookup cache
+    class UserAuthenticator::NegativeCacheRebuildTask final : public interfaces::ITimerTask {
+    public:
+        explicit NegativeCacheRebuildTask(UserAuthenticator &authenticator) noexcept : authenticator_(authenticator) {
+        }
+
+        auto execute() -> void override {
+            try {
+                authenticator_.rebuild_negative_cache();
+            } catch (const std::exception &e) {
+                // Keep serving from the previous filter, it is stale but never wrong about registered users
+                LOG(ERROR) << "Failed to rebuild negative lookup cache: " << e.what();
+            }
+        }
+
+    private:
+        UserAuthenticator &authenticator_;
+    };
+
+    /// @brief Get the heap memory owned by a string
+    /// @param value String to weigh
+    /// @return Allocated bytes, 0 for strings short enough to be stored inline
+    static auto heap_bytes(const std::string &value) noexcept -> size_t {
+        return value.capacity() > std::string().capacity() ? value.capacity() + 1 : 0;
     }
 
-    /// @brief Format credentials data (salt:hashed_password format)
-    /// @param salt Salt string
-    /// @param hashed_password Hashed password string
-    /// @return Formatted credentials string
-    auto UserAuthenticator::format_credentials_data(const std::string &salt, const std::string &hashed_password) -> std::string {
-        std::ostringstream credential_stream;
-        credential_stream << salt << ":" << hashed_password;
-        return credential_stream.str();
+    auto UserAuthenticator::CredentialWeigher::operator()(const std::string &username, const std::shared_ptr<UserCredentials> &credentials) const noexcept -> size_t {
+        if (!credentials) {
+            return heap_bytes(username);
+        }
+        // make_shared places the credentials next to a control block of two reference counts and a vtable pointer
+        return heap_bytes(username) + sizeof(UserCredentials) + 2 * sizeof(void *) + heap_bytes(credentials->get_username());
     }
 
-    bool UserAuthenticator::register_user(const std::string &username, const std::string &password) {
-        std::lock_guard lock(users_mutex_);
+    UserAuthenticator::UserAuthenticator(const std::string &db_path, const PasswordPolicy &policy, const sql::sqlite::SQLiteOptions &sqlite_options, const UserAuthenticatorOptions &options) : password_policy_(policy), password_sql_(db_path, sqlite_options), kdf_iterations_(static_cast<uint32_t>(options.kdfIterations())), lockouts_(static_cast<size_t>(options.lockoutTableSize()), static_cast<uint32_t>(policy.max_login_attempts()), std::chrono::seconds(options.lockoutDurationSec())) {
+        const auto shard_budget = std::max<size_t>(static_cast<size_t>(options.credentialCacheBytes()) / SHARD_COUNT, 1);
+        const auto expected_entries = options.credentialCacheAdmission() ? std::max<size_t>(shard_budget / TYPICAL_ENTRY_BYTES, 1) : 0;
+        for (auto &shard: shards_) {
+            shard.users = std::make_unique<CredentialCache>(shard_budget, expected_entries);
+        }
+
+        if (options.sessionTokenTtlSec() > 0) {
+            session_tokens_ = std::make_unique<SessionTokenManager>(std::chrono::seconds(options.sessionTokenTtlSec()));
+        }
+
+        if (options.kdfRehashOnLogin()) {
+            // A single worker keeps background rehashing from competing with logins for more than one core
+            rehash_executor_ = std::make_unique<thread::ThreadPool>(1, 1, REHASH_QUEUE_SIZE, std::chrono::minutes(1));
+        }
+
+        if (options.negativeCacheEnabled()) {
+            negative_cache_ = std::make_unique<NegativeLookupCache>(static_cast<uint64_t>(options.negativeCacheExpectedUsers()), options.negativeCacheFalsePositiveRate());
+        }
+
+        if (options.warmUpThreads() > 0) {
+            // One scan of the users table fills both caches
+            const auto stats = warm_up(static_cast<size_t>(options.warmUpThreads()));
+            LOG(INFO) << fmt::format("Credential cache warmed up with {} of {} users by {} threads in {}ms", stats.cached, stats.loaded, options.warmUpThreads(), stats.elapsed.count());
+        } else {
+            rebuild_negative_cache();
+        }
 
+        if (negative_cache_ && options.negativeCacheRebuildIntervalSec() > 0) {
+            negative_cache_rebuilder_ = std::make_unique<thread::PeriodicActuator>(std::make_shared<NegativeCacheRebuildTask>(*this), std::chrono::seconds(options.negativeCacheRebuildIntervalSec()));
+            negative_cache_rebuilder_->start();
+        }
+    }
+
+    auto UserAuthenticator::register_user(const std::string_view username, const std::string_view password) -> AuthResult<> {
         // Validate username format
         if (!validate_username(username)) {
-            throw exception::AuthenticationException(std::string("Invalid username format. Use alphanumeric characters, underscores, or hyphens (3-20 characters)."));
+            return std::unexpected(AuthError::InvalidUsername);
         }
 
         // Check if username already exists
-        if (users_.contains(username) || password_sql_.UserExists(username)) {
-            throw exception::AuthenticationException(std::string("Username already exists"));
+        if (user_exists(username)) {
+            return std::unexpected(AuthError::UserAlreadyExists);
         }
 
         // Validate password against policy
         if (!password_policy_.validate(password)) {
-            throw exception::AuthenticationException(std::string("Password does not meet security requirements"));
+            return std::unexpected(AuthError::WeakPassword);
         }
 
-        // Generate salt and hash password
-        auto salt = crypto::CryptoToolKit::generate_salt();
-        auto hashed_password = crypto::CryptoToolKit::hash_password(password, salt);
+        // Generate salt and hash password without holding any lock
+        const auto record = derive_credentials(password);
+        auto credentials = make_credentials(username, record);
+
+        auto &shard = shard_for(username);
+        {
+            std::unique_lock lock(shard.mutex);
+            await_writes(shard, lock, username);
 
-        // Store user credentials in database
-        const std::string credential_data = format_credentials_data(salt, hashed_password);
-        if (!password_sql_.RegisterUser(username, credential_data)) {
-            throw exception::AuthenticationException(std::string("Failed to register user in database"));
+            // Cheap early rejection; a cache miss proves nothing, the database's UNIQUE constraint decides
+            if (shard.users->contains(username)) {
+                return std::unexpected(AuthError::UserAlreadyExists);
+            }
+            begin_write(shard, username, WriteKind::Insert);
         }
 
-        // Store user credentials in memory cache
-        users_[username] = std::make_unique<UserCredentials>(username, hashed_password, salt);
-        return true;
+        // Admit the name before it becomes visible; a failed registration only costs a false positive
+        if (negative_cache_) {
+            negative_cache_->insert(username);
+        }
+
+        // Store user credentials in database; waiting for a group commit must not block the shard
+        const auto stored = password_sql_.RegisterUser(username, record);
+
+        // Admit the name again now that the row is committed, a rebuild may have scanned the table before
+        if (negative_cache_ && stored == server_app::sql::PasswordSQL::RegisterResult::Registered) {
+            negative_cache_->insert(username);
+        }
+
+        std::lock_guard lock(shard.mutex);
+        finish_write(shard, username, WriteKind::Insert);
+        if (stored == server_app::sql::PasswordSQL::RegisterResult::AlreadyExists) {
+            return std::unexpected(AuthError::UserAlreadyExists);
+        }
+        if (stored != server_app::sql::PasswordSQL::RegisterResult::Registered) {
+            return std::unexpected(AuthError::StorageFailure);
+        }
+
+        // Store user credentials in memory cache; a full cache may refuse them, they are then loaded on first use
+        static_cast<void>(shard.users->put(std::string(username), std::move(credentials)));
+        return {};
     }
 
-    bool UserAuthenticator::authenticate(const std::string &username, const std::string &password) {
-        std::lock_guard lock(users_mutex_);
+    auto UserAuthenticator::register_users(const std::vector<std::pair<std::string_view, std::string_view> > &users) -> std::vector<AuthResult<> > {
+        std::vector<AuthResult<> > results(users.size());
+
+        // Validate every entry before touching the database
+        std::vector<size_t> candidates;
+        std::vector<std::string_view> candidate_names;
+        std::unordered_map<std::string_view, size_t> first_occurrence;
+        candidates.reserve(users.size());
+        candidate_names.reserve(users.size());
+        first_occurrence.reserve(users.size());
+        for (size_t i = 0; i < users.size(); ++i) {
+            const auto &[username, password] = users[i];
+            if (!validate_username(username)) {
+                results[i] = std::unexpected(AuthError::InvalidUsername);
+            } else if (!password_policy_.validate(password)) {
+                results[i] = std::unexpected(AuthError::WeakPassword);
+            } else if (!first_occurrence.emplace(username, i).second) {
+                results[i] = std::unexpected(AuthError::UserAlreadyExists);
+            } else {
+                candidates.push_back(i);
+                candidate_names.push_back(username);
+            }
+        }
 
-        // Try to get user from memory cache first
-        auto it = users_.find(username);
-        if (it == users_.end()) {
-            // If not in cache, try to load from database
-            auto user_opt = load_user_from_db(username);
-            if (user_opt.has_value()) {
-                // Add to cache
-                users_[username] = std::make_unique<UserCredentials>(user_opt.value());
-                it = users_.find(username);
+        // Drop users that already exist with one batched lookup
+        const auto existing = users_exist(candidate_names);
+        std::vector<size_t> pending;
+        pending.reserve(candidates.size());
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            if (existing[i]) {
+                results[candidates[i]] = std::unexpected(AuthError::UserAlreadyExists);
+            } else {
+                pending.push_back(candidates[i]);
             }
         }
 
-        if (it == users_.end()) {
-            throw exception::AuthenticationException(std::string("User not found"));
+        if (pending.empty()) {
+            return results;
         }
 
-        const auto &user = it->second;
+        // Generate salts and hashes without holding any lock
+        std::vector<std::pair<std::string_view, CredentialRecord> > rows;
+        std::vector<std::shared_ptr<UserCredentials> > credentials;
+        rows.reserve(pending.size());
+        credentials.reserve(pending.size());
+        for (const auto index: pending) {
+            const auto &[username, password] = users[index];
+            const auto &[name, record] = rows.emplace_back(username, derive_credentials(password));
+            credentials.push_back(make_credentials(name, record));
+        }
 
-        // Check if account is locked
-        if (user->is_locked()) {
-            throw exception::AuthenticationException(std::string("Account is locked due to too many failed attempts. Please try again later."));
+        // Claim the users one shard at a time; cached users are rejected early, every other duplicate by the
+        // database. No two shard locks are ever held together and none is held during the database write.
+        std::array<std::vector<size_t>, SHARD_COUNT> shard_pending;
+        for (size_t i = 0; i < pending.size(); ++i) {
+            shard_pending[shard_index(users[pending[i]].first)].push_back(i);
+        }
+        std::vector<std::pair<std::string_view, CredentialRecord> > insert_rows;
+        std::array<std::vector<size_t>, SHARD_COUNT> shard_inserted;
+        std::vector<size_t> inserted;
+        insert_rows.reserve(rows.size());
+        inserted.reserve(rows.size());
+        for (size_t index = 0; index < SHARD_COUNT; ++index) {
+            if (shard_pending[index].empty()) {
+                continue;
+            }
+            auto &shard = shards_[index];
+            std::unique_lock lock(shard.mutex);
+            for (const auto i: shard_pending[index]) {
+                const auto username = users[pending[i]].first;
+                await_writes(shard, lock, username);
+                if (shard.users->contains(username)) {
+                    results[pending[i]] = std::unexpected(AuthError::UserAlreadyExists);
+                    continue;
+                }
+                begin_write(shard, username, WriteKind::Insert);
+                shard_inserted[index].push_back(inserted.size());
+                insert_rows.push_back(std::move(rows[i]));
+                inserted.push_back(i);
+            }
         }
 
-        // Verify password
-        if (const auto hashed_input = crypto::CryptoToolKit::hash_password(password, user->get_salt()); crypto::CryptoToolKit::secure_compare(hashed_input, user->get_hashed_password())) {
-            user->reset_failed_attempts();
-            return true;
+        // Admit the names before they become visible; failed registrations only cost false positives
+        if (negative_cache_) {
+            for (const auto &[username, record]: insert_rows) {
+                negative_cache_->insert(username);
+            }
         }
-        user->increment_failed_attempts();
-        throw exception::AuthenticationException(std::string("Invalid password"));
-    }
 
-    bool UserAuthenticator::change_password(const std::string &username, const std::string &current_password, const std::string &new_password) {
-        // First verify current password
-        bool auth_success = false;
-        try {
-            auth_success = authenticate(username, current_password);
-        } catch (const exception::AuthenticationException &) {
-            throw exception::AuthenticationException(std::string("Current password is incorrect"));
+        // Store all user credentials in one database transaction per database shard
+        const auto stored = password_sql_.BatchRegisterUsers(insert_rows);
+
+        // Admit the stored names again, a rebuild may have scanned the table before they were committed
+        if (negative_cache_) {
+            for (size_t row = 0; row < insert_rows.size(); ++row) {
+                if (stored[row] == server_app::sql::PasswordSQL::RegisterResult::Registered) {
+                    negative_cache_->insert(insert_rows[row].first);
+                }
+            }
+        }
+        for (size_t index = 0; index < SHARD_COUNT; ++index) {
+            if (shard_inserted[index].empty()) {
+                continue;
+            }
+            auto &shard = shards_[index];
+            std::lock_guard lock(shard.mutex);
+            for (const auto row: shard_inserted[index]) {
+                const auto position = pending[inserted[row]];
+                const auto username = users[position].first;
+                finish_write(shard, username, WriteKind::Insert);
+                if (stored[row] == server_app::sql::PasswordSQL::RegisterResult::AlreadyExists) {
+                    results[position] = std::unexpected(AuthError::UserAlreadyExists);
+                    continue;
+                }
+                if (stored[row] != server_app::sql::PasswordSQL::RegisterResult::Registered) {
+                    results[position] = std::unexpected(AuthError::StorageFailure);
+                    continue;
+                }
+                static_cast<void>(shard.users->put(std::string(username), std::move(credentials[inserted[row]])));
+            }
         }
+        return results;
+    }
 
-        // If we reach here, authentication was successful (auth_success will be true)
-        // The return value confirms successful authentication
-        if (!auth_success) {
-            // This case shouldn't happen given the authenticate implementation,
-            // but added for completeness since the function is marked [[nodiscard]]
-            throw exception::AuthenticationException(std::string("Current password is incorrect"));
+    auto UserAuthenticator::authenticate(const std::string_view username, const std::string_view password) -> AuthResult<> {
+        if (const auto verified = verify_password(username, password); !verified) {
+            return std::unexpected(verified.error());
         }
+        return {};
+    }
 
-        std::lock_guard lock(users_mutex_);
-        const auto it = users_.find(username);
-        if (it == users_.end()) {
-            throw exception::AuthenticationException(std::string("User not found"));
+    auto UserAuthenticator::change_password(const std::string_view username, const std::string_view current_password, const std::string_view new_password) -> AuthResult<> {
+        // First verify current password and remember which credentials it matched
+        const auto verified = verify_password(username, current_password);
+        if (!verified) {
+            return std::unexpected(AuthError::IncorrectCurrentPassword);
         }
 
         // Validate new password
         if (!password_policy_.validate(new_password)) {
-            throw exception::AuthenticationException(std::string("New password does not meet security requirements"));
+            return std::unexpected(AuthError::WeakNewPassword);
+        }
+
+        // Generate new salt and hash without holding any lock
+        const auto record = derive_credentials(new_password);
+        auto credentials = make_credentials(username, record);
+
+        auto &shard = shard_for(username);
+        {
+            std::unique_lock lock(shard.mutex);
+            await_writes(shard, lock, username);
+
+            // Refuse to overwrite credentials that changed or were deleted after the current password was verified
+            if (!is_current(shard, username, *verified)) {
+                return std::unexpected(AuthError::ConcurrentPasswordChange);
+            }
+            begin_write(shard, username, WriteKind::Replace);
         }
 
-        // Generate new salt and hash
-        auto salt = crypto::CryptoToolKit::generate_salt();
-        auto hashed_password = crypto::CryptoToolKit::hash_password(new_password, salt);
+        // Update credentials in database; waiting for a group commit must not block the shard
+        const auto stored = password_sql_.ResetPassword(username, record);
 
-        // Update credentials in database
-        const std::string credential_data = format_credentials_data(salt, hashed_password);
-        if (!password_sql_.ResetPassword(username, credential_data)) {
-            throw exception::AuthenticationException(std::string("Failed to update password in database"));
+        std::lock_guard lock(shard.mutex);
+        finish_write(shard, username, WriteKind::Replace);
+        if (!stored) {
+            return std::unexpected(AuthError::StorageFailure);
         }
 
         // Update credentials in memory cache
-        auto new_credentials = std::make_unique<UserCredentials>(username, hashed_password, salt);
-        it->second = std::move(new_credentials);
-        return true;
+        static_cast<void>(shard.users->put(std::string(username), std::move(credentials)));
+        revoke_session_tokens(username);
+        lockouts_.reset(username);
+        return {};
     }
 
-    bool UserAuthenticator::reset_password(const std::string &username, const std::string &new_password) {
-        std::lock_guard lock(users_mutex_);
-
+    auto UserAuthenticator::reset_password(const std::string_view username, const std::string_view new_password) -> AuthResult<> {
         // Validate new password
         if (!password_policy_.validate(new_password)) {
-            throw exception::AuthenticationException(std::string("New password does not meet security requirements"));
+            return std::unexpected(AuthError::WeakNewPassword);
+        }
+
+        // Generate new credentials without holding any lock
+        const auto record = derive_credentials(new_password);
+        auto credentials = make_credentials(username, record);
+
+        auto &shard = shard_for(username);
+        {
+            std::unique_lock lock(shard.mutex);
+            await_writes(shard, lock, username);
+            begin_write(shard, username, WriteKind::Replace);
         }
 
-        // Generate new credentials
-        auto salt = crypto::CryptoToolKit::generate_salt();
-        auto hashed_password = crypto::CryptoToolKit::hash_password(new_password, salt);
+        // Update credentials in database; waiting for a group commit must not block the shard
+        const auto stored = password_sql_.ResetPassword(username, record);
 
-        // Update credentials in database
-        const std::string credential_data = format_credentials_data(salt, hashed_password);
-        if (!password_sql_.ResetPassword(username, credential_data)) {
-            throw exception::AuthenticationException(std::string("Failed to reset password in database"));
+        std::lock_guard lock(shard.mutex);
+        finish_write(shard, username, WriteKind::Replace);
+        if (!stored) {
+            return std::unexpected(AuthError::StorageFailure);
         }
 
         // Update credentials in memory cache or add if not exists
-        auto new_credentials = std::make_unique<UserCredentials>(username, hashed_password, salt);
-        users_[username] = std::move(new_credentials);
-        return true;
+        static_cast<void>(shard.users->put(std::string(username), std::move(credentials)));
+        revoke_session_tokens(username);
+        lockouts_.reset(username);
+        return {};
     }
 
-    bool UserAuthenticator::delete_user(const std::string &username) {
-        std::lock_guard lock(users_mutex_);
+    bool UserAuthenticator::delete_user(const std::string_view username) {
+        auto &shard = shard_for(username);
+        {
+            std::unique_lock lock(shard.mutex);
+            await_writes(shard, lock, username);
+            begin_write(shard, username, WriteKind::Replace);
+        }
+
+        // Delete from database; waiting for a group commit must not block the shard
+        const auto deleted = password_sql_.DeleteUser(username);
 
-        // Delete from database
-        if (!password_sql_.DeleteUser(username)) {
+        std::lock_guard lock(shard.mutex);
+        finish_write(shard, username, WriteKind::Replace);
+        if (!deleted) {
             return false;
         }
 
         // Delete from memory cache
-        users_.erase(username);
+        static_cast<void>(shard.users->remove(username));
+        revoke_session_tokens(username);
+        lockouts_.reset(username);
         return true;
     }
 
-    bool UserAuthenticator::user_exists(const std::string &username) const {
-        std::lock_guard lock(users_mutex_);
+    bool UserAuthenticator::user_exists(const std::string_view username) {
+        // Existence and credentials come from the same row, so a miss is answered and cached with one query
+        return find_or_load_user(username).credentials != nullptr;
+    }
+
+    auto UserAuthenticator::users_exist(const std::vector<std::string_view> &usernames) const -> std::vector<bool> {
+        std::vector<bool> exists(usernames.size(), false);
+
         // Check in memory cache first
-        if (users_.contains(username)) {
-            return true;
+        std::vector<std::string_view> misses;
+        std::vector<size_t> miss_positions;
+        for (size_t i = 0; i < usernames.size(); ++i) {
+            const auto &shard = shard_for(usernames[i]);
+            std::lock_guard lock(shard.mutex);
+            if (shard.users->get(usernames[i]).has_value()) {
+                exists[i] = true;
+            } else if (!definitely_absent(usernames[i])) {
+                misses.push_back(usernames[i]);
+                miss_positions.push_back(i);
+            }
+        }
+
+        if (misses.empty()) {
+            return exists;
         }
-        // Check in database
-        return password_sql_.UserExists(username);
+
+        // Check the remaining users in database
+        const auto found = password_sql_.BatchUserExists(misses);
+        for (size_t i = 0; i < misses.size(); ++i) {
+            exists[miss_positions[i]] = found[i];
+            if (!found[i] && negative_cache_) {
+                negative_cache_->record_false_positive();
+            }
+        }
+        return exists;
     }
 
     void UserAuthenticator::set_password_policy(const PasswordPolicy &policy) {
         password_policy_ = policy;
     }
 
-    auto UserAuthenticator::validate_username(const std::string &username) noexcept -> bool {
-        // Allow letters, numbers, underscores, hyphens; 3-20 characters
-        const std::regex username_pattern("^[a-zA-Z0-9_-]{3,20}$");
-        return std::regex_match(username, username_pattern);
+    auto UserAuthenticator::authenticate_session(const std::string_view username, const std::string_view password) -> AuthResult<std::optional<SessionTokenManager::IssuedToken> > {
+        std::optional<SessionTokenManager::IssuedToken> issued_token;
+        if (const auto verified = verify_password(username, password, &issued_token); !verified) {
+            return std::unexpected(verified.error());
+        }
+        return issued_token;
     }
 
-    /// @brief Parse credentials data (salt:hashed_password format)
-    /// @param credentials_data Raw credentials data from database
-    /// @return Parsed salt and hashed password pair, nullopt if invalid format
-    auto UserAuthenticator::parse_credentials_data(const std::string &credentials_data) -> std::optional<std::pair<std::string, std::string> > {
-        const size_t delimiter_pos = credentials_data.find(':');
-        if (delimiter_pos == std::string::npos) {
+    auto UserAuthenticator::validate_session_token(const std::string_view token) const -> std::optional<SessionTokenManager::Claims> {
+        if (!session_tokens_) {
             return std::nullopt;
         }
+        return session_tokens_->validate(token);
+    }
 
-        const std::string salt = credentials_data.substr(0, delimiter_pos);
-        const std::string hashed_password = credentials_data.substr(delimiter_pos + 1);
-        return std::make_pair(salt, hashed_password);
+    auto UserAuthenticator::revoke_session_tokens(const std::string_view username) -> void {
+        if (session_tokens_) {
+            session_tokens_->revoke(username);
+        }
     }
 
-    auto UserAuthenticator::load_user_from_db(const std::string &username) const -> std::optional<UserCredentials> {
-        if (!password_sql_.UserExists(username)) {
-            return std::nullopt;
+    auto UserAuthenticator::rebuild_negative_cache() -> void {
+        if (!negative_cache_) {
+            return;
         }
 
-        const std::string credentials_data = password_sql_.GetUser(username);
-        if (credentials_data.empty()) {
-            return std::nullopt;
+        rebuild_negative_cache_from([this] { return password_sql_.LoadAllUsernames(); });
+    }
+
+    auto UserAuthenticator::warm_up(const size_t threads) -> WarmUpStats {
+        const auto started = std::chrono::steady_clock::now();
+
+        // Rows read while credentials of their shard change are not cached, like lookups racing with a change
+        std::array<uint64_t, SHARD_COUNT> observed_generations{};
+        for (size_t i = 0; i < SHARD_COUNT; ++i) {
+            std::lock_guard lock(shards_[i].mutex);
+            observed_generations[i] = shards_[i].generation;
         }
 
-        // Parse credentials data (salt:hashed_password)
-        const auto parsed_credentials = parse_credentials_data(credentials_data);
-        if (!parsed_credentials.has_value()) {
+        // Split the row id range of every shard so all threads have work even with few shards
+        struct IdRange {
+            size_t database_shard;
+            int64_t first_id;
+            int64_t last_id;
+        };
+        const auto thread_count = std::max<size_t>(threads, 1);
+        const auto chunks_per_shard = std::max<size_t>(thread_count / password_sql_.ShardCount(), 1);
+        std::vector<IdRange> ranges;
+        for (size_t shard = 0; shard < password_sql_.ShardCount(); ++shard) {
+            const auto id_range = password_sql_.UserIdRange(shard);
+            if (!id_range) {
+                continue;
+            }
+            const auto [first_id, last_id] = *id_range;
+            const auto chunk_span = (last_id - first_id) / static_cast<int64_t>(chunks_per_shard) + 1;
+            for (auto chunk_first = first_id; chunk_first <= last_id; chunk_first += chunk_span) {
+                ranges.push_back({shard, chunk_first, std::min(last_id, chunk_first + chunk_span - 1)});
+            }
+        }
+
+        WarmUpStats stats;
+        std::vector<std::vector<std::string> > chunk_usernames(std::max<size_t>(ranges.size(), 1));
+        std::atomic<size_t> cached{0};
+        if (!ranges.empty()) {
+            // Declared after everything the chunks write to, so its destructor waits for them first
+            thread::ThreadPool loaders(thread_count, thread_count, ranges.size(), std::chrono::seconds(1));
+            std::vector<std::future<size_t> > chunks;
+            for (size_t chunk = 0; chunk < ranges.size(); ++chunk) {
+                chunks.push_back(loaders.submit([this, range = ranges[chunk], &usernames = chunk_usernames[chunk], &cached, &observed_generations] {
+                    return password_sql_.LoadCredentialsRange(range.database_shard, range.first_id, range.last_id, [&](std::string username, const CredentialRecord &record) {
+                        auto credentials = make_credentials(username, record);
+                        const auto index = shard_index(username);
+                        auto &shard = shards_[index];
+                        {
+                            std::lock_guard lock(shard.mutex);
+                            if (shard.generation == observed_generations[index] && !shard.users->contains(username) && shard.users->put(username, std::move(credentials))) {
+                                cached.fetch_add(1, std::memory_order_relaxed);
+                            }
+                        }
+                        if (negative_cache_) {
+                            usernames.push_back(std::move(username));
+                        }
+                    });
+                }));
+            }
+            for (auto &chunk: chunks) {
+                stats.loaded += chunk.get();
+            }
+        }
+        stats.cached = cached.load(std::memory_order_relaxed);
+        stats.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+
+        if (negative_cache_) {
+            rebuild_negative_cache_from([&chunk_usernames] {
+                std::vector<std::string> usernames = std::move(chunk_usernames.front());
+                for (size_t chunk = 1; chunk < chunk_usernames.size(); ++chunk) {
+                    std::ranges::move(chunk_usernames[chunk], std::back_inserter(usernames));
+                }
+                return usernames;
+            });
+        }
+        return stats;
+    }
+
+    auto UserAuthenticator::rebuild_negative_cache_from(const std::function<std::vector<std::string>()> &load_usernames) -> void {
+        const auto started = std::chrono::steady_clock::now();
+        negative_cache_->rebuild(load_usernames);
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+
+        const auto stats = negative_cache_->stats();
+        LOG(INFO) << fmt::format("Negative lookup cache rebuilt with {} users in {}ms (estimated false positive rate: {:.4f}, hits: {}, misses: {}, false positives: {})", stats.element_count, elapsed.count(), stats.estimated_false_positive_rate, stats.hits, stats.misses, stats.false_positives);
+    }
+
+    auto UserAuthenticator::negative_cache_stats() const -> std::optional<NegativeLookupCache::Stats> {
+        if (!negative_cache_) {
             return std::nullopt;
         }
+        return negative_cache_->stats();
+    }
+
+    auto UserAuthenticator::credential_cache_stats() const -> cache::CacheStats {
+        cache::CacheStats stats;
+        for (const auto &shard: shards_) {
+            std::lock_guard lock(shard.mutex);
+            stats += shard.users->stats();
+        }
+        return stats;
+    }
 
-        const auto &[salt, hashed_password] = parsed_credentials.value();
-        return UserCredentials(username, hashed_password, salt);
+    auto UserAuthenticator::definitely_absent(const std::string_view username) const -> bool {
+        return negative_cache_ && !negative_cache_->might_contain(username);
     }
 
-    auto UserAuthenticator::get_users() -> std::unordered_map<std::string, std::unique_ptr<UserCredentials> > & {
-        return users_;
+    auto UserAuthenticator::validate_username(const std::string_view username) noexcept -> bool {
+        // Allow letters, numbers, underscores, hyphens; 3-20 characters
+        return username.length() >= MIN_USERNAME_LENGTH && username.length() <= MAX_USERNAME_LENGTH && all_of_class(username, UsernameChar);
     }
 
-    auto UserAuthenticator::get_users_mutex() const -> std::mutex & {
-        return users_mutex_;
+    auto UserAuthenticator::load_user_from_db(const std::string_view username) const -> std::optional<CredentialRecord> {
+        return password_sql_.GetCredentials(username);
+    }
+
+    auto UserAuthenticator::shard_index(const std::string_view username) noexcept -> size_t {
+        return UsernameHash{}(username) % SHARD_COUNT;
+    }
+
+    auto UserAuthenticator::shard_for(const std::string_view username) const noexcept -> UserShard & {
+        return shards_[shard_index(username)];
+    }
+
+    auto UserAuthenticator::make_credentials(const std::string_view username, const CredentialRecord &record) -> std::shared_ptr<UserCredentials> {
+        return std::make_shared<UserCredentials>(std::string(username), record, next_version_.fetch_add(1, std::memory_order_relaxed));
+    }
+
+    auto UserAuthenticator::derive_credentials(const std::string_view password) const -> CredentialRecord {
+        const time::ScopedPhaseTimer phase_timer(time::RequestPhase::KeyDerivation);
+        CredentialRecord record;
+        record.kdf_id = KdfId::Pbkdf2HmacSha256;
+        record.iterations = kdf_iterations_;
+        record.salt = crypto::CryptoToolKit::generate_salt();
+        record.hash = crypto::CryptoToolKit::hash_password(password, record.salt, record.iterations);
+        return record;
+    }
+
+    auto UserAuthenticator::await_writes(UserShard &shard, std::unique_lock<std::mutex> &lock, const std::string_view username) -> void {
+        shard.write_done.wait(lock, [&shard, username] { return !shard.writes_in_flight.contains(username); });
+    }
+
+    auto UserAuthenticator::begin_write(UserShard &shard, const std::string_view username, const WriteKind kind) -> void {
+        shard.writes_in_flight.emplace(username);
+        if (kind == WriteKind::Replace) {
+            ++shard.generation;
+        }
+    }
+
+    auto UserAuthenticator::finish_write(UserShard &shard, const std::string_view username, const WriteKind kind) -> void {
+        if (const auto it = shard.writes_in_flight.find(username); it != shard.writes_in_flight.end()) {
+            shard.writes_in_flight.erase(it);
+        }
+        if (kind == WriteKind::Replace) {
+            ++shard.generation;
+        }
+        shard.write_done.notify_all();
+    }
+
+    auto UserAuthenticator::find_or_load_user(const std::string_view username) -> CredentialSnapshot {
+        auto &shard = shard_for(username);
+        uint64_t observed_generation = 0;
+        {
+            std::lock_guard lock(shard.mutex);
+            observed_generation = shard.generation;
+            if (auto cached = shard.users->get(username)) {
+                return {std::move(*cached), observed_generation};
+            }
+        }
+
+        // Unknown usernames are answered by the negative lookup cache
+        if (definitely_absent(username)) {
+            return {nullptr, observed_generation};
+        }
+
+        // Cache miss: read from the database without blocking the shard
+        const auto user_opt = load_user_from_db(username);
+        if (!user_opt.has_value()) {
+            if (negative_cache_) {
+                negative_cache_->record_false_positive();
+            }
+            return {nullptr, observed_generation};
+        }
+        auto loaded = make_credentials(username, *user_opt);
+
+        std::lock_guard lock(shard.mutex);
+        if (auto cached = shard.users->peek(username)) {
+            return {std::move(*cached), observed_generation};
+        }
+        // Only cache the row if nothing in this shard was replaced or deleted while it was being read;
+        // a full cache may still refuse it
+        if (shard.generation == observed_generation) {
+            static_cast<void>(shard.users->put(std::string(username), loaded));
+        }
+        return {std::move(loaded), observed_generation};
+    }
+
+    auto UserAuthenticator::is_current(const UserShard &shard, const std::string_view username, const CredentialSnapshot &snapshot) -> bool {
+        // A cached entry is authoritative; it may be another object for the same credentials if they were evicted and loaded again
+        if (const auto cached = shard.users->peek(username)) {
+            const auto &current = **cached;
+            return &current == snapshot.credentials.get() || (current.get_salt() == snapshot.credentials->get_salt() && current.get_hashed_password() == snapshot.credentials->get_hashed_password());
+        }
+        // Evicted or never admitted: every replacement and deletion, but no registration, bumps the generation under the shard lock
+        return shard.generation == snapshot.generation;
+    }
+
+    auto UserAuthenticator::verify_password(const std::string_view username, const std::string_view password, std::optional<SessionTokenManager::IssuedToken> *const issued_token) -> AuthResult<CredentialSnapshot> {
+        // Locked usernames are rejected before any cache, database or key derivation work
+        if (lockouts_.is_locked(username)) {
+            return std::unexpected(AuthError::AccountLocked);
+        }
+
+        auto &shard = shard_for(username);
+        for (size_t attempt = 0; attempt < MAX_VERIFY_ATTEMPTS; ++attempt) {
+            const auto snapshot = find_or_load_user(username);
+            const auto &user = snapshot.credentials;
+            if (!user) {
+                // Guessing against unknown usernames counts too, so enumeration is throttled like guessing
+                lockouts_.record_failure(username);
+                return std::unexpected(AuthError::UserNotFound);
+            }
+
+            if (user->get_kdf_id() != KdfId::Pbkdf2HmacSha256) {
+                return std::unexpected(AuthError::UnsupportedKdf);
+            }
+
+            // Salt and hash are immutable for a given credentials object, so derivation runs unlocked
+            crypto::CryptoToolKit::Hash hashed_input;
+            {
+                const time::ScopedPhaseTimer phase_timer(time::RequestPhase::KeyDerivation);
+                hashed_input = crypto::CryptoToolKit::hash_password(password, user->get_salt(), user->get_iterations());
+            }
+
+            std::lock_guard lock(shard.mutex);
+            if (!is_current(shard, username, snapshot)) {
+                // Credentials were replaced or deleted while hashing, verify against the current state
+                continue;
+            }
+
+            if (crypto::CryptoToolKit::secure_compare(hashed_input, user->get_hashed_password())) {
+                const CredentialSnapshot verified{user, shard.generation};
+                lockouts_.reset(username);
+                if (needs_rehash(*user)) {
+                    schedule_rehash(username, password, verified);
+                }
+                if (issued_token && session_tokens_) {
+                    *issued_token = session_tokens_->issue(username);
+                }
+                return verified;
+            }
+            lockouts_.record_failure(username);
+            return std::unexpected(AuthError::InvalidPassword);
+        }
+        return std::unexpected(AuthError::CredentialsChanged);
+    }
+
+    auto UserAuthenticator::needs_rehash(const UserCredentials &credentials) const noexcept -> bool {
+        return rehash_executor_ && (credentials.get_kdf_id() != KdfId::Pbkdf2HmacSha256 || credentials.get_iterations() != kdf_iterations_);
+    }
+
+    auto UserAuthenticator::schedule_rehash(const std::string_view username, const std::string_view password, const CredentialSnapshot &verified) -> void {
+        // Concurrent logins of the same user share one rehash
+        if (!verified.credentials->claim_rehash()) {
+            return;
+        }
+        // The views refer to the caller's request, the background task needs its own copies
+        if (!rehash_executor_->trySubmit([this, username = std::string(username), password = std::string(password), verified] { rehash(username, password, verified); })) {
+            // Saturated, a later login retries
+            verified.credentials->release_rehash();
+        }
+    }
+
+    auto UserAuthenticator::rehash(const std::string_view username, const std::string_view password, const CredentialSnapshot &verified) -> void {
+        try {
+            // Derive the new key before taking the shard lock, exactly like a password change
+            const auto record = derive_credentials(password);
+            auto credentials = make_credentials(username, record);
+
+            auto &shard = shard_for(username);
+            {
+                std::unique_lock lock(shard.mutex);
+                await_writes(shard, lock, username);
+                if (!is_current(shard, username, verified)) {
+                    // Changed, reset or deleted since the login, the new credentials already reflect that
+                    return;
+                }
+                begin_write(shard, username, WriteKind::Replace);
+            }
+
+            const auto previous_iterations = verified.credentials->get_iterations();
+            const auto stored = password_sql_.ResetPassword(username, record);
+
+            std::lock_guard lock(shard.mutex);
+            finish_write(shard, username, WriteKind::Replace);
+            if (!stored) {
+                LOG(WARNING) << "Failed to store rehashed credentials of user " << username;
+                verified.credentials->release_rehash();
+                return;
+            }
+            static_cast<void>(shard.users->put(std::string(username), std::move(credentials)));
+            LOG(INFO) << fmt::format("Rehashed credentials of user {} from {} to {} iterations", username, previous_iterations, record.iterations);
+        } catch (const std::exception &e) {
+            LOG(ERROR) << "Failed to rehash credentials of user " << username << ": " << e.what();
+        }
     }
 } // common
@@ -1,98 +1,334 @@
 #pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <mutex>
-#include <regex>
+#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <optional>
+#include <utility>
+#include <vector>
 
+#include "AuthError.hpp"
+#include "LockoutTable.hpp"
+#include "NegativeLookupCache.hpp"
 #include "PasswordPolicy.hpp"
+#include "SessionTokenManager.hpp"
+#include "UserAuthenticatorOptions.hpp"
 #include "UserCredentials.hpp"
+#include "src/cache/WeightedLRUCache.hpp"
 #include "src/sql/PasswordSQL.hpp"
+#include "src/thread/PeriodicActuator.hpp"
+#include "src/thread/ThreadPool.hpp"
 
 namespace common::auth {
     /// @brief Main authentication class providing user management and verification
+    /// @details The in-memory credential cache is split into shards selected by username hash, each
+    /// guarded by its own mutex and bounded by an equal share of a memory budget. When a shard is full,
+    /// a new user is only admitted if it is looked up more often than the least recently used users it
+    /// would evict, so a burst of one-off logins cannot flush the regular ones. Password hashing never
+    /// runs while a shard lock is held; instead the credentials observed before hashing are re-checked
+    /// when the result is applied, against the cache or, for users that are not cached, against the
+    /// shard's count of replaced and deleted credentials. Database writes, which may wait for a group
+    /// commit, run without the shard lock as well: the user is claimed before the write and released
+    /// after it, so writes of the same user stay ordered while the rest of the shard is served. Usernames
+    /// missing from the cache are first checked against a Bloom filter of all existing usernames, so
+    /// lookups of unknown users are answered without touching the database. Every credential records
+    /// the key derivation function and cost it was hashed with; a successful login against anything
+    /// other than the configured target schedules a background rehash with the plaintext just verified.
+    /// Failed logins are counted per username in a lock-free table that also covers unknown usernames,
+    /// so locked usernames are rejected before any shard, database or key derivation work.
+    /// Authenticated users can be issued session tokens, which are validated without any key derivation
+    /// and revoked whenever the user's password changes or the user is deleted. Rejections caused by the
+    /// caller are returned as AuthError values; exceptions are reserved for system failures.
     class UserAuthenticator {
     public:
+        /// @brief Outcome of preloading the caches from the users table
+        struct WarmUpStats {
+            size_t loaded{0}; ///< Users read from the database
+            size_t cached{0}; ///< Users admitted to the credential cache
+            std::chrono::milliseconds elapsed{0}; ///< Time the scan took
+        };
+
         /// @brief Constructor with database path and optional custom password policy
         /// @param db_path Path to SQLite database file
         /// @param policy Custom password policy (default: standard policy)
-        explicit UserAuthenticator(const std::string &db_path, const PasswordPolicy &policy = PasswordPolicy());
+        /// @param sqlite_options Connection pragmas and reader pool configuration
+        /// @param options Negative lookup cache, key derivation, session token, lockout and warm-up configuration
+        /// @throws std::runtime_error if the caches cannot be loaded from the database
+        /// @details With warm-up threads configured the credential cache is preloaded before the constructor returns.
+        explicit UserAuthenticator(const std::string &db_path, const PasswordPolicy &policy = PasswordPolicy(), const sql::sqlite::SQLiteOptions &sqlite_options = sql::sqlite::SQLiteOptions(), const UserAuthenticatorOptions &options = UserAuthenticatorOptions());
 
         /// @brief Register new user with username and password
         /// @param username User identifier to register
         /// @param password Plaintext password for new account
-        /// @return true if registration successful
-        /// @throws AuthenticationException if username invalid, exists, or password fails policy
-        [[nodiscard]] bool register_user(const std::string &username, const std::string &password);
+        /// @return Nothing on success, InvalidUsername, UserAlreadyExists, WeakPassword or StorageFailure otherwise
+        [[nodiscard]] auto register_user(std::string_view username, std::string_view password) -> AuthResult<>;
 
         /// @brief Authenticate user with username and password
         /// @param username User identifier
         /// @param password Plaintext password to verify
-        /// @return true if authentication successful
-        /// @throws AuthenticationException if user not found, password incorrect, or account locked
-        [[nodiscard]] bool authenticate(const std::string &username, const std::string &password);
+        /// @return Nothing on success, UserNotFound, AccountLocked, InvalidPassword or another AuthError otherwise
+        [[nodiscard]] auto authenticate(std::string_view username, std::string_view password) -> AuthResult<>;
 
         /// @brief Change user password after verifying current password
         /// @param username User identifier
         /// @param current_password Current plaintext password for verification
         /// @param new_password New plaintext password to set
-        /// @return true if password changed successfully
-        /// @throws AuthenticationException if current password incorrect or new password fails policy
-        [[nodiscard]] bool change_password(const std::string &username, const std::string &current_password, const std::string &new_password);
+        /// @return Nothing on success, IncorrectCurrentPassword, WeakNewPassword or another AuthError otherwise
+        [[nodiscard]] auto change_password(std::string_view username, std::string_view current_password, std::string_view new_password) -> AuthResult<>;
 
         /// @brief Reset user password (administrative function)
         /// @param username User identifier
         /// @param new_password New plaintext password to set
-        /// @return true if password reset successful
-        /// @throws AuthenticationException if user not found or new password fails policy
-        [[nodiscard]] bool reset_password(const std::string &username, const std::string &new_password);
+        /// @return Nothing on success, WeakNewPassword or StorageFailure otherwise
+        [[nodiscard]] auto reset_password(std::string_view username, std::string_view new_password) -> AuthResult<>;
 
         /// @brief Check if user exists in the system
         /// @param username User identifier to check
         /// @return true if user exists, false otherwise
-        [[nodiscard]] bool user_exists(const std::string &username) const;
+        /// @details A cache miss loads the user's credentials with a single query and caches them, so a
+        /// login following the check does not read the database again.
+        [[nodiscard]] bool user_exists(std::string_view username);
+
+        /// @brief Register several users, persisting all of them in one database transaction
+        /// @param users Username and plaintext password pairs to register
+        /// @return Outcome of each registration, in input order
+        /// @details Entries are validated and hashed independently, so one invalid entry does not fail the batch.
+        [[nodiscard]] auto register_users(const std::vector<std::pair<std::string_view, std::string_view> > &users) -> std::vector<AuthResult<> >;
+
+        /// @brief Check which of several users exist
+        /// @param usernames User identifiers to check
+        /// @return Existence of each user, in input order
+        /// @details Cached users are answered from memory, the rest with a single database round trip.
+        [[nodiscard]] auto users_exist(const std::vector<std::string_view> &usernames) const -> std::vector<bool>;
 
         /// @brief Delete user from the system
         /// @param username User identifier to delete
         /// @return true if user deleted successfully
-        [[nodiscard]] bool delete_user(const std::string &username);
+        [[nodiscard]] bool delete_user(std::string_view username);
 
         /// @brief Set custom password policy
         /// @param policy New password policy configuration
         void set_password_policy(const PasswordPolicy &policy);
 
-        /// @brief Get reference to the users map for administrative operations
-        /// @return Reference to the users map
-        auto get_users() -> std::unordered_map<std::string, std::unique_ptr<UserCredentials> > &;
+        /// @brief Authenticate user with username and password and issue a session token
+        /// @param username User identifier
+        /// @param password Plaintext password to verify
+        /// @return Signed token and its expiry, nullopt if session tokens are disabled, or why authentication failed
+        /// @details The token is issued under the same lock that password changes take, so it can never
+        /// escape the revocation of a change that raced with the login.
+        [[nodiscard]] auto authenticate_session(std::string_view username, std::string_view password) -> AuthResult<std::optional<SessionTokenManager::IssuedToken> >;
+
+        /// @brief Validate a session token without touching the database
+        /// @param token Token returned by authenticate_session
+        /// @return Claims of the token, nullopt if it is invalid, expired, revoked or tokens are disabled
+        [[nodiscard]] auto validate_session_token(std::string_view token) const -> std::optional<SessionTokenManager::Claims>;
+
+        /// @brief Rebuild the negative lookup cache from the users table
+        /// @throws std::runtime_error if the users cannot be loaded
+        /// @details Runs periodically when a rebuild interval is configured, which is how deleted users
+        /// leave the filter. Does nothing when the cache is disabled.
+        auto rebuild_negative_cache() -> void;
 
-        /// @brief Get reference to the mutex protecting the users map
-        /// @return Reference to the users mutex
-        auto get_users_mutex() const -> std::mutex &;
+        /// @brief Preload the credential cache and the negative lookup cache from the users table
+        /// @param threads Number of row id ranges read in parallel, at least one
+        /// @return Number of users read and cached, and the time the scan took
+        /// @throws std::runtime_error if the users cannot be loaded
+        /// @details The row ids of every database shard are split into ranges, each streamed on its
+        /// own reader connection, so the useful thread count is bounded by the total reader count. Users already cached are kept, and a shard whose
+        /// credentials change during the scan keeps none of the scanned rows. When the table exceeds
+        /// the cache budget only part of it stays cached; the negative lookup cache always receives
+        /// every username, replacing the separate username scan of rebuild_negative_cache.
+        auto warm_up(size_t threads) -> WarmUpStats;
+
+        /// @brief Get the negative lookup cache counters
+        /// @return Cache counters, nullopt if the cache is disabled
+        [[nodiscard]] auto negative_cache_stats() const -> std::optional<NegativeLookupCache::Stats>;
+
+        /// @brief Get the credential cache counters, summed over all shards
+        /// @return Hit, eviction and admission counters and the estimated memory held
+        [[nodiscard]] auto credential_cache_stats() const -> cache::CacheStats;
 
     private:
+        /// @brief Number of independently locked credential shards
+        static constexpr size_t SHARD_COUNT = 64;
+
+        /// @brief Maximum attempts to verify a password while its credentials keep changing
+        static constexpr size_t MAX_VERIFY_ATTEMPTS = 3;
+
+        /// @brief Maximum number of pending background rehashes; further ones are retried on a later login
+        static constexpr size_t REHASH_QUEUE_SIZE = 64;
+
+        /// @brief Minimum username length
+        static constexpr size_t MIN_USERNAME_LENGTH = 3;
+
+        /// @brief Maximum username length
+        static constexpr size_t MAX_USERNAME_LENGTH = 20;
+
+        /// @brief Typical bytes charged for one cached user, used to size the admission sketch
+        static constexpr size_t TYPICAL_ENTRY_BYTES = 256;
+
+        /// @brief Estimates the memory a cached user holds besides the cache's own nodes
+        struct CredentialWeigher {
+            [[nodiscard]] auto operator()(const std::string &username, const std::shared_ptr<UserCredentials> &credentials) const noexcept -> size_t;
+        };
+
+        /// @brief Transparent hash so cached users can be looked up by std::string_view
+        struct UsernameHash {
+            using is_transparent = void;
+
+            auto operator()(const std::string_view username) const noexcept -> size_t {
+                return std::hash<std::string_view>{}(username);
+            }
+        };
+
+        using CredentialCache = cache::WeightedLRUCache<std::string, std::shared_ptr<UserCredentials>, CredentialWeigher, UsernameHash, std::equal_to<> >;
+
+        /// @brief Slice of the credential cache guarded by its own mutex
+        struct UserShard {
+            mutable std::mutex mutex;
+            std::unique_ptr<CredentialCache> users;
+            uint64_t generation{0}; ///< Bumped whenever credentials are replaced or deleted, so lock-free loads and verifications can detect races
+            std::unordered_set<std::string, UsernameHash, std::equal_to<> > writes_in_flight; ///< Users whose database write runs without the shard lock
+            std::condition_variable write_done; ///< Signalled whenever a write in flight completes
+        };
+
+        /// @brief Credentials as observed by a lookup
+        struct CredentialSnapshot {
+            std::shared_ptr<UserCredentials> credentials; ///< Null if the user does not exist
+            uint64_t generation; ///< Shard generation observed by the lookup
+        };
+
+        /// @brief Select the index of the shard responsible for a username
+        /// @param username User identifier
+        /// @return Index into the shard array
+        [[nodiscard]] static auto shard_index(std::string_view username) noexcept -> size_t;
+
+        /// @brief Select the shard responsible for a username
+        /// @param username User identifier
+        /// @return Shard holding the user's cached credentials
+        [[nodiscard]] auto shard_for(std::string_view username) const noexcept -> UserShard &;
+
+        /// @brief Create credentials stamped with a fresh version
+        /// @param username User identifier
+        /// @param record Salt, hash and key derivation parameters
+        /// @return Newly allocated credentials
+        [[nodiscard]] auto make_credentials(std::string_view username, const CredentialRecord &record) -> std::shared_ptr<UserCredentials>;
+
+        /// @brief Hash a password with a fresh salt and the target key derivation parameters
+        /// @param password Plaintext password
+        /// @return Credential record ready to be stored
+        /// @throws AuthenticationException if salt generation or hashing fails
+        [[nodiscard]] auto derive_credentials(std::string_view password) const -> CredentialRecord;
+
+        /// @brief Check whether credentials were hashed with other parameters than the target
+        /// @param credentials Credentials to check
+        /// @return true if the credentials should be rehashed
+        [[nodiscard]] auto needs_rehash(const UserCredentials &credentials) const noexcept -> bool;
+
+        /// @brief Queue a background rehash of credentials the password was just verified against
+        /// @param username User identifier
+        /// @param password Verified plaintext password
+        /// @param verified Verified credentials, whose shard lock must be held
+        auto schedule_rehash(std::string_view username, std::string_view password, const CredentialSnapshot &verified) -> void;
+
+        /// @brief Rehash a verified password with the target parameters and store it
+        /// @param username User identifier
+        /// @param password Verified plaintext password
+        /// @param verified Credentials the password was verified against
+        /// @details Nothing is stored if the credentials changed since they were verified.
+        auto rehash(std::string_view username, std::string_view password, const CredentialSnapshot &verified) -> void;
+
+        /// @brief Wait until no database write of the user is in flight
+        /// @param shard Shard responsible for the user
+        /// @param lock Held lock of the shard, released while waiting
+        /// @param username User identifier
+        static auto await_writes(UserShard &shard, std::unique_lock<std::mutex> &lock, std::string_view username) -> void;
+
+        /// @brief Kind of database write claimed by begin_write
+        enum class WriteKind {
+            Insert, ///< Adds a new user; nothing observed earlier can become stale
+            Replace ///< Replaces or deletes existing credentials
+        };
+
+        /// @brief Claim the user for a database write that runs without the shard lock
+        /// @param shard Shard responsible for the user, whose lock must be held
+        /// @param username User identifier
+        /// @param kind Whether the write inserts a new user or replaces existing credentials
+        /// @details Other writes of the user wait in await_writes until finish_write. A replacement
+        /// bumps the generation, so lookups and verifications that raced with it detect the change;
+        /// registrations leave it alone and never invalidate unrelated logins of the shard.
+        static auto begin_write(UserShard &shard, std::string_view username, WriteKind kind) -> void;
+
+        /// @brief Release the claim of begin_write once the database write completed
+        /// @param shard Shard responsible for the user, whose lock must be held
+        /// @param username User identifier
+        /// @param kind Kind passed to begin_write
+        /// @details A replacement bumps the generation again, so rows loaded while it was in flight are not cached.
+        static auto finish_write(UserShard &shard, std::string_view username, WriteKind kind) -> void;
+
+        /// @brief Get cached credentials, loading them from the database on a cache miss
+        /// @param username User identifier
+        /// @return Credentials, null if the user does not exist, and the shard generation observed before the lookup
+        [[nodiscard]] auto find_or_load_user(std::string_view username) -> CredentialSnapshot;
+
+        /// @brief Check whether credentials observed earlier are still the user's current ones
+        /// @param shard Shard responsible for the user, whose lock must be held
+        /// @param username User identifier
+        /// @param snapshot Credentials and shard generation observed earlier
+        /// @return true if the credentials were neither replaced nor deleted since they were observed
+        [[nodiscard]] static auto is_current(const UserShard &shard, std::string_view username, const CredentialSnapshot &snapshot) -> bool;
+
+        /// @brief Verify a password without holding any shard lock during key derivation
+        /// @param username User identifier
+        /// @param password Plaintext password to verify
+        /// @param issued_token Receives a session token if not null and session tokens are enabled
+        /// @return Credentials the password was verified against and the shard generation at that time, or why verification failed
+        [[nodiscard]] auto verify_password(std::string_view username, std::string_view password, std::optional<SessionTokenManager::IssuedToken> *issued_token = nullptr) -> AuthResult<CredentialSnapshot>;
+
+        /// @brief Rebuild the negative lookup cache and log how long it took
+        /// @param load_usernames Returns every existing username
+        auto rebuild_negative_cache_from(const std::function<std::vector<std::string>()> &load_usernames) -> void;
+
+        /// @brief Revoke every session token issued to a user so far
+        /// @param username User identifier
+        auto revoke_session_tokens(std::string_view username) -> void;
+
+        /// @brief Timer task that periodically rebuilds the negative lookup cache
+        class NegativeCacheRebuildTask;
+
+        /// @brief Check whether the negative lookup cache proves a user does not exist
+        /// @param username User identifier
+        /// @return true if the database lookup can be skipped
+        [[nodiscard]] auto definitely_absent(std::string_view username) const -> bool;
+
         /// @brief Validate username format against security requirements
         /// @param username Username string to validate
         /// @return true if username format is valid, false otherwise
-        static auto validate_username(const std::string &username) noexcept -> bool;
+        /// @details Checks the length and looks every character up in the character class table, without allocating.
+        static auto validate_username(std::string_view username) noexcept -> bool;
 
         /// @brief Load user credentials from database
         /// @param username User identifier to load
-        /// @return User credentials if found, nullopt otherwise
-        auto load_user_from_db(const std::string &username) const -> std::optional<UserCredentials>;
-
-        /// @brief Parse credentials data (salt:hashed_password format)
-        /// @param credentials_data Raw credentials data from database
-        /// @return Parsed salt and hashed password pair, nullopt if invalid format
-        static auto parse_credentials_data(const std::string &credentials_data) -> std::optional<std::pair<std::string, std::string> >;
-
-        /// @brief Format credentials data (salt:hashed_password format)
-        /// @param salt Salt string
-        /// @param hashed_password Hashed password string
-        /// @return Formatted credentials string
-        static auto format_credentials_data(const std::string &salt, const std::string &hashed_password) -> std::string;
+        /// @return Credential record if found, nullopt otherwise
+        auto load_user_from_db(std::string_view username) const -> std::optional<CredentialRecord>;
 
         PasswordPolicy password_policy_;
-        std::unordered_map<std::string, std::unique_ptr<UserCredentials> > users_;
-        mutable std::mutex users_mutex_;
+        mutable std::array<UserShard, SHARD_COUNT> shards_;
+        std::atomic<uint64_t> next_version_{1};
         server_app::sql::PasswordSQL password_sql_;
+        uint32_t kdf_iterations_; ///< Key derivation cost new credentials are hashed with
+        LockoutTable lockouts_; ///< Failed login attempts of existing and unknown usernames
+        std::unique_ptr<SessionTokenManager> session_tokens_; ///< Null when session tokens are disabled
+        std::unique_ptr<NegativeLookupCache> negative_cache_; ///< Null when the negative lookup cache is disabled
+        std::unique_ptr<thread::ThreadPool> rehash_executor_; ///< Null when rehash on login is disabled
+        std::unique_ptr<thread::PeriodicActuator> negative_cache_rebuilder_; ///< Declared last so it stops before the members it uses
     };
 } // common
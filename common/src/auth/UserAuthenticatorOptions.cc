@@ -0,0 +1,291 @@
+#include "UserAuthenticatorOptions.hpp"
+
+#include <functional>
+#include <utility>
+#include <yaml-cpp/yaml.h>
+#include <glog/logging.h>
+#include <fmt/format.h>
+#include "src/filesystem/type/YamlToolkit.hpp"
+
+namespace common::auth {
+    UserAuthenticatorOptions::UserAuthenticatorOptions() = default;
+
+    UserAuthenticatorOptions::UserAuthenticatorOptions(const bool negative_cache_enabled, const int64_t negative_cache_expected_users, const double negative_cache_false_positive_rate, const int32_t negative_cache_rebuild_interval_sec, const int32_t kdf_iterations, const bool kdf_rehash_on_login, const int32_t session_token_ttl_sec, const int64_t lockout_table_size, const int32_t lockout_duration_sec, const int64_t credential_cache_bytes, const bool credential_cache_admission, const int32_t warm_up_threads) : negative_cache_enabled_(negative_cache_enabled), negative_cache_expected_users_(negative_cache_expected_users), negative_cache_false_positive_rate_(negative_cache_false_positive_rate), negative_cache_rebuild_interval_sec_(negative_cache_rebuild_interval_sec), kdf_iterations_(kdf_iterations), kdf_rehash_on_login_(kdf_rehash_on_login), session_token_ttl_sec_(session_token_ttl_sec), lockout_table_size_(lockout_table_size), lockout_duration_sec_(lockout_duration_sec), credential_cache_bytes_(credential_cache_bytes), credential_cache_admission_(credential_cache_admission), warm_up_threads_(warm_up_threads) {
+        validateParameters();
+    }
+
+    auto UserAuthenticatorOptions::negativeCacheEnabled() const noexcept -> bool {
+        return negative_cache_enabled_;
+    }
+
+    auto UserAuthenticatorOptions::negativeCacheEnabled(const bool value) noexcept -> void {
+        negative_cache_enabled_ = value;
+    }
+
+    auto UserAuthenticatorOptions::negativeCacheExpectedUsers() const noexcept -> int64_t {
+        return negative_cache_expected_users_;
+    }
+
+    auto UserAuthenticatorOptions::negativeCacheExpectedUsers(const int64_t value) noexcept -> void {
+        negative_cache_expected_users_ = value;
+    }
+
+    auto UserAuthenticatorOptions::negativeCacheFalsePositiveRate() const noexcept -> double {
+        return negative_cache_false_positive_rate_;
+    }
+
+    auto UserAuthenticatorOptions::negativeCacheFalsePositiveRate(const double value) noexcept -> void {
+        negative_cache_false_positive_rate_ = value;
+    }
+
+    auto UserAuthenticatorOptions::negativeCacheRebuildIntervalSec() const noexcept -> int32_t {
+        return negative_cache_rebuild_interval_sec_;
+    }
+
+    auto UserAuthenticatorOptions::negativeCacheRebuildIntervalSec(const int32_t value) noexcept -> void {
+        negative_cache_rebuild_interval_sec_ = value;
+    }
+
+    auto UserAuthenticatorOptions::kdfIterations() const noexcept -> int32_t {
+        return kdf_iterations_;
+    }
+
+    auto UserAuthenticatorOptions::kdfIterations(const int32_t value) noexcept -> void {
+        kdf_iterations_ = value;
+    }
+
+    auto UserAuthenticatorOptions::kdfRehashOnLogin() const noexcept -> bool {
+        return kdf_rehash_on_login_;
+    }
+
+    auto UserAuthenticatorOptions::kdfRehashOnLogin(const bool value) noexcept -> void {
+        kdf_rehash_on_login_ = value;
+    }
+
+    auto UserAuthenticatorOptions::sessionTokenTtlSec() const noexcept -> int32_t {
+        return session_token_ttl_sec_;
+    }
+
+    auto UserAuthenticatorOptions::sessionTokenTtlSec(const int32_t value) noexcept -> void {
+        session_token_ttl_sec_ = value;
+    }
+
+    auto UserAuthenticatorOptions::lockoutTableSize() const noexcept -> int64_t {
+        return lockout_table_size_;
+    }
+
+    auto UserAuthenticatorOptions::lockoutTableSize(const int64_t value) noexcept -> void {
+        lockout_table_size_ = value;
+    }
+
+    auto UserAuthenticatorOptions::lockoutDurationSec() const noexcept -> int32_t {
+        return lockout_duration_sec_;
+    }
+
+    auto UserAuthenticatorOptions::lockoutDurationSec(const int32_t value) noexcept -> void {
+        lockout_duration_sec_ = value;
+    }
+
+    auto UserAuthenticatorOptions::credentialCacheBytes() const noexcept -> int64_t {
+        return credential_cache_bytes_;
+    }
+
+    auto UserAuthenticatorOptions::credentialCacheBytes(const int64_t value) noexcept -> void {
+        credential_cache_bytes_ = value;
+    }
+
+    auto UserAuthenticatorOptions::credentialCacheAdmission() const noexcept -> bool {
+        return credential_cache_admission_;
+    }
+
+    auto UserAuthenticatorOptions::credentialCacheAdmission(const bool value) noexcept -> void {
+        credential_cache_admission_ = value;
+    }
+
+    auto UserAuthenticatorOptions::warmUpThreads() const noexcept -> int32_t {
+        return warm_up_threads_;
+    }
+
+    auto UserAuthenticatorOptions::warmUpThreads(const int32_t value) noexcept -> void {
+        warm_up_threads_ = value;
+    }
+
+    auto UserAuthenticatorOptions::deserializedFromYamlFile(const std::filesystem::path &path) -> void {
+        if (!std::filesystem::exists(path)) {
+            const std::string error_msg = fmt::format("Configuration file does not exist: {}", path.string());
+            LOG(ERROR) << error_msg;
+            throw std::runtime_error(error_msg);
+        }
+
+        try {
+            const YAML::Node root = filesystem::YamlToolkit::read(path.string());
+            const YAML::Node authNode = filesystem::YamlToolkit::getNodeOrRoot(root, "auth");
+
+            // Table-driven configuration loading for authenticator parameters
+            const std::vector<std::pair<std::string, std::function<void()> > > config_handlers = {
+                {"negativeCacheEnabled", [&]() { negative_cache_enabled_ = authNode["negativeCacheEnabled"].as<bool>(); }}, {"negativeCacheExpectedUsers", [&]() { negative_cache_expected_users_ = authNode["negativeCacheExpectedUsers"].as<int64_t>(); }},
+                {"negativeCacheFalsePositiveRate", [&]() { negative_cache_false_positive_rate_ = authNode["negativeCacheFalsePositiveRate"].as<double>(); }}, {"negativeCacheRebuildIntervalSec", [&]() { negative_cache_rebuild_interval_sec_ = authNode["negativeCacheRebuildIntervalSec"].as<int32_t>(); }},
+                {"kdfIterations", [&]() { kdf_iterations_ = authNode["kdfIterations"].as<int32_t>(); }}, {"kdfRehashOnLogin", [&]() { kdf_rehash_on_login_ = authNode["kdfRehashOnLogin"].as<bool>(); }},
+                {"sessionTokenTtlSec", [&]() { session_token_ttl_sec_ = authNode["sessionTokenTtlSec"].as<int32_t>(); }},
+                {"lockoutTableSize", [&]() { lockout_table_size_ = authNode["lockoutTableSize"].as<int64_t>(); }}, {"lockoutDurationSec", [&]() { lockout_duration_sec_ = authNode["lockoutDurationSec"].as<int32_t>(); }}, {"credentialCacheBytes", [&]() { credential_cache_bytes_ = authNode["credentialCacheBytes"].as<int64_t>(); }}, {"credentialCacheAdmission", [&]() { credential_cache_admission_ = authNode["credentialCacheAdmission"].as<bool>(); }},
+                {"warmUpThreads", [&]() { warm_up_threads_ = authNode["warmUpThreads"].as<int32_t>(); }}
+            };
+
+            for (const auto &[key, handler]: config_handlers) {
+                if (authNode[key]) {
+                    handler();
+                }
+            }
+        } catch (const YAML::Exception &e) {
+            const std::string error_msg = fmt::format("Failed to parse YAML file '{}': {}", path.string(), e.what());
+            LOG(ERROR) << error_msg;
+            throw std::runtime_error(std::move(error_msg));
+        } catch (const std::exception &e) {
+            const std::string error_msg = fmt::format("Error processing configuration file '{}': {}", path.string(), e.what());
+            LOG(ERROR) << error_msg;
+            throw std::runtime_error(std::move(error_msg));
+        }
+
+        validateParameters();
+    }
+
+    auto UserAuthenticatorOptions::validateParameters() const -> void {
+        // Table-driven validation for parameter checks
+        const std::vector<std::tuple<bool, std::string, const char *> > validations = {
+            std::make_tuple(negative_cache_expected_users_ <= 0, fmt::format("Invalid expected user count: {}. Value must be greater than 0.", negative_cache_expected_users_), "negative_cache_expected_users_"),
+            std::make_tuple(negative_cache_false_positive_rate_ <= 0.0 || negative_cache_false_positive_rate_ >= 1.0, fmt::format("Invalid false positive rate: {}. Value must be between 0 and 1 (exclusive).", negative_cache_false_positive_rate_), "negative_cache_false_positive_rate_"),
+            std::make_tuple(negative_cache_rebuild_interval_sec_ < 0, fmt::format("Invalid rebuild interval: {}s. Value must be greater than or equal to 0.", negative_cache_rebuild_interval_sec_), "negative_cache_rebuild_interval_sec_"),
+            std::make_tuple(kdf_iterations_ <= 0, fmt::format("Invalid KDF iteration count: {}. Value must be greater than 0.", kdf_iterations_), "kdf_iterations_"),
+            std::make_tuple(session_token_ttl_sec_ < 0, fmt::format("Invalid session token lifetime: {}s. Value must be greater than or equal to 0.", session_token_ttl_sec_), "session_token_ttl_sec_"),
+            std::make_tuple(lockout_table_size_ <= 0, fmt::format("Invalid lockout table size: {}. Value must be greater than 0.", lockout_table_size_), "lockout_table_size_"),
+            std::make_tuple(lockout_duration_sec_ <= 0, fmt::format("Invalid lockout duration: {}s. Value must be greater than 0.", lockout_duration_sec_), "lockout_duration_sec_"),
+            std::make_tuple(credential_cache_bytes_ <= 0, fmt::format("Invalid credential cache budget: {} bytes. Value must be greater than 0.", credential_cache_bytes_), "credential_cache_bytes_"),
+            std::make_tuple(warm_up_threads_ < 0, fmt::format("Invalid warm-up thread count: {}. Value must be greater than or equal to 0.", warm_up_threads_), "warm_up_threads_")
+        };
+
+        for (const auto &[condition, error_message, param_name]: validations) {
+            if (condition) {
+                LOG(ERROR) << error_message;
+                throw std::invalid_argument(error_message);
+            }
+        }
+
+        // Table-driven validation for warning conditions
+        const std::vector<std::tuple<bool, std::string> > warning_checks = {
+            std::make_tuple(negative_cache_enabled_ && negative_cache_rebuild_interval_sec_ == 0, fmt::format("Negative cache rebuild is disabled. Deleted users are looked up in the database until restart.")),
+            std::make_tuple(negative_cache_false_positive_rate_ > 0.1, fmt::format("Negative cache false positive rate is set to {}. More than one in ten unknown usernames will still reach the database.", negative_cache_false_positive_rate_)),
+            std::make_tuple(kdf_iterations_ > 0 && kdf_iterations_ < 100000, fmt::format("KDF iteration count is set to {}. Values below 100000 make offline password guessing cheap.", kdf_iterations_)),
+            std::make_tuple(session_token_ttl_sec_ > 86400, fmt::format("Session token lifetime is set to {}s. Tokens stay valid for more than a day unless revoked.", session_token_ttl_sec_)),
+            std::make_tuple(credential_cache_bytes_ > 0 && credential_cache_bytes_ < 1048576, fmt::format("Credential cache budget is set to {} bytes. Fewer than a few thousand users fit, most logins will read the database.", credential_cache_bytes_))
+        };
+
+        for (const auto &[condition, warning_message]: warning_checks) {
+            if (condition) {
+                LOG(WARNING) << warning_message;
+            }
+        }
+    }
+
+    auto UserAuthenticatorOptions::Builder::negativeCacheEnabled(const bool value) noexcept -> Builder & {
+        negative_cache_enabled_ = value;
+        return *this;
+    }
+
+    auto UserAuthenticatorOptions::Builder::negativeCacheExpectedUsers(const int64_t value) noexcept -> Builder & {
+        negative_cache_expected_users_ = value;
+        return *this;
+    }
+
+    auto UserAuthenticatorOptions::Builder::negativeCacheFalsePositiveRate(const double value) noexcept -> Builder & {
+        negative_cache_false_positive_rate_ = value;
+        return *this;
+    }
+
+    auto UserAuthenticatorOptions::Builder::negativeCacheRebuildIntervalSec(const int32_t value) noexcept -> Builder & {
+        negative_cache_rebuild_interval_sec_ = value;
+        return *this;
+    }
+
+    auto UserAuthenticatorOptions::Builder::kdfIterations(const int32_t value) noexcept -> Builder & {
+        kdf_iterations_ = value;
+        return *this;
+    }
+
+    auto UserAuthenticatorOptions::Builder::kdfRehashOnLogin(const bool value) noexcept -> Builder & {
+        kdf_rehash_on_login_ = value;
+        return *this;
+    }
+
+    auto UserAuthenticatorOptions::Builder::sessionTokenTtlSec(const int32_t value) noexcept -> Builder & {
+        session_token_ttl_sec_ = value;
+        return *this;
+    }
+
+    auto UserAuthenticatorOptions::Builder::lockoutTableSize(const int64_t value) noexcept -> Builder & {
+        lockout_table_size_ = value;
+        return *this;
+    }
+
+    auto UserAuthenticatorOptions::Builder::lockoutDurationSec(const int32_t value) noexcept -> Builder & {
+        lockout_duration_sec_ = value;
+        return *this;
+    }
+
+    auto UserAuthenticatorOptions::Builder::credentialCacheBytes(const int64_t value) noexcept -> Builder & {
+        credential_cache_bytes_ = value;
+        return *this;
+    }
+
+    auto UserAuthenticatorOptions::Builder::credentialCacheAdmission(const bool value) noexcept -> Builder & {
+        credential_cache_admission_ = value;
+        return *this;
+    }
+
+    auto UserAuthenticatorOptions::Builder::warmUpThreads(const int32_t value) noexcept -> Builder & {
+        warm_up_threads_ = value;
+        return *this;
+    }
+
+    auto UserAuthenticatorOptions::Builder::build() const -> UserAuthenticatorOptions {
+        return UserAuthenticatorOptions{negative_cache_enabled_, negative_cache_expected_users_, negative_cache_false_positive_rate_, negative_cache_rebuild_interval_sec_, kdf_iterations_, kdf_rehash_on_login_, session_token_ttl_sec_, lockout_table_size_, lockout_duration_sec_, credential_cache_bytes_, credential_cache_admission_, warm_up_threads_};
+    }
+
+    auto UserAuthenticatorOptions::builder() -> Builder {
+        return Builder{};
+    }
+}
+
+auto YAML::convert<common::auth::UserAuthenticatorOptions>::decode(const Node &node, common::auth::UserAuthenticatorOptions &rhs) -> bool {
+    const std::vector<std::pair<std::string, std::function<void()> > > config_handlers = {
+        {"negativeCacheEnabled", [&]() { rhs.negativeCacheEnabled(node["negativeCacheEnabled"].as<bool>()); }}, {"negativeCacheExpectedUsers", [&]() { rhs.negativeCacheExpectedUsers(node["negativeCacheExpectedUsers"].as<int64_t>()); }},
+        {"negativeCacheFalsePositiveRate", [&]() { rhs.negativeCacheFalsePositiveRate(node["negativeCacheFalsePositiveRate"].as<double>()); }}, {"negativeCacheRebuildIntervalSec", [&]() { rhs.negativeCacheRebuildIntervalSec(node["negativeCacheRebuildIntervalSec"].as<int32_t>()); }},
+        {"kdfIterations", [&]() { rhs.kdfIterations(node["kdfIterations"].as<int32_t>()); }}, {"kdfRehashOnLogin", [&]() { rhs.kdfRehashOnLogin(node["kdfRehashOnLogin"].as<bool>()); }},
+        {"sessionTokenTtlSec", [&]() { rhs.sessionTokenTtlSec(node["sessionTokenTtlSec"].as<int32_t>()); }},
+        {"lockoutTableSize", [&]() { rhs.lockoutTableSize(node["lockoutTableSize"].as<int64_t>()); }}, {"lockoutDurationSec", [&]() { rhs.lockoutDurationSec(node["lockoutDurationSec"].as<int32_t>()); }}, {"credentialCacheBytes", [&]() { rhs.credentialCacheBytes(node["credentialCacheBytes"].as<int64_t>()); }}, {"credentialCacheAdmission", [&]() { rhs.credentialCacheAdmission(node["credentialCacheAdmission"].as<bool>()); }},
+        {"warmUpThreads", [&]() { rhs.warmUpThreads(node["warmUpThreads"].as<int32_t>()); }}
+    };
+
+    for (const auto &[key, handler]: config_handlers) {
+        if (node[key]) {
+            handler();
+        }
+    }
+    return true;
+}
+
+auto YAML::convert<common::auth::UserAuthenticatorOptions>::encode(const common::auth::UserAuthenticatorOptions &rhs) -> Node {
+    Node node;
+    node["negativeCacheEnabled"] = rhs.negativeCacheEnabled();
+    node["negativeCacheExpectedUsers"] = rhs.negativeCacheExpectedUsers();
+    node["negativeCacheFalsePositiveRate"] = rhs.negativeCacheFalsePositiveRate();
+    node["negativeCacheRebuildIntervalSec"] = rhs.negativeCacheRebuildIntervalSec();
+    node["kdfIterations"] = rhs.kdfIterations();
+    node["kdfRehashOnLogin"] = rhs.kdfRehashOnLogin();
+    node["sessionTokenTtlSec"] = rhs.sessionTokenTtlSec();
+    node["lockoutTableSize"] = rhs.lockoutTableSize();
+    node["lockoutDurationSec"] = rhs.lockoutDurationSec();
+    node["credentialCacheBytes"] = rhs.credentialCacheBytes();
+    node["credentialCacheAdmission"] = rhs.credentialCacheAdmission();
+    node["warmUpThreads"] = rhs.warmUpThreads();
+    return node;
+}
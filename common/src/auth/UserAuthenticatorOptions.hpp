@@ -0,0 +1,322 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <yaml-cpp/node/node.h>
+
+#include "src/serializer/interface/IYamlConfigurable.hpp"
+
+namespace common::auth {
+    /// @brief A class that holds UserAuthenticator configuration options
+    /// @details This class encapsulates the sizing of the Bloom filter that answers lookups of
+    /// unknown usernames without touching the database, how often it is rebuilt, the key derivation
+    /// cost new credentials are hashed with, the lifetime of session tokens, the sizing of the
+    /// failed-login lockout table, the memory budget of the credential cache and how many threads
+    /// preload it at startup. The configuration parameters can be loaded from the "auth" section of a YAML configuration file.
+    ///
+    /// Example usage:
+    /// @code
+    /// auto options = UserAuthenticatorOptions::builder()
+    ///     .negativeCacheEnabled(true)
+    ///     .negativeCacheExpectedUsers(1000000)
+    ///     .negativeCacheFalsePositiveRate(0.01)
+    ///     .negativeCacheRebuildIntervalSec(3600)
+    ///     .kdfIterations(600000)
+    ///     .kdfRehashOnLogin(true)
+    ///     .sessionTokenTtlSec(900)
+    ///     .lockoutTableSize(1048576)
+    ///     .lockoutDurationSec(300)
+    ///     .credentialCacheBytes(134217728)
+    ///     .credentialCacheAdmission(true)
+    ///     .warmUpThreads(4)
+    ///     .build();
+    /// @endcode
+    class UserAuthenticatorOptions final : public interfaces::IYamlConfigurable {
+    public:
+        UserAuthenticatorOptions();
+
+        /// @brief Constructor with all parameters
+        UserAuthenticatorOptions(bool negative_cache_enabled, int64_t negative_cache_expected_users, double negative_cache_false_positive_rate, int32_t negative_cache_rebuild_interval_sec, int32_t kdf_iterations, bool kdf_rehash_on_login, int32_t session_token_ttl_sec, int64_t lockout_table_size, int32_t lockout_duration_sec, int64_t credential_cache_bytes, bool credential_cache_admission, int32_t warm_up_threads);
+
+        /// @brief Check whether the negative lookup cache is enabled
+        /// @return true if unknown usernames are answered from the Bloom filter
+        [[nodiscard]] auto negativeCacheEnabled() const noexcept -> bool;
+
+        /// @brief Enable or disable the negative lookup cache
+        /// @param value true to answer unknown usernames from the Bloom filter
+        auto negativeCacheEnabled(bool value) noexcept -> void;
+
+        /// @brief Get the expected number of users
+        /// @return Number of usernames the Bloom filter is sized for
+        /// @details The filter is sized for at least twice the current user count on every rebuild,
+        /// so this value only needs to be within an order of magnitude.
+        [[nodiscard]] auto negativeCacheExpectedUsers() const noexcept -> int64_t;
+
+        /// @brief Set the expected number of users
+        /// @param value Number of usernames the Bloom filter is sized for
+        auto negativeCacheExpectedUsers(int64_t value) noexcept -> void;
+
+        /// @brief Get the target false positive rate
+        /// @return Probability that an unknown username still has to be looked up in the database
+        [[nodiscard]] auto negativeCacheFalsePositiveRate() const noexcept -> double;
+
+        /// @brief Set the target false positive rate
+        /// @param value Probability that an unknown username still has to be looked up in the database
+        auto negativeCacheFalsePositiveRate(double value) noexcept -> void;
+
+        /// @brief Get the rebuild interval in seconds
+        /// @return How often the filter is rebuilt from the users table, 0 disables periodic rebuilds
+        /// @details Bloom filters cannot forget, so deleted users stay in the filter until the next
+        /// rebuild. They only cost a database lookup, never a wrong answer.
+        [[nodiscard]] auto negativeCacheRebuildIntervalSec() const noexcept -> int32_t;
+
+        /// @brief Set the rebuild interval in seconds
+        /// @param value How often the filter is rebuilt from the users table, 0 disables periodic rebuilds
+        auto negativeCacheRebuildIntervalSec(int32_t value) noexcept -> void;
+
+        /// @brief Get the target key derivation cost
+        /// @return Number of PBKDF2 iterations new credentials are hashed with
+        /// @details Existing credentials keep the cost they were hashed with until they are rehashed.
+        [[nodiscard]] auto kdfIterations() const noexcept -> int32_t;
+
+        /// @brief Set the target key derivation cost
+        /// @param value Number of PBKDF2 iterations new credentials are hashed with
+        auto kdfIterations(int32_t value) noexcept -> void;
+
+        /// @brief Check whether outdated credentials are rehashed on login
+        /// @return true if a successful login against another cost or algorithm schedules a background rehash
+        [[nodiscard]] auto kdfRehashOnLogin() const noexcept -> bool;
+
+        /// @brief Enable or disable rehashing of outdated credentials on login
+        /// @param value true to schedule a background rehash after a successful login against outdated parameters
+        auto kdfRehashOnLogin(bool value) noexcept -> void;
+
+        /// @brief Get the session token lifetime in seconds
+        /// @return How long a token issued on login stays valid, 0 disables session tokens
+        /// @details Tokens are validated with a single HMAC, so repeat callers skip password hashing
+        /// until their token expires or is revoked by a password change, reset or deletion.
+        [[nodiscard]] auto sessionTokenTtlSec() const noexcept -> int32_t;
+
+        /// @brief Set the session token lifetime in seconds
+        /// @param value How long a token issued on login stays valid, 0 disables session tokens
+        auto sessionTokenTtlSec(int32_t value) noexcept -> void;
+
+        /// @brief Get the number of slots of the lockout table
+        /// @return Number of usernames whose failed attempts can be tracked at once
+        /// @details The table is keyed by username hash, so unknown usernames are tracked as well. When it
+        /// is full, new failures take over the slots carrying the least evidence.
+        [[nodiscard]] auto lockoutTableSize() const noexcept -> int64_t;
+
+        /// @brief Set the number of slots of the lockout table
+        /// @param value Number of usernames whose failed attempts can be tracked at once
+        auto lockoutTableSize(int64_t value) noexcept -> void;
+
+        /// @brief Get the lockout duration in seconds
+        /// @return How long a username stays locked after its last failed attempt
+        [[nodiscard]] auto lockoutDurationSec() const noexcept -> int32_t;
+
+        /// @brief Set the lockout duration in seconds
+        /// @param value How long a username stays locked after its last failed attempt
+        auto lockoutDurationSec(int32_t value) noexcept -> void;
+
+        /// @brief Get the memory budget of the credential cache in bytes
+        /// @return Estimated bytes the cached credentials, keys and cache nodes may occupy
+        /// @details Credentials evicted from the cache are loaded from the database again on their next use.
+        [[nodiscard]] auto credentialCacheBytes() const noexcept -> int64_t;
+
+        /// @brief Set the memory budget of the credential cache in bytes
+        /// @param value Estimated bytes the cached credentials, keys and cache nodes may occupy
+        auto credentialCacheBytes(int64_t value) noexcept -> void;
+
+        /// @brief Check whether admission to the credential cache is frequency-based
+        /// @return true if a full cache only admits users looked up more often than the ones they would evict
+        [[nodiscard]] auto credentialCacheAdmission() const noexcept -> bool;
+
+        /// @brief Enable or disable frequency-based admission to the credential cache
+        /// @param value true if a full cache only admits users looked up more often than the ones they would evict
+        auto credentialCacheAdmission(bool value) noexcept -> void;
+
+        /// @brief Get the number of threads that preload the credential cache at startup
+        /// @return Threads scanning the users table in parallel, 0 disables the warm-up
+        /// @details The same scan fills the negative lookup cache, which otherwise loads the usernames on its own.
+        [[nodiscard]] auto warmUpThreads() const noexcept -> int32_t;
+
+        /// @brief Set the number of threads that preload the credential cache at startup
+        /// @param value Threads scanning the users table in parallel, 0 disables the warm-up
+        auto warmUpThreads(int32_t value) noexcept -> void;
+
+        /// @brief Deserialize object configuration from a YAML file
+        /// @param path The file path to the YAML configuration file
+        /// @throws std::runtime_error If the file cannot be read or parsed
+        /// @details The expected YAML structure is:
+        /// @code
+        /// auth:
+        ///   negativeCacheEnabled: true
+        ///   negativeCacheExpectedUsers: 1000000
+        ///   negativeCacheFalsePositiveRate: 0.01
+        ///   negativeCacheRebuildIntervalSec: 3600
+        ///   kdfIterations: 600000
+        ///   kdfRehashOnLogin: true
+        ///   sessionTokenTtlSec: 900
+        ///   lockoutTableSize: 1048576
+        ///   lockoutDurationSec: 300
+        ///   credentialCacheBytes: 134217728
+        ///   credentialCacheAdmission: true
+        ///   warmUpThreads: 4
+        /// @endcode
+        auto deserializedFromYamlFile(const std::filesystem::path &path) -> void override;
+
+        /// @brief Validate authenticator parameters for correctness
+        auto validateParameters() const -> void;
+
+        /// @brief Builder class for constructing UserAuthenticatorOptions instances
+        class Builder {
+        public:
+            /// @brief Enable or disable the negative lookup cache
+            /// @param value true to answer unknown usernames from the Bloom filter
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto negativeCacheEnabled(bool value) noexcept -> Builder &;
+
+            /// @brief Set the expected number of users
+            /// @param value Number of usernames the Bloom filter is sized for
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto negativeCacheExpectedUsers(int64_t value) noexcept -> Builder &;
+
+            /// @brief Set the target false positive rate
+            /// @param value Probability that an unknown username still has to be looked up in the database
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto negativeCacheFalsePositiveRate(double value) noexcept -> Builder &;
+
+            /// @brief Set the rebuild interval in seconds
+            /// @param value How often the filter is rebuilt from the users table, 0 disables periodic rebuilds
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto negativeCacheRebuildIntervalSec(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the target key derivation cost
+            /// @param value Number of PBKDF2 iterations new credentials are hashed with
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto kdfIterations(int32_t value) noexcept -> Builder &;
+
+            /// @brief Enable or disable rehashing of outdated credentials on login
+            /// @param value true to schedule a background rehash after a successful login against outdated parameters
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto kdfRehashOnLogin(bool value) noexcept -> Builder &;
+
+            /// @brief Set the session token lifetime in seconds
+            /// @param value How long a token issued on login stays valid, 0 disables session tokens
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto sessionTokenTtlSec(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the number of slots of the lockout table
+            /// @param value Number of usernames whose failed attempts can be tracked at once
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto lockoutTableSize(int64_t value) noexcept -> Builder &;
+
+            /// @brief Set the lockout duration in seconds
+            /// @param value How long a username stays locked after its last failed attempt
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto lockoutDurationSec(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the memory budget of the credential cache in bytes
+            /// @param value Estimated bytes the cached credentials, keys and cache nodes may occupy
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto credentialCacheBytes(int64_t value) noexcept -> Builder &;
+
+            /// @brief Enable or disable frequency-based admission to the credential cache
+            /// @param value true if a full cache only admits users looked up more often than the ones they would evict
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto credentialCacheAdmission(bool value) noexcept -> Builder &;
+
+            /// @brief Set the number of threads that preload the credential cache at startup
+            /// @param value Threads scanning the users table in parallel, 0 disables the warm-up
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto warmUpThreads(int32_t value) noexcept -> Builder &;
+
+            /// @brief Build the UserAuthenticatorOptions instance with the configured parameters
+            /// @return A new UserAuthenticatorOptions instance with the configured values
+            [[nodiscard]] auto build() const -> UserAuthenticatorOptions;
+
+        private:
+            bool negative_cache_enabled_{true};
+            int64_t negative_cache_expected_users_{1000000};
+            double negative_cache_false_positive_rate_{0.01};
+            int32_t negative_cache_rebuild_interval_sec_{3600};
+            int32_t kdf_iterations_{600000};
+            bool kdf_rehash_on_login_{true};
+            int32_t session_token_ttl_sec_{900};
+            int64_t lockout_table_size_{1048576};
+            int32_t lockout_duration_sec_{300};
+            int64_t credential_cache_bytes_{134217728};
+            bool credential_cache_admission_{true};
+            int32_t warm_up_threads_{4};
+        };
+
+        /// @brief Create a new Builder instance for constructing UserAuthenticatorOptions
+        /// @return A new Builder instance with default values
+        static auto builder() -> Builder;
+
+    private:
+        /// @brief Whether unknown usernames are answered from the Bloom filter
+        /// @details Default value is true.
+        bool negative_cache_enabled_{true};
+
+        /// @brief Number of usernames the Bloom filter is sized for
+        /// @details Default value is 1000000.
+        int64_t negative_cache_expected_users_{1000000};
+
+        /// @brief Target false positive rate of the Bloom filter
+        /// @details Default value is 0.01.
+        double negative_cache_false_positive_rate_{0.01};
+
+        /// @brief Interval between rebuilds of the Bloom filter in seconds
+        /// @details Default value is 3600 (one hour).
+        int32_t negative_cache_rebuild_interval_sec_{3600};
+
+        /// @brief Number of PBKDF2 iterations new credentials are hashed with
+        /// @details Default value is 600000 (NIST recommendation for PBKDF2-HMAC-SHA256).
+        int32_t kdf_iterations_{600000};
+
+        /// @brief Whether outdated credentials are rehashed in the background after a successful login
+        /// @details Default value is true.
+        bool kdf_rehash_on_login_{true};
+
+        /// @brief Lifetime of session tokens in seconds
+        /// @details Default value is 900 (15 minutes).
+        int32_t session_token_ttl_sec_{900};
+
+        /// @brief Number of slots of the lockout table
+        /// @details Default value is 1048576 (8 MiB of slots).
+        int64_t lockout_table_size_{1048576};
+
+        /// @brief Time a username stays locked after its last failed attempt in seconds
+        /// @details Default value is 300 (5 minutes).
+        int32_t lockout_duration_sec_{300};
+
+        /// @brief Memory budget of the credential cache in bytes
+        /// @details Default value is 134217728 (128 MiB, roughly a million users).
+        int64_t credential_cache_bytes_{134217728};
+
+        /// @brief Whether a full credential cache only admits users accessed more often than the ones they would evict
+        /// @details Default value is true.
+        bool credential_cache_admission_{true};
+
+        /// @brief Threads that preload the credential cache from the users table at startup
+        /// @details Default value is 4, matching the default reader pool size.
+        int32_t warm_up_threads_{4};
+    };
+}
+
+/// @brief YAML serialization specialization for UserAuthenticatorOptions.
+/// Provides methods to encode and decode UserAuthenticatorOptions to/from YAML nodes.
+template<>
+struct YAML::convert<common::auth::UserAuthenticatorOptions> {
+    /// @brief Decode a YAML node into a UserAuthenticatorOptions object.
+    /// @param node The YAML node containing the configuration data.
+    /// @param rhs The UserAuthenticatorOptions object to populate.
+    /// @return True if decoding was successful.
+    static auto decode(const Node &node, common::auth::UserAuthenticatorOptions &rhs) -> bool;
+
+    /// @brief Encode a UserAuthenticatorOptions object into a YAML node.
+    /// @param rhs The UserAuthenticatorOptions object to encode.
+    /// @return A YAML node containing the configuration data.
+    static auto encode(const common::auth::UserAuthenticatorOptions &rhs) -> Node;
+};
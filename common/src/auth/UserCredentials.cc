@@ -1,48 +1,45 @@
 #include "UserCredentials.hpp"
 
 #include <utility>
-#include <chrono>
 
 namespace common::auth {
-    UserCredentials::UserCredentials(std::string username, std::string hashed_password, std::string salt) noexcept : username_(std::move(username)), hashed_password_(std::move(hashed_password)), salt_(std::move(salt)), failed_attempts_(0), last_failed_attempt_(std::chrono::system_clock::time_point::min()) {
+    UserCredentials::UserCredentials(std::string username, const CredentialRecord &record, const uint64_t version) noexcept : username_(std::move(username)), record_(record), version_(version) {
     }
 
     auto UserCredentials::get_username() const noexcept -> const std::string & {
         return username_;
     }
 
-    auto UserCredentials::get_hashed_password() const noexcept -> const std::string & {
-        return hashed_password_;
+    auto UserCredentials::get_hashed_password() const noexcept -> const crypto::CryptoToolKit::Hash & {
+        return record_.hash;
     }
 
-    auto UserCredentials::get_salt() const noexcept -> const std::string & {
-        return salt_;
+    auto UserCredentials::get_salt() const noexcept -> const crypto::CryptoToolKit::Salt & {
+        return record_.salt;
     }
 
-    auto UserCredentials::get_failed_attempts() const noexcept -> size_t {
-        return failed_attempts_;
+    auto UserCredentials::get_kdf_id() const noexcept -> KdfId {
+        return record_.kdf_id;
     }
 
-    auto UserCredentials::increment_failed_attempts() noexcept -> void {
-        failed_attempts_++;
-        last_failed_attempt_ = std::chrono::system_clock::now();
+    auto UserCredentials::get_iterations() const noexcept -> uint32_t {
+        return record_.iterations;
     }
 
-    auto UserCredentials::reset_failed_attempts() noexcept -> void {
-        failed_attempts_ = 0;
-        last_failed_attempt_ = std::chrono::system_clock::time_point::min();
+    auto UserCredentials::get_record() const noexcept -> const CredentialRecord & {
+        return record_;
     }
 
-    auto UserCredentials::is_locked() const noexcept -> bool {
-        return is_locked(DEFAULT_LOCKOUT_DURATION, DEFAULT_MAX_ATTEMPTS);
+    auto UserCredentials::get_version() const noexcept -> uint64_t {
+        return version_;
     }
 
-    auto UserCredentials::is_locked(const std::chrono::minutes lockout_duration, const size_t max_attempts) const noexcept -> bool {
-        const auto now = std::chrono::system_clock::now();
-        const auto time_since_last_fail = now - last_failed_attempt_;
-        const auto minutes_since_last_fail = std::chrono::duration_cast<std::chrono::minutes>(time_since_last_fail);
+    auto UserCredentials::claim_rehash() noexcept -> bool {
+        return !std::exchange(rehash_claimed_, true);
+    }
 
-        // Account locked if max attempts reached and lockout period hasn't expired
-        return failed_attempts_ >= max_attempts && minutes_since_last_fail < lockout_duration;
+    auto UserCredentials::release_rehash() noexcept -> void {
+        rehash_claimed_ = false;
     }
+
 } // common
@@ -1,56 +1,58 @@
 #pragma once
-#include <chrono>
+#include <cstdint>
 #include <string>
 
+#include "CredentialRecord.hpp"
+
 namespace common::auth {
     /// @brief User credentials storage with security features
     class UserCredentials {
     public:
         /// @brief Constructor for new user credentials
         /// @param username User identifier
-        /// @param hashed_password Hashed password value
-        /// @param salt Salt used for password hashing
-        explicit UserCredentials(std::string username, std::string hashed_password, std::string salt) noexcept;
+        /// @param record Salt, hash and key derivation parameters
+        /// @param version Version stamp identifying this credential generation
+        explicit UserCredentials(std::string username, const CredentialRecord &record, uint64_t version = 0) noexcept;
 
         /// @brief Get username
         /// @return Username string
         [[nodiscard]] auto get_username() const noexcept -> const std::string &;
 
         /// @brief Get hashed password
-        /// @return Hashed password string
-        [[nodiscard]] auto get_hashed_password() const noexcept -> const std::string &;
+        /// @return Raw derived key bytes
+        [[nodiscard]] auto get_hashed_password() const noexcept -> const crypto::CryptoToolKit::Hash &;
 
         /// @brief Get salt value
-        /// @return Salt string used for hashing
-        [[nodiscard]] auto get_salt() const noexcept -> const std::string &;
+        /// @return Raw salt bytes used for hashing
+        [[nodiscard]] auto get_salt() const noexcept -> const crypto::CryptoToolKit::Salt &;
+
+        /// @brief Get the key derivation function
+        /// @return Identifier of the function the password was hashed with
+        [[nodiscard]] auto get_kdf_id() const noexcept -> KdfId;
 
-        /// @brief Get number of failed login attempts
-        /// @return Count of failed attempts
-        [[nodiscard]] auto get_failed_attempts() const noexcept -> size_t;
+        /// @brief Get the key derivation cost
+        /// @return Number of iterations the password was hashed with
+        [[nodiscard]] auto get_iterations() const noexcept -> uint32_t;
 
-        /// @brief Increment failed login attempt counter
-        auto increment_failed_attempts() noexcept -> void;
+        /// @brief Get the stored credential record
+        /// @return Salt, hash and key derivation parameters
+        [[nodiscard]] auto get_record() const noexcept -> const CredentialRecord &;
 
-        /// @brief Reset failed attempt counter
-        auto reset_failed_attempts() noexcept -> void;
+        /// @brief Get credential version
+        /// @return Version stamp that changes whenever the credentials are replaced
+        [[nodiscard]] auto get_version() const noexcept -> uint64_t;
 
-        /// @brief Check if account is locked due to excessive failed attempts
-        /// @return true if account is locked, false otherwise
-        [[nodiscard]] auto is_locked() const noexcept -> bool;
+        /// @brief Claim the background rehash of these credentials
+        /// @return true if no rehash was claimed before, false if one is already scheduled
+        [[nodiscard]] auto claim_rehash() noexcept -> bool;
 
-        /// @brief Check if account lock will expire after a specific duration
-        /// @param lockout_duration Duration in minutes after which lockout expires
-        /// @return true if account is locked, false otherwise
-        [[nodiscard]] auto is_locked(std::chrono::minutes lockout_duration, size_t max_attempts) const noexcept -> bool;
+        /// @brief Release a rehash claim whose task could not be scheduled
+        auto release_rehash() noexcept -> void;
 
     private:
         std::string username_;
-        std::string hashed_password_;
-        std::string salt_;
-        size_t failed_attempts_;
-        std::chrono::system_clock::time_point last_failed_attempt_;
-
-        static constexpr size_t DEFAULT_MAX_ATTEMPTS = 5;
-        static constexpr std::chrono::minutes DEFAULT_LOCKOUT_DURATION{5};
+        CredentialRecord record_;
+        uint64_t version_;
+        bool rehash_claimed_{false};
     };
 } // common
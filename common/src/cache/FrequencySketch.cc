@@ -0,0 +1,57 @@
+#include "FrequencySketch.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace common::cache {
+    /// @brief Odd multipliers giving each row its own hash function
+    static constexpr uint64_t ROW_SEEDS[] = {0x9E3779B97F4A7C15ULL, 0xC2B2AE3D27D4EB4FULL, 0x165667B19E3779F9ULL, 0xD6E8FEB86659FD93ULL};
+
+    FrequencySketch::FrequencySketch(const size_t expected_entries) : row_width_(std::bit_ceil(std::max<size_t>(expected_entries, COUNTERS_PER_WORD))), sample_size_(10 * row_width_), table_(ROW_COUNT * row_width_ / COUNTERS_PER_WORD, 0) {
+    }
+
+    auto FrequencySketch::increment(const uint64_t hash) noexcept -> void {
+        bool added = false;
+        for (size_t row = 0; row < ROW_COUNT; ++row) {
+            const auto index = counter_index(hash, row);
+            auto &word = table_[index / COUNTERS_PER_WORD];
+            const auto shift = (index % COUNTERS_PER_WORD) * 4;
+            if (((word >> shift) & COUNTER_MAX) < COUNTER_MAX) {
+                word += uint64_t{1} << shift;
+                added = true;
+            }
+        }
+
+        if (added && ++additions_ >= sample_size_) {
+            age();
+        }
+    }
+
+    auto FrequencySketch::frequency(const uint64_t hash) const noexcept -> uint32_t {
+        auto estimate = COUNTER_MAX;
+        for (size_t row = 0; row < ROW_COUNT; ++row) {
+            const auto index = counter_index(hash, row);
+            estimate = std::min(estimate, (table_[index / COUNTERS_PER_WORD] >> ((index % COUNTERS_PER_WORD) * 4)) & COUNTER_MAX);
+        }
+        return static_cast<uint32_t>(estimate);
+    }
+
+    auto FrequencySketch::clear() noexcept -> void {
+        std::ranges::fill(table_, 0);
+        additions_ = 0;
+    }
+
+    auto FrequencySketch::counter_index(const uint64_t hash, const size_t row) const noexcept -> size_t {
+        // Multiply-shift hashing; the high bits of the product are the well mixed ones
+        const auto mixed = (hash + row) * ROW_SEEDS[row];
+        return row * row_width_ + static_cast<size_t>((mixed >> 32) & (row_width_ - 1));
+    }
+
+    auto FrequencySketch::age() noexcept -> void {
+        // Shift every nibble right by one, dropping the bit that moved in from its neighbour
+        for (auto &word: table_) {
+            word = (word >> 1) & 0x7777777777777777ULL;
+        }
+        additions_ /= 2;
+    }
+}
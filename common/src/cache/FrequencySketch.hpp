@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace common::cache {
+    /// @brief Approximate access frequency of keys, used to decide cache admission (TinyLFU)
+    /// @details A count-min sketch of four rows of 4-bit saturating counters, 16 counters per word. The
+    /// estimate of a key is the smallest of its four counters, so collisions can only overestimate.
+    /// Once the number of recorded accesses reaches ten times the row width every counter is halved,
+    /// which lets the sketch follow a changing workload instead of favouring keys that were popular
+    /// long ago. The sketch costs two bytes per expected entry and is not thread-safe.
+    class FrequencySketch {
+    public:
+        /// @brief Construct an empty sketch
+        /// @param expected_entries Number of entries the cache is expected to hold, rounded up to a power of two
+        explicit FrequencySketch(size_t expected_entries);
+
+        /// @brief Record one access of a key
+        /// @param hash Hash of the key
+        auto increment(uint64_t hash) noexcept -> void;
+
+        /// @brief Estimate how often a key was accessed recently
+        /// @param hash Hash of the key
+        /// @return Estimated access count, saturating at 15
+        [[nodiscard]] auto frequency(uint64_t hash) const noexcept -> uint32_t;
+
+        /// @brief Forget every recorded access
+        auto clear() noexcept -> void;
+
+    private:
+        /// @brief Number of independently hashed rows
+        static constexpr size_t ROW_COUNT = 4;
+
+        /// @brief Number of 4-bit counters packed into one table word
+        static constexpr size_t COUNTERS_PER_WORD = 16;
+
+        /// @brief Largest value of a 4-bit counter
+        static constexpr uint64_t COUNTER_MAX = 15;
+
+        /// @brief Locate the counter of a key in one row
+        /// @param hash Hash of the key
+        /// @param row Row index
+        /// @return Index of the counter within the whole table
+        [[nodiscard]] auto counter_index(uint64_t hash, size_t row) const noexcept -> size_t;
+
+        /// @brief Halve every counter so recent accesses outweigh old ones
+        auto age() noexcept -> void;
+
+        size_t row_width_; ///< Counters per row, a power of two
+        size_t sample_size_; ///< Accesses recorded between two agings
+        size_t additions_{0};
+        std::vector<uint64_t> table_;
+    };
+}
@@ -0,0 +1,412 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <fmt/format.h>
+
+#include "FrequencySketch.hpp"
+#include "interface/ICache.hpp"
+
+namespace common::cache {
+    /// @brief Counters describing the contents and effectiveness of a cache
+    struct CacheStats {
+        uint64_t hits{0}; ///< Lookups that found their key
+        uint64_t misses{0}; ///< Lookups that did not find their key
+        uint64_t evictions{0}; ///< Entries dropped to make room for others
+        uint64_t rejections{0}; ///< New entries refused by the admission policy or larger than the budget
+        uint64_t entry_count{0}; ///< Entries currently cached
+        uint64_t weight{0}; ///< Estimated bytes held by the cached entries
+        uint64_t capacity{0}; ///< Budget in bytes
+
+        /// @brief Add the counters of another cache, e.g. another shard
+        /// @param other Counters to add
+        /// @return Reference to these counters
+        auto operator+=(const CacheStats &other) noexcept -> CacheStats & {
+            hits += other.hits;
+            misses += other.misses;
+            evictions += other.evictions;
+            rejections += other.rejections;
+            entry_count += other.entry_count;
+            weight += other.weight;
+            capacity += other.capacity;
+            return *this;
+        }
+
+        /// @brief Get the fraction of lookups that found their key
+        /// @return Hit ratio in [0, 1], 0 if nothing was looked up yet
+        [[nodiscard]] auto hit_ratio() const noexcept -> double {
+            const auto lookups = hits + misses;
+            return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+        }
+    };
+
+    /// @brief Template class implementing an LRU cache bounded by the memory of its entries
+    /// @tparam Key Type of the key used to identify cache entries
+    /// @tparam Value Type of the value stored in the cache
+    /// @tparam Weigher Callable returning the bytes a key and value own outside the cache's own nodes
+    /// @tparam Hash Hash function for keys, shared by the map and the admission policy
+    /// @tparam KeyEqual Equality of keys; together with a transparent Hash it enables lookups by other key types
+    /// @details Every entry is charged what the weigher reports plus the fixed size of its map and list
+    /// nodes, and least recently used entries are evicted until the total fits the budget. With admission
+    /// enabled a new key may only displace entries that were accessed less often than itself according to
+    /// a FrequencySketch (TinyLFU), so a burst of keys that are looked up once, such as a scan, cannot flush
+    /// the working set. Replacing the value of a cached key is never refused.
+    /// When Hash and KeyEqual are transparent, entries can be looked up and removed by any type they
+    /// accept, e.g. std::string_view for std::string keys, without building a key first.
+    template<typename Key, typename Value, typename Weigher, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key> >
+    class WeightedLRUCache : public interfaces::ICache<Key, Value> {
+        /// @brief Whether Hash and KeyEqual accept key types other than Key
+        static constexpr bool IS_TRANSPARENT = requires { typename Hash::is_transparent; typename KeyEqual::is_transparent; };
+
+    public:
+        /// @brief Constructs a cache with the specified budget
+        /// @param budget_bytes The maximum total weight of the entries
+        /// @param expected_entries Number of entries the admission sketch is sized for, 0 disables admission
+        /// @param weigher Callable weighing a key and value
+        /// @throw std::invalid_argument if budget_bytes is 0
+        WeightedLRUCache(size_t budget_bytes, size_t expected_entries, Weigher weigher = Weigher());
+
+        /// @brief Retrieves a value and marks it as most recently used
+        /// @param key The key to look up in the cache
+        /// @return Optional value if found, std::nullopt otherwise
+        /// @details Hits and misses are both counted and recorded in the admission sketch.
+        [[nodiscard]] auto get(const Key &key) -> std::optional<Value> override;
+
+        /// @brief Retrieves a value by a key of another type and marks it as most recently used
+        /// @tparam LookupKey Type accepted by the transparent Hash and KeyEqual
+        /// @param key The key to look up in the cache
+        /// @return Optional value if found, std::nullopt otherwise
+        template<typename LookupKey> requires (IS_TRANSPARENT && !std::is_same_v<LookupKey, Key>)
+        [[nodiscard]] auto get(const LookupKey &key) -> std::optional<Value> {
+            return get_impl(key);
+        }
+
+        /// @brief Retrieves a value without affecting recency, frequency or counters
+        /// @param key The key to look up in the cache
+        /// @return Optional value if found, std::nullopt otherwise
+        [[nodiscard]] auto peek(const Key &key) const -> std::optional<Value>;
+
+        /// @brief Retrieves a value by a key of another type without affecting recency, frequency or counters
+        /// @tparam LookupKey Type accepted by the transparent Hash and KeyEqual
+        /// @param key The key to look up in the cache
+        /// @return Optional value if found, std::nullopt otherwise
+        template<typename LookupKey> requires (IS_TRANSPARENT && !std::is_same_v<LookupKey, Key>)
+        [[nodiscard]] auto peek(const LookupKey &key) const -> std::optional<Value> {
+            return peek_impl(key);
+        }
+
+        /// @brief Inserts or updates a key-value pair in the cache (const value)
+        /// @param key The key to insert or update
+        /// @param value The value to store
+        /// @return true if the entry is cached, false if a new key was refused
+        [[nodiscard]] auto put(const Key &key, const Value &value) -> bool override;
+
+        /// @brief Inserts or updates a key-value pair in the cache (rvalue reference)
+        /// @param key The key to insert or update
+        /// @param value The value to store (will be moved)
+        /// @return true if the entry is cached, false if a new key was refused
+        [[nodiscard]] auto put(const Key &key, Value &&value) -> bool override;
+
+        /// @brief Removes an entry from the cache
+        /// @param key The key to remove
+        /// @return true if the key was found and removed, false otherwise
+        [[nodiscard]] auto remove(const Key &key) -> bool override;
+
+        /// @brief Removes an entry by a key of another type
+        /// @tparam LookupKey Type accepted by the transparent Hash and KeyEqual
+        /// @param key The key to remove
+        /// @return true if the key was found and removed, false otherwise
+        template<typename LookupKey> requires (IS_TRANSPARENT && !std::is_same_v<LookupKey, Key>)
+        [[nodiscard]] auto remove(const LookupKey &key) -> bool {
+            return remove_impl(key);
+        }
+
+        /// @brief Clears all entries and the recorded access frequencies
+        void clear() noexcept override;
+
+        /// @brief Returns the current number of entries in the cache
+        /// @return Number of entries currently in the cache
+        [[nodiscard]] auto size() const noexcept -> size_t override;
+
+        /// @brief Returns the budget of the cache
+        /// @return Maximum total weight of the entries in bytes
+        [[nodiscard]] auto capacity() const noexcept -> size_t override;
+
+        /// @brief Checks if the cache is empty
+        /// @return true if the cache is empty, false otherwise
+        [[nodiscard]] auto empty() const noexcept -> bool override;
+
+        /// @brief Checks if a key exists in the cache
+        /// @param key The key to check for
+        /// @return true if the key exists in the cache, false otherwise
+        [[nodiscard]] auto contains(const Key &key) const noexcept -> bool override;
+
+        /// @brief Checks if a key of another type exists in the cache
+        /// @tparam LookupKey Type accepted by the transparent Hash and KeyEqual
+        /// @param key The key to check for
+        /// @return true if the key exists in the cache, false otherwise
+        template<typename LookupKey> requires (IS_TRANSPARENT && !std::is_same_v<LookupKey, Key>)
+        [[nodiscard]] auto contains(const LookupKey &key) const noexcept -> bool {
+            return entries_.find(key) != entries_.end();
+        }
+
+        /// @brief Returns the current total weight of the entries
+        /// @return Estimated bytes held by the cached entries
+        [[nodiscard]] auto weight() const noexcept -> size_t;
+
+        /// @brief Returns the cache counters
+        /// @return Lookup, eviction and admission counters and the current size
+        [[nodiscard]] auto stats() const noexcept -> CacheStats;
+
+    private:
+        /// @brief Recency list, most recently used first, pointing at the keys owned by the map
+        using Order = std::list<const Key *>;
+
+        /// @brief Cached value with its charged weight and position in the recency list
+        struct Entry {
+            Value value;
+            size_t weight;
+            typename Order::iterator position;
+        };
+
+        using Map = std::unordered_map<Key, Entry, Hash, KeyEqual>;
+
+        /// @brief Bytes charged to every entry for its map node, bucket slot and list node
+        static constexpr size_t ENTRY_OVERHEAD = sizeof(typename Map::value_type) + 3 * sizeof(void *) + sizeof(const Key *) + 2 * sizeof(void *);
+
+        /// @brief Helper method to handle both const and non-const put operations
+        /// @tparam ValueType Type of the value to store (const reference or rvalue reference)
+        /// @param key The key to insert or update
+        /// @param value The value to store
+        /// @return true if the entry is cached, false if a new key was refused
+        template<typename ValueType>
+        [[nodiscard]] auto put_impl(const Key &key, ValueType &&value) -> bool;
+
+        /// @brief Helper method shared by get for Key and for transparent lookup keys
+        /// @tparam LookupKey Key or a type accepted by the transparent Hash and KeyEqual
+        /// @param key The key to look up in the cache
+        /// @return Optional value if found, std::nullopt otherwise
+        template<typename LookupKey>
+        [[nodiscard]] auto get_impl(const LookupKey &key) -> std::optional<Value>;
+
+        /// @brief Helper method shared by peek for Key and for transparent lookup keys
+        /// @tparam LookupKey Key or a type accepted by the transparent Hash and KeyEqual
+        /// @param key The key to look up in the cache
+        /// @return Optional value if found, std::nullopt otherwise
+        template<typename LookupKey>
+        [[nodiscard]] auto peek_impl(const LookupKey &key) const -> std::optional<Value>;
+
+        /// @brief Helper method shared by remove for Key and for transparent lookup keys
+        /// @tparam LookupKey Key or a type accepted by the transparent Hash and KeyEqual
+        /// @param key The key to remove
+        /// @return true if the key was found and removed, false otherwise
+        template<typename LookupKey>
+        [[nodiscard]] auto remove_impl(const LookupKey &key) -> bool;
+
+        /// @brief Evicts least recently used entries until a new entry fits the budget
+        /// @param key Key of the new entry
+        /// @param weight Weight of the new entry
+        /// @return true if the entry fits, false if admission refused it and nothing was evicted
+        [[nodiscard]] auto make_room(const Key &key, size_t weight) -> bool;
+
+        /// @brief Evicts the least recently used entry
+        auto evict_lru() -> void;
+
+        Hash hash_;
+        Weigher weigher_;
+        Map entries_;
+        Order order_;
+        size_t budget_;
+        size_t weight_{0};
+        std::optional<FrequencySketch> sketch_; ///< Empty when admission is disabled
+        uint64_t hits_{0};
+        uint64_t misses_{0};
+        uint64_t evictions_{0};
+        uint64_t rejections_{0};
+    };
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::WeightedLRUCache(const size_t budget_bytes, const size_t expected_entries, Weigher weigher) : weigher_(std::move(weigher)), budget_(budget_bytes) {
+        if (budget_ == 0) {
+            throw std::invalid_argument(fmt::format("Cache budget must be greater than 0, got {}", budget_));
+        }
+        if (expected_entries > 0) {
+            sketch_.emplace(expected_entries);
+        }
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::get(const Key &key) -> std::optional<Value> {
+        return get_impl(key);
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    template<typename LookupKey>
+    auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::get_impl(const LookupKey &key) -> std::optional<Value> {
+        if (sketch_) {
+            sketch_->increment(hash_(key));
+        }
+
+        const auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            ++misses_;
+            return std::nullopt;
+        }
+
+        ++hits_;
+        order_.splice(order_.begin(), order_, it->second.position);
+        return it->second.value;
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::peek(const Key &key) const -> std::optional<Value> {
+        return peek_impl(key);
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    template<typename LookupKey>
+    auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::peek_impl(const LookupKey &key) const -> std::optional<Value> {
+        const auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return std::nullopt;
+        }
+        return it->second.value;
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    template<typename ValueType>
+    auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::put_impl(const Key &key, ValueType &&value) -> bool {
+        const auto weight = ENTRY_OVERHEAD + weigher_(key, value);
+        if (const auto it = entries_.find(key); it != entries_.end()) {
+            weight_ = weight_ - it->second.weight + weight;
+            it->second.value = std::forward<ValueType>(value);
+            it->second.weight = weight;
+            order_.splice(order_.begin(), order_, it->second.position);
+
+            // A grown entry may push others out, but never itself
+            while (weight_ > budget_ && order_.back() != &it->first) {
+                evict_lru();
+            }
+            return true;
+        }
+
+        if (weight > budget_ || !make_room(key, weight)) {
+            ++rejections_;
+            return false;
+        }
+
+        const auto it = entries_.emplace(key, Entry{std::forward<ValueType>(value), weight, {}}).first;
+        order_.push_front(&it->first);
+        it->second.position = order_.begin();
+        weight_ += weight;
+        return true;
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::put(const Key &key, const Value &value) -> bool {
+        return put_impl(key, value);
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::put(const Key &key, Value &&value) -> bool {
+        return put_impl(key, std::forward<Value>(value));
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    [[nodiscard]] auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::remove(const Key &key) -> bool {
+        return remove_impl(key);
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    template<typename LookupKey>
+    auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::remove_impl(const LookupKey &key) -> bool {
+        const auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return false;
+        }
+
+        weight_ -= it->second.weight;
+        order_.erase(it->second.position);
+        entries_.erase(it);
+        return true;
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    void WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::clear() noexcept {
+        order_.clear();
+        entries_.clear();
+        weight_ = 0;
+        if (sketch_) {
+            sketch_->clear();
+        }
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    [[nodiscard]] auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::size() const noexcept -> size_t {
+        return entries_.size();
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    [[nodiscard]] auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::capacity() const noexcept -> size_t {
+        return budget_;
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    [[nodiscard]] auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::empty() const noexcept -> bool {
+        return entries_.empty();
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    [[nodiscard]] auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::contains(const Key &key) const noexcept -> bool {
+        return entries_.find(key) != entries_.end();
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    [[nodiscard]] auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::weight() const noexcept -> size_t {
+        return weight_;
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    [[nodiscard]] auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::stats() const noexcept -> CacheStats {
+        return CacheStats{hits_, misses_, evictions_, rejections_, entries_.size(), weight_, budget_};
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::make_room(const Key &key, const size_t weight) -> bool {
+        if (weight_ + weight <= budget_) {
+            return true;
+        }
+
+        // Admit the candidate only if it is accessed more often than every entry it would displace
+        if (sketch_) {
+            const auto candidate_frequency = sketch_->frequency(hash_(key));
+            size_t freed = 0;
+            for (auto victim = order_.rbegin(); victim != order_.rend() && weight_ + weight - freed > budget_; ++victim) {
+                if (sketch_->frequency(hash_(**victim)) >= candidate_frequency) {
+                    return false;
+                }
+                freed += entries_.find(**victim)->second.weight;
+            }
+        }
+
+        while (weight_ + weight > budget_) {
+            evict_lru();
+        }
+        return true;
+    }
+
+    template<typename Key, typename Value, typename Weigher, typename Hash, typename KeyEqual>
+    auto WeightedLRUCache<Key, Value, Weigher, Hash, KeyEqual>::evict_lru() -> void {
+        const auto it = entries_.find(*order_.back());
+        weight_ -= it->second.weight;
+        order_.pop_back();
+        entries_.erase(it);
+        ++evictions_;
+    }
+}
@@ -1,5 +1,8 @@
 #pragma once
-#include <string>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
 
 #include "src/exception/AuthenticationException.hpp"
 
@@ -9,24 +12,28 @@ namespace common::crypto {
     public:
         static constexpr size_t SALT_SIZE = 16; /// @brief Size of cryptographic salt in bytes
         static constexpr size_t HASH_SIZE = 32; /// @brief Size of SHA256 hash output in bytes
+        static constexpr uint32_t DEFAULT_ITERATIONS = 600000; /// @brief PBKDF2 iterations, NIST recommended
+
+        using Salt = std::array<uint8_t, SALT_SIZE>; /// @brief Raw salt bytes
+        using Hash = std::array<uint8_t, HASH_SIZE>; /// @brief Raw derived key bytes
 
         /// @brief Generate cryptographically secure random salt
-        /// @return Random salt string of SALT_SIZE bytes
+        /// @return Random salt of SALT_SIZE bytes
         /// @throws AuthenticationException if secure random generation fails
-        [[nodiscard]] static auto generate_salt() -> std::string;
+        [[nodiscard]] static auto generate_salt() -> Salt;
 
         /// @brief Hash password using PBKDF2-HMAC-SHA256 with configurable iterations
         /// @param password Plaintext password to hash
         /// @param salt Salt value for hashing
-        /// @param iterations Number of PBKDF2 iterations (default: 600000, NIST recommended)
-        /// @return Hashed password string
+        /// @param iterations Number of PBKDF2 iterations (default: DEFAULT_ITERATIONS)
+        /// @return Derived key of HASH_SIZE bytes
         /// @throws AuthenticationException if hashing operation fails
-        [[nodiscard]] static auto hash_password(const std::string &password, const std::string &salt, size_t iterations = 600000) -> std::string;
+        [[nodiscard]] static auto hash_password(std::string_view password, std::span<const uint8_t> salt, uint32_t iterations = DEFAULT_ITERATIONS) -> Hash;
 
-        /// @brief Constant-time string comparison to prevent timing attacks
-        /// @param a First string to compare
-        /// @param b Second string to compare
-        /// @return true if strings are equal, false otherwise
-        [[nodiscard]] static auto secure_compare(const std::string &a, const std::string &b) noexcept -> bool;
+        /// @brief Constant-time byte comparison to prevent timing attacks
+        /// @param a First byte sequence to compare
+        /// @param b Second byte sequence to compare
+        /// @return true if both sequences are equal, false otherwise
+        [[nodiscard]] static auto secure_compare(std::span<const uint8_t> a, std::span<const uint8_t> b) noexcept -> bool;
     };
 } // common
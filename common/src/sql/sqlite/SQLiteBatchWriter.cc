@@ -0,0 +1,91 @@
+#include "SQLiteBatchWriter.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+namespace common::sql::sqlite {
+    SQLiteBatchWriter::SQLiteBatchWriter(const SQLiteManager &sqlite_manager, const size_t max_batch_size, const std::chrono::milliseconds flush_interval) : sqlite_manager_(sqlite_manager), max_batch_size_(std::max<size_t>(max_batch_size, 1)), flush_interval_(flush_interval) {
+        pending_.reserve(max_batch_size_);
+        promises_.reserve(max_batch_size_);
+        worker_ = std::thread([this] { run(); });
+    }
+
+    SQLiteBatchWriter::~SQLiteBatchWriter() {
+        stop();
+    }
+
+    auto SQLiteBatchWriter::submit(std::string sql, std::vector<SQLiteManager::Value> params) -> std::future<int> {
+        std::promise<int> promise;
+        auto future = promise.get_future();
+        {
+            std::lock_guard lock(mutex_);
+            if (stopping_) {
+                throw std::runtime_error("SQLiteBatchWriter::submit: Writer is stopped");
+            }
+            pending_.push_back({std::move(sql), std::move(params)});
+            promises_.push_back(std::move(promise));
+            if (pending_.size() != 1 && pending_.size() < max_batch_size_) {
+                return future;
+            }
+        }
+        // Wake the worker for the first statement of a batch and when the batch is full
+        cv_.notify_one();
+        return future;
+    }
+
+    auto SQLiteBatchWriter::stop() -> void {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_one();
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+    }
+
+    auto SQLiteBatchWriter::run() -> void {
+        std::vector<SQLiteManager::BatchStatement> batch;
+        std::vector<std::promise<int> > promises;
+        batch.reserve(max_batch_size_);
+        promises.reserve(max_batch_size_);
+
+        while (true) {
+            {
+                std::unique_lock lock(mutex_);
+                cv_.wait(lock, [this] { return stopping_ || !pending_.empty(); });
+                if (pending_.empty()) {
+                    return;
+                }
+                // Give concurrent writers a chance to join the batch before committing
+                cv_.wait_for(lock, flush_interval_, [this] { return stopping_ || pending_.size() >= max_batch_size_; });
+
+                const auto count = std::min(pending_.size(), max_batch_size_);
+                batch.assign(std::make_move_iterator(pending_.begin()), std::make_move_iterator(pending_.begin() + static_cast<std::ptrdiff_t>(count)));
+                promises.assign(std::make_move_iterator(promises_.begin()), std::make_move_iterator(promises_.begin() + static_cast<std::ptrdiff_t>(count)));
+                pending_.erase(pending_.begin(), pending_.begin() + static_cast<std::ptrdiff_t>(count));
+                promises_.erase(promises_.begin(), promises_.begin() + static_cast<std::ptrdiff_t>(count));
+            }
+
+            try {
+                const auto results = sqlite_manager_.execBatch(batch);
+                for (size_t i = 0; i < results.size(); ++i) {
+                    if (results[i].ok()) {
+                        promises[i].set_value(results[i].affected_rows);
+                    } else {
+                        promises[i].set_exception(std::make_exception_ptr(SQLiteManager::Error(results[i].error, results[i].error_code)));
+                    }
+                }
+            } catch (...) {
+                // The whole batch was rolled back, every statement in it failed
+                for (auto &promise: promises) {
+                    promise.set_exception(std::current_exception());
+                }
+            }
+            batch.clear();
+            promises.clear();
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SQLiteManager.hpp"
+
+namespace common::sql::sqlite {
+    /// @brief Group-commit writer that coalesces concurrent mutations into shared transactions
+    /// @details Submitted statements are queued and executed by a single worker thread through
+    /// SQLiteManager::execBatch. The first statement of a batch waits at most the flush interval for
+    /// others to join, so under load many writes share one commit and one fsync. A submitter's future
+    /// becomes ready only after the transaction containing its statement committed, so durability is
+    /// the same as executing the statement directly.
+    class SQLiteBatchWriter {
+    public:
+        /// @brief Construct a batch writer and start its worker thread
+        /// @param sqlite_manager Manager whose writer connection executes the batches, must outlive this writer
+        /// @param max_batch_size Maximum number of statements committed in one transaction
+        /// @param flush_interval Maximum time the oldest queued statement waits before its batch is flushed
+        SQLiteBatchWriter(const SQLiteManager &sqlite_manager, size_t max_batch_size, std::chrono::milliseconds flush_interval);
+
+        /// @brief Destructor that flushes pending statements and stops the worker thread
+        ~SQLiteBatchWriter();
+
+        /// @brief Copy constructor (deleted)
+        SQLiteBatchWriter(const SQLiteBatchWriter &) = delete;
+
+        /// @brief Copy assignment operator (deleted)
+        auto operator=(const SQLiteBatchWriter &) -> SQLiteBatchWriter & = delete;
+
+        /// @brief Queue a non-query statement for the next batch
+        /// @param sql SQL statement to execute
+        /// @param params Parameter values for the statement
+        /// @return Future holding the number of affected rows once the batch committed
+        /// @throws std::runtime_error if the writer has been stopped
+        /// @details The future rethrows the statement's error as SQLiteManager::Error, or the commit error of its batch.
+        [[nodiscard]] auto submit(std::string sql, std::vector<SQLiteManager::Value> params) -> std::future<int>;
+
+        /// @brief Flush pending statements and stop the worker thread
+        auto stop() -> void;
+
+    private:
+        /// @brief Worker loop that collects and commits batches until stopped
+        auto run() -> void;
+
+        const SQLiteManager &sqlite_manager_;
+        size_t max_batch_size_;
+        std::chrono::milliseconds flush_interval_;
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::vector<SQLiteManager::BatchStatement> pending_;
+        std::vector<std::promise<int> > promises_;
+        bool stopping_{false};
+        std::thread worker_;
+    };
+}
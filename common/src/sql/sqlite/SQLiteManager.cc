@@ -1,10 +1,139 @@
 #include "SQLiteManager.hpp"
 
 namespace common::sql::sqlite {
-    SQLiteManager::SQLiteManager() : db_(nullptr, &sqlite3_close) {
+    SQLiteManager::PreparedStatement::PreparedStatement(std::unique_lock<std::mutex> lock, sqlite3 *db, sqlite3_stmt *stmt, const bool cached) noexcept : lock_(std::move(lock)), db_(db), stmt_(stmt), cached_(cached) {
     }
 
-    SQLiteManager::SQLiteManager(const std::string &db_path) : db_(nullptr, &sqlite3_close) {
+    SQLiteManager::PreparedStatement::PreparedStatement(PreparedStatement &&other) noexcept : lock_(std::move(other.lock_)), db_(other.db_), stmt_(other.stmt_), cached_(other.cached_) {
+        other.db_ = nullptr;
+        other.stmt_ = nullptr;
+    }
+
+    SQLiteManager::PreparedStatement::~PreparedStatement() {
+        if (!stmt_) {
+            return;
+        }
+
+        if (cached_) {
+            // Return the statement to a clean state for the next borrower
+            sqlite3_reset(stmt_);
+            sqlite3_clear_bindings(stmt_);
+        } else {
+            sqlite3_finalize(stmt_);
+        }
+    }
+
+    auto SQLiteManager::PreparedStatement::bind(const int index, const std::string_view value) -> PreparedStatement & {
+        if (sqlite3_bind_text(stmt_, index, value.data(), static_cast<int>(value.size()), SQLITE_TRANSIENT) != SQLITE_OK) {
+            throw std::runtime_error("SQLiteManager::PreparedStatement::bind: Parameter binding failed at index " + std::to_string(index) + ": " + std::string(sqlite3_errmsg(db_)));
+        }
+        return *this;
+    }
+
+    auto SQLiteManager::PreparedStatement::bind(const int index, const int64_t value) -> PreparedStatement & {
+        if (sqlite3_bind_int64(stmt_, index, value) != SQLITE_OK) {
+            throw std::runtime_error("SQLiteManager::PreparedStatement::bind: Parameter binding failed at index " + std::to_string(index) + ": " + std::string(sqlite3_errmsg(db_)));
+        }
+        return *this;
+    }
+
+    auto SQLiteManager::PreparedStatement::bindBlob(const int index, const std::span<const uint8_t> value) -> PreparedStatement & {
+        if (sqlite3_bind_blob(stmt_, index, value.data(), static_cast<int>(value.size()), SQLITE_TRANSIENT) != SQLITE_OK) {
+            throw std::runtime_error("SQLiteManager::PreparedStatement::bindBlob: Parameter binding failed at index " + std::to_string(index) + ": " + std::string(sqlite3_errmsg(db_)));
+        }
+        return *this;
+    }
+
+    auto SQLiteManager::PreparedStatement::bindAll(const std::vector<std::string> &params) -> PreparedStatement & {
+        for (size_t i = 0; i < params.size(); ++i) {
+            if (sqlite3_bind_text(stmt_, static_cast<int>(i + 1), params[i].c_str(), static_cast<int>(params[i].size()), SQLITE_STATIC) != SQLITE_OK) {
+                throw std::runtime_error("SQLiteManager::PreparedStatement::bindAll: Parameter binding failed at index " + std::to_string(i));
+            }
+        }
+        return *this;
+    }
+
+    auto SQLiteManager::PreparedStatement::bindAll(const std::vector<Value> &params) -> PreparedStatement & {
+        for (size_t i = 0; i < params.size(); ++i) {
+            const int index = static_cast<int>(i + 1);
+            int rc = SQLITE_OK;
+            if (const auto *text = std::get_if<std::string>(&params[i])) {
+                rc = sqlite3_bind_text(stmt_, index, text->c_str(), static_cast<int>(text->size()), SQLITE_STATIC);
+            } else if (const auto *integer = std::get_if<int64_t>(&params[i])) {
+                rc = sqlite3_bind_int64(stmt_, index, *integer);
+            } else {
+                const auto &blob = std::get<Blob>(params[i]);
+                rc = sqlite3_bind_blob(stmt_, index, blob.data(), static_cast<int>(blob.size()), SQLITE_STATIC);
+            }
+            if (rc != SQLITE_OK) {
+                throw std::runtime_error("SQLiteManager::PreparedStatement::bindAll: Parameter binding failed at index " + std::to_string(i));
+            }
+        }
+        return *this;
+    }
+
+    auto SQLiteManager::PreparedStatement::step() -> bool {
+        const int rc = sqlite3_step(stmt_);
+        if (rc == SQLITE_ROW) {
+            return true;
+        }
+        if (rc == SQLITE_DONE) {
+            return false;
+        }
+        throw Error("SQLiteManager::PreparedStatement::step: SQL execution failed: " + std::string(sqlite3_errmsg(db_)), sqlite3_extended_errcode(db_));
+    }
+
+    auto SQLiteManager::PreparedStatement::columnCount() const noexcept -> int {
+        return sqlite3_column_count(stmt_);
+    }
+
+    auto SQLiteManager::PreparedStatement::columnText(const int index) const -> std::string {
+        const unsigned char *col = sqlite3_column_text(stmt_, index);
+        if (!col) {
+            return "NULL";
+        }
+        return {reinterpret_cast<const char *>(col), static_cast<size_t>(sqlite3_column_bytes(stmt_, index))};
+    }
+
+    auto SQLiteManager::PreparedStatement::columnInt64(const int index) const noexcept -> int64_t {
+        return sqlite3_column_int64(stmt_, index);
+    }
+
+    auto SQLiteManager::PreparedStatement::columnBlob(const int index) const noexcept -> std::span<const uint8_t> {
+        const auto *col = static_cast<const uint8_t *>(sqlite3_column_blob(stmt_, index));
+        if (!col) {
+            return {};
+        }
+        return {col, static_cast<size_t>(sqlite3_column_bytes(stmt_, index))};
+    }
+
+    auto SQLiteManager::PreparedStatement::execute() -> int {
+        while (step()) {
+        }
+        return sqlite3_changes(db_);
+    }
+
+    auto SQLiteManager::PreparedStatement::fetchAll() -> std::vector<std::vector<std::string> > {
+        std::vector<std::vector<std::string> > results;
+        const int cols = columnCount();
+        while (step()) {
+            std::vector<std::string> row;
+            row.reserve(static_cast<size_t>(cols));
+            for (int i = 0; i < cols; ++i) {
+                row.emplace_back(columnText(i));
+            }
+            results.push_back(std::move(row));
+        }
+        return results;
+    }
+
+    auto SQLiteManager::PreparedStatement::get() const noexcept -> sqlite3_stmt * {
+        return stmt_;
+    }
+
+    SQLiteManager::SQLiteManager() = default;
+
+    SQLiteManager::SQLiteManager(const std::string &db_path, SQLiteOptions options) : options_(std::move(options)) {
         createDatabase(db_path);
     }
 
@@ -17,100 +146,205 @@ namespace common::sql::sqlite {
             throw std::invalid_argument("SQLiteManager::createDatabase: Database path cannot be empty");
         }
 
-        if (db_) {
-            closeDatabase();
+        closeDatabase();
+
+        // The writer opens first so that it creates the file and switches it to WAL before readers attach
+        auto writer = openConnection(db_path, false);
+        {
+            std::lock_guard lock(writer_.mutex);
+            writer_.db = std::move(writer);
         }
 
-        sqlite3 *raw_db;
-        if (sqlite3_open(db_path.c_str(), &raw_db) != SQLITE_OK) {
-            const std::string error_msg = "SQLiteManager::createDatabase: Database open failed for path '" + db_path + "': " + std::string(sqlite3_errmsg(raw_db));
-            sqlite3_close(raw_db); // Clean up the failed connection
-            throw std::runtime_error(error_msg);
+        if (!options_.useReaderPool() || isInMemory(db_path)) {
+            return;
         }
 
-        db_.reset(raw_db);
+        readers_.reserve(static_cast<size_t>(options_.readerPoolSize()));
+        for (int32_t i = 0; i < options_.readerPoolSize(); ++i) {
+            auto reader = std::make_unique<Connection>();
+            reader->db = openConnection(db_path, true);
+            readers_.push_back(std::move(reader));
+        }
     }
 
     void SQLiteManager::closeDatabase() {
-        if (db_) {
-            db_.reset(nullptr);
+        // Statements must be finalized before a connection can be closed
+        for (const auto &reader: readers_) {
+            closeConnection(*reader);
         }
+        readers_.clear();
+        closeConnection(writer_);
     }
 
-    auto SQLiteManager::exec(const std::string &sql, const std::vector<std::string> &params) const -> int {
-        if (!db_) {
-            throw std::runtime_error("SQLiteManager::exec: Database not open");
+    auto SQLiteManager::prepare(const std::string_view sql) const -> PreparedStatement {
+        if (sql.empty()) {
+            throw std::invalid_argument("SQLiteManager::prepare: SQL statement cannot be empty");
         }
+        return borrow(writer_, std::unique_lock(writer_.mutex), sql);
+    }
 
+    auto SQLiteManager::prepareRead(const std::string_view sql) const -> PreparedStatement {
         if (sql.empty()) {
-            throw std::invalid_argument("SQLiteManager::exec: SQL statement cannot be empty");
+            throw std::invalid_argument("SQLiteManager::prepareRead: SQL statement cannot be empty");
         }
 
-        sqlite3_stmt *stmt;
-        if (sqlite3_prepare_v2(db_.get(), sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
-            throw std::runtime_error("SQLiteManager::exec: SQL prepare failed: " + std::string(sqlite3_errmsg(db_.get())));
+        if (readers_.empty()) {
+            return prepare(sql);
         }
 
-        // Bind parameters using helper function
-        bindParameters(stmt, params, "exec");
+        auto [reader, lock] = acquireReader();
+        return borrow(*reader, std::move(lock), sql);
+    }
+
+    auto SQLiteManager::exec(const std::string_view sql, const std::vector<Value> &params) const -> int {
+        auto stmt = prepare(sql);
+        stmt.bindAll(params);
+        return stmt.execute();
+    }
 
-        // Execute statement
-        const int rc = sqlite3_step(stmt);
-        const int affected = sqlite3_changes(db_.get());
+    auto SQLiteManager::execBatch(const std::vector<BatchStatement> &statements) const -> std::vector<BatchResult> {
+        std::vector<BatchResult> results(statements.size());
+        if (statements.empty()) {
+            return results;
+        }
 
-        // Cleanup
-        sqlite3_finalize(stmt);
+        std::unique_lock lock(writer_.mutex);
+        if (!writer_.db) {
+            throw std::runtime_error("SQLiteManager::execBatch: Database not open");
+        }
 
-        if (rc != SQLITE_DONE) {
-            throw std::runtime_error("SQLiteManager::exec: SQL execution failed: " + std::string(sqlite3_errmsg(db_.get())));
+        sqlite3 *db = writer_.db.get();
+        execControl(db, "BEGIN IMMEDIATE");
+        try {
+            for (size_t i = 0; i < statements.size(); ++i) {
+                execControl(db, "SAVEPOINT batch_statement");
+                try {
+                    // The writer lock is already held, borrow the statement without taking it again
+                    auto stmt = borrow(writer_, std::unique_lock<std::mutex>{}, statements[i].sql);
+                    stmt.bindAll(statements[i].params);
+                    results[i].affected_rows = stmt.execute();
+                } catch (const Error &e) {
+                    results[i].error = e.what();
+                    results[i].error_code = e.code();
+                    execControl(db, "ROLLBACK TO batch_statement");
+                } catch (const std::exception &e) {
+                    results[i].error = e.what();
+                    results[i].error_code = SQLITE_ERROR;
+                    execControl(db, "ROLLBACK TO batch_statement");
+                }
+                execControl(db, "RELEASE batch_statement");
+            }
+            execControl(db, "COMMIT");
+        } catch (...) {
+            // Never leave the writer connection inside the batch's transaction, later writes would fail or join it
+            sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+            throw;
         }
+        return results;
+    }
 
-        return affected;
+    auto SQLiteManager::query(const std::string_view sql, const std::vector<std::string> &params) const -> std::vector<std::vector<std::string> > {
+        auto stmt = prepareRead(sql);
+        stmt.bindAll(params);
+        return stmt.fetchAll();
     }
 
-    auto SQLiteManager::query(const std::string &sql, const std::vector<std::string> &params) const -> std::vector<std::vector<std::string> > {
-        if (!db_) {
-            throw std::runtime_error("SQLiteManager::query: Database not open");
+    auto SQLiteManager::clearStatementCache() -> void {
+        for (const auto &reader: readers_) {
+            std::lock_guard lock(reader->mutex);
+            reader->statement_cache.clear();
         }
+        std::lock_guard lock(writer_.mutex);
+        writer_.statement_cache.clear();
+    }
 
-        if (sql.empty()) {
-            throw std::invalid_argument("SQLiteManager::query: SQL statement cannot be empty");
+    auto SQLiteManager::readerCount() const noexcept -> size_t {
+        return readers_.size();
+    }
+
+    auto SQLiteManager::isOpen() const -> bool {
+        std::lock_guard lock(writer_.mutex);
+        return writer_.db != nullptr;
+    }
+
+    auto SQLiteManager::borrow(Connection &connection, std::unique_lock<std::mutex> lock, const std::string_view sql) -> PreparedStatement {
+        if (!connection.db) {
+            throw std::runtime_error("SQLiteManager::prepare: Database not open");
         }
 
-        std::vector<std::vector<std::string> > results;
-        sqlite3_stmt *stmt;
+        if (const auto it = connection.statement_cache.find(sql); it != connection.statement_cache.end()) {
+            return PreparedStatement{std::move(lock), connection.db.get(), it->second.get(), true};
+        }
 
-        if (sqlite3_prepare_v2(db_.get(), sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
-            throw std::runtime_error("SQLiteManager::query: Query preparation failed: " + std::string(sqlite3_errmsg(db_.get())));
+        sqlite3_stmt *stmt = nullptr;
+        if (sqlite3_prepare_v3(connection.db.get(), sql.data(), static_cast<int>(sql.size()), SQLITE_PREPARE_PERSISTENT, &stmt, nullptr) != SQLITE_OK) {
+            throw std::runtime_error("SQLiteManager::prepare: SQL prepare failed: " + std::string(sqlite3_errmsg(connection.db.get())));
         }
 
-        // Bind parameters using helper function
-        bindParameters(stmt, params, "query");
+        if (connection.statement_cache.size() >= MAX_CACHED_STATEMENTS) {
+            return PreparedStatement{std::move(lock), connection.db.get(), stmt, false};
+        }
 
-        // Process results
-        while (sqlite3_step(stmt) == SQLITE_ROW) {
-            std::vector<std::string> row;
-            const int cols = sqlite3_column_count(stmt);
+        connection.statement_cache.emplace(std::string(sql), StatementPtr{stmt, &sqlite3_finalize});
+        return PreparedStatement{std::move(lock), connection.db.get(), stmt, true};
+    }
 
-            for (int i = 0; i < cols; ++i) {
-                const unsigned char *col = sqlite3_column_text(stmt, i);
-                row.emplace_back(col ? reinterpret_cast<const char *>(col) : "NULL");
+    auto SQLiteManager::acquireReader() const -> std::pair<Connection *, std::unique_lock<std::mutex> > {
+        const size_t start = next_reader_.fetch_add(1, std::memory_order_relaxed);
+        for (size_t i = 0; i < readers_.size(); ++i) {
+            Connection &reader = *readers_[(start + i) % readers_.size()];
+            if (std::unique_lock lock(reader.mutex, std::try_to_lock); lock.owns_lock()) {
+                return {&reader, std::move(lock)};
             }
-            results.push_back(row);
         }
 
-        sqlite3_finalize(stmt);
-        return results;
+        // Every reader is busy, queue on the one this call was assigned to
+        Connection &reader = *readers_[start % readers_.size()];
+        return {&reader, std::unique_lock(reader.mutex)};
     }
 
-    auto SQLiteManager::isOpen() const -> bool { return db_ != nullptr; }
+    auto SQLiteManager::openConnection(const std::string &db_path, const bool read_only) const -> std::unique_ptr<sqlite3, decltype(&sqlite3_close)> {
+        // Each connection is guarded by its own mutex, so SQLite's internal locking is not needed
+        const int flags = (read_only ? SQLITE_OPEN_READONLY : SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE) | SQLITE_OPEN_NOMUTEX;
 
-    void SQLiteManager::bindParameters(sqlite3_stmt *stmt, const std::vector<std::string> &params, const std::string &method_name) {
-        for (size_t i = 0; i < params.size(); ++i) {
-            if (sqlite3_bind_text(stmt, static_cast<int>(i + 1), params[i].c_str(), -1, SQLITE_STATIC) != SQLITE_OK) {
-                sqlite3_finalize(stmt);
-                throw std::runtime_error("SQLiteManager::" + method_name + ": Parameter binding failed at index " + std::to_string(i));
-            }
+        sqlite3 *raw_db = nullptr;
+        if (sqlite3_open_v2(db_path.c_str(), &raw_db, flags, nullptr) != SQLITE_OK) {
+            const std::string error_msg = "SQLiteManager::createDatabase: Database open failed for path '" + db_path + "': " + std::string(sqlite3_errmsg(raw_db));
+            sqlite3_close(raw_db); // Clean up the failed connection
+            throw std::runtime_error(error_msg);
         }
+        std::unique_ptr<sqlite3, decltype(&sqlite3_close)> db{raw_db, &sqlite3_close};
+
+        sqlite3_busy_timeout(db.get(), options_.busyTimeoutMs());
+
+        // Journal mode and synchronous are persisted per database or only matter for writes
+        std::string pragmas = "PRAGMA cache_size = " + std::to_string(options_.cacheSize()) + "; PRAGMA mmap_size = " + std::to_string(options_.mmapSize()) + ";";
+        if (!read_only) {
+            pragmas += " PRAGMA journal_mode = " + options_.journalMode() + "; PRAGMA synchronous = " + options_.synchronous() + ";";
+        }
+
+        char *error = nullptr;
+        if (sqlite3_exec(db.get(), pragmas.c_str(), nullptr, nullptr, &error) != SQLITE_OK) {
+            const std::string error_msg = "SQLiteManager::createDatabase: Failed to apply pragmas for path '" + db_path + "': " + std::string(error ? error : "unknown error");
+            sqlite3_free(error);
+            throw std::runtime_error(error_msg);
+        }
+        return db;
+    }
+
+    auto SQLiteManager::execControl(sqlite3 *db, const char *sql) -> void {
+        if (sqlite3_exec(db, sql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+            throw std::runtime_error("SQLiteManager::execBatch: '" + std::string(sql) + "' failed: " + std::string(sqlite3_errmsg(db)));
+        }
+    }
+
+    auto SQLiteManager::closeConnection(Connection &connection) noexcept -> void {
+        std::lock_guard lock(connection.mutex);
+        connection.statement_cache.clear();
+        connection.db.reset(nullptr);
+    }
+
+    auto SQLiteManager::isInMemory(const std::string &db_path) noexcept -> bool {
+        return db_path == ":memory:" || db_path.starts_with("file::memory:") || db_path.find("mode=memory") != std::string::npos;
     }
 } // common
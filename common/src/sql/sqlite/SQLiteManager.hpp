@@ -1,21 +1,183 @@
 #pragma once
 #include <sqlite3.h>
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <variant>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <stdexcept>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "SQLiteOptions.hpp"
 
 namespace common::sql::sqlite {
     /// @brief SQLite database executor with RAII management and parameterized queries
+    /// @details Prepared statements are cached per connection keyed by their SQL text, so repeated
+    /// queries skip parsing and planning. Writes go through a single serialized writer connection.
+    /// In WAL mode queries are served by a pool of read-only connections, so readers neither wait
+    /// for each other nor for the writer.
     class SQLiteManager {
     public:
+        /// @brief Raw bytes bound as a BLOB parameter
+        using Blob = std::vector<uint8_t>;
+
+        /// @brief Typed statement parameter, bound as TEXT, INTEGER or BLOB
+        using Value = std::variant<std::string, int64_t, Blob>;
+
+        /// @brief Failure reported by SQLite while executing a statement
+        /// @details Carries the extended result code, so callers can tell constraint violations from other failures.
+        class Error final : public std::runtime_error {
+        public:
+            /// @brief Construct an error with its message and SQLite result code
+            /// @param message Error description
+            /// @param code Extended SQLite result code, e.g. SQLITE_CONSTRAINT_UNIQUE
+            Error(const std::string &message, const int code) : std::runtime_error(message), code_(code) {
+            }
+
+            /// @brief Get the extended SQLite result code
+            [[nodiscard]] auto code() const noexcept -> int {
+                return code_;
+            }
+
+        private:
+            int code_;
+        };
+
+        /// @brief RAII handle to a prepared statement borrowed from the statement cache
+        /// @details The handle holds the connection lock for its whole lifetime, so it must be kept
+        /// short-lived and the owning manager must not be used from the same thread while it is alive.
+        /// On destruction the statement is reset and its bindings are cleared for the next user.
+        class PreparedStatement {
+        public:
+            /// @brief Destructor that returns the statement to the cache
+            ~PreparedStatement();
+
+            /// @brief Copy constructor (deleted)
+            PreparedStatement(const PreparedStatement &) = delete;
+
+            /// @brief Copy assignment operator (deleted)
+            auto operator=(const PreparedStatement &) -> PreparedStatement & = delete;
+
+            /// @brief Move constructor
+            PreparedStatement(PreparedStatement &&other) noexcept;
+
+            /// @brief Move assignment operator (deleted)
+            auto operator=(PreparedStatement &&) -> PreparedStatement & = delete;
+
+            /// @brief Bind a text value to a parameter
+            /// @param index 1-based parameter index
+            /// @param value Text value, copied by SQLite
+            /// @return Reference to this statement for method chaining
+            /// @throws std::runtime_error if binding fails
+            auto bind(int index, std::string_view value) -> PreparedStatement &;
+
+            /// @brief Bind an integer value to a parameter
+            /// @param index 1-based parameter index
+            /// @param value Integer value
+            /// @return Reference to this statement for method chaining
+            /// @throws std::runtime_error if binding fails
+            auto bind(int index, int64_t value) -> PreparedStatement &;
+
+            /// @brief Bind raw bytes to a parameter
+            /// @param index 1-based parameter index
+            /// @param value Bytes, copied by SQLite
+            /// @return Reference to this statement for method chaining
+            /// @throws std::runtime_error if binding fails
+            auto bindBlob(int index, std::span<const uint8_t> value) -> PreparedStatement &;
+
+            /// @brief Bind all parameters in order
+            /// @param params Parameter values, which must outlive the execution of the statement
+            /// @return Reference to this statement for method chaining
+            /// @throws std::runtime_error if binding fails
+            auto bindAll(const std::vector<std::string> &params) -> PreparedStatement &;
+
+            /// @brief Bind all typed parameters in order
+            /// @param params Parameter values, which must outlive the execution of the statement
+            /// @return Reference to this statement for method chaining
+            /// @throws std::runtime_error if binding fails
+            auto bindAll(const std::vector<Value> &params) -> PreparedStatement &;
+
+            /// @brief Advance the statement by one row
+            /// @return true if a row is available, false when the statement has finished
+            /// @throws Error if execution fails
+            [[nodiscard]] auto step() -> bool;
+
+            /// @brief Get the number of columns in the result set
+            /// @return Number of columns
+            [[nodiscard]] auto columnCount() const noexcept -> int;
+
+            /// @brief Get a column of the current row as text
+            /// @param index 0-based column index
+            /// @return Column value, "NULL" for SQL NULL
+            [[nodiscard]] auto columnText(int index) const -> std::string;
+
+            /// @brief Get a column of the current row as an integer
+            /// @param index 0-based column index
+            /// @return Column value, 0 for SQL NULL
+            [[nodiscard]] auto columnInt64(int index) const noexcept -> int64_t;
+
+            /// @brief Get a column of the current row as raw bytes without copying
+            /// @param index 0-based column index
+            /// @return Column bytes, valid until the statement is stepped or released; empty for SQL NULL
+            [[nodiscard]] auto columnBlob(int index) const noexcept -> std::span<const uint8_t>;
+
+            /// @brief Run a non-query statement to completion
+            /// @return Number of affected rows
+            /// @throws std::runtime_error if execution fails
+            [[nodiscard]] auto execute() -> int;
+
+            /// @brief Run a query to completion and collect all rows
+            /// @return Query results in format [rows][columns]
+            /// @throws std::runtime_error if execution fails
+            [[nodiscard]] auto fetchAll() -> std::vector<std::vector<std::string> >;
+
+            /// @brief Access the underlying SQLite statement
+            /// @return Raw statement pointer owned by the cache
+            [[nodiscard]] auto get() const noexcept -> sqlite3_stmt *;
+
+        private:
+            friend class SQLiteManager;
+
+            /// @brief Construct a handle over a statement while holding the connection lock
+            PreparedStatement(std::unique_lock<std::mutex> lock, sqlite3 *db, sqlite3_stmt *stmt, bool cached) noexcept;
+
+            std::unique_lock<std::mutex> lock_;
+            sqlite3 *db_;
+            sqlite3_stmt *stmt_;
+            bool cached_; ///< Uncached statements are finalized instead of reset on destruction
+        };
+
+        /// @brief A parameterized statement executed as part of a batch
+        struct BatchStatement {
+            std::string sql;
+            std::vector<Value> params;
+        };
+
+        /// @brief Outcome of one statement of a batch
+        struct BatchResult {
+            int affected_rows{0};
+            std::string error; ///< Empty if the statement succeeded
+            int error_code{SQLITE_OK}; ///< Extended SQLite result code of a failed statement
+
+            /// @brief Check whether the statement succeeded
+            [[nodiscard]] auto ok() const noexcept -> bool {
+                return error.empty();
+            }
+        };
+
         /// @brief Default constructor
         SQLiteManager();
 
         /// @brief Constructor that opens the database file (creates it if not exists)
         /// @param db_path Path to the SQLite database file
+        /// @param options Pragmas and reader pool configuration
         /// @throws std::runtime_error if database cannot be opened
-        explicit SQLiteManager(const std::string &db_path);
+        explicit SQLiteManager(const std::string &db_path, SQLiteOptions options = SQLiteOptions());
 
         /// @brief Destructor that automatically closes the database connection
         ~SQLiteManager();
@@ -25,35 +187,112 @@ namespace common::sql::sqlite {
         /// @throws std::runtime_error if database cannot be opened
         void createDatabase(const std::string &db_path);
 
-        /// @brief Closes database connection
+        /// @brief Closes the writer and all reader connections
+        /// @details Must not run concurrently with other operations on this manager.
         void closeDatabase();
 
+        /// @brief Borrow a prepared statement on the writer connection, preparing it on first use
+        /// @param sql SQL statement to prepare
+        /// @return Handle holding the writer lock until it is destroyed
+        /// @throws std::runtime_error if the database is not open or preparation fails
+        [[nodiscard]] auto prepare(std::string_view sql) const -> PreparedStatement;
+
+        /// @brief Borrow a prepared statement on a read-only connection, preparing it on first use
+        /// @param sql Read-only SQL statement to prepare
+        /// @return Handle holding the reader lock until it is destroyed
+        /// @throws std::runtime_error if the database is not open or preparation fails
+        /// @details Falls back to the writer connection when the reader pool is disabled.
+        [[nodiscard]] auto prepareRead(std::string_view sql) const -> PreparedStatement;
+
         /// @brief Executes non-query SQL statements (INSERT/UPDATE/DELETE)
         /// @param sql SQL statement to execute
         /// @param params Parameter values for prepared statement
         /// @return Number of affected rows
         /// @throws std::runtime_error if execution fails
-        [[nodiscard]] auto exec(const std::string &sql, const std::vector<std::string> &params = {}) const -> int;
+        [[nodiscard]] auto exec(std::string_view sql, const std::vector<Value> &params = {}) const -> int;
+
+        /// @brief Executes several non-query statements in a single transaction
+        /// @param statements Statements to execute in order
+        /// @return One result per statement
+        /// @throws std::runtime_error if the transaction cannot be started or committed, or a savepoint cannot be rolled back or released
+        /// @details Every statement runs inside its own savepoint, so a failing statement is rolled back
+        /// and reported without affecting the others. All successful statements become durable together
+        /// with a single commit. If an exception escapes, the whole transaction has been rolled back.
+        [[nodiscard]] auto execBatch(const std::vector<BatchStatement> &statements) const -> std::vector<BatchResult>;
 
-        /// @brief Executes a query and returns results as a 2D string vector
+        /// @brief Executes a read-only query and returns results as a 2D string vector
         /// @param sql SQL query to execute
         /// @param params Parameter values for prepared statement
         /// @return Query results in format [rows][columns]
         /// @throws std::runtime_error if query fails
-        [[nodiscard]] auto query(const std::string &sql, const std::vector<std::string> &params = {}) const -> std::vector<std::vector<std::string> >;
+        [[nodiscard]] auto query(std::string_view sql, const std::vector<std::string> &params = {}) const -> std::vector<std::vector<std::string> >;
+
+        /// @brief Finalize every cached prepared statement on all connections
+        auto clearStatementCache() -> void;
+
+        /// @brief Get the number of open read-only connections
+        /// @return Reader pool size, 0 if queries go through the writer
+        [[nodiscard]] auto readerCount() const noexcept -> size_t;
 
         /// @brief Check if database is open
         /// @return true if database is open, false otherwise
         [[nodiscard]] auto isOpen() const -> bool;
 
     private:
-        /// @brief Helper function to bind parameters to a prepared statement
-        /// @param stmt SQLite statement to bind parameters to
-        /// @param params Vector of parameter values to bind
-        /// @param method_name Name of the calling method for error reporting
-        /// @throws std::runtime_error if parameter binding fails
-        static void bindParameters(sqlite3_stmt *stmt, const std::vector<std::string> &params, const std::string &method_name);
-
-        std::unique_ptr<sqlite3, decltype(&sqlite3_close)> db_;
+        /// @brief Transparent hash so cached statements can be looked up by std::string_view
+        struct SqlHash {
+            using is_transparent = void;
+
+            auto operator()(const std::string_view sql) const noexcept -> size_t {
+                return std::hash<std::string_view>{}(sql);
+            }
+        };
+
+        using StatementPtr = std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)>;
+
+        /// @brief One SQLite connection together with its lock and statement cache
+        struct Connection {
+            std::unique_ptr<sqlite3, decltype(&sqlite3_close)> db{nullptr, &sqlite3_close};
+            std::mutex mutex;
+            std::unordered_map<std::string, StatementPtr, SqlHash, std::equal_to<> > statement_cache;
+        };
+
+        /// @brief Upper bound on cached statements per connection; statements beyond it are prepared per call
+        static constexpr size_t MAX_CACHED_STATEMENTS = 64;
+
+        /// @brief Borrow a cached statement from a connection whose lock is already held
+        /// @param connection Connection to prepare the statement on
+        /// @param lock Lock on the connection mutex, moved into the returned handle
+        /// @param sql SQL statement to prepare
+        /// @return Handle over the cached or freshly prepared statement
+        [[nodiscard]] static auto borrow(Connection &connection, std::unique_lock<std::mutex> lock, std::string_view sql) -> PreparedStatement;
+
+        /// @brief Lock a reader connection, preferring one that is currently idle
+        /// @return The locked connection and its lock
+        [[nodiscard]] auto acquireReader() const -> std::pair<Connection *, std::unique_lock<std::mutex> >;
+
+        /// @brief Open a connection and apply the configured pragmas
+        /// @param db_path Path to the SQLite database file
+        /// @param read_only Whether to open the connection read-only
+        /// @return Opened connection
+        /// @throws std::runtime_error if the connection cannot be opened or configured
+        [[nodiscard]] auto openConnection(const std::string &db_path, bool read_only) const -> std::unique_ptr<sqlite3, decltype(&sqlite3_close)>;
+
+        /// @brief Run a transaction control statement on a connection whose lock is already held
+        /// @param db Connection to run the statement on
+        /// @param sql Statement without parameters
+        /// @throws std::runtime_error if the statement fails
+        static auto execControl(sqlite3 *db, const char *sql) -> void;
+
+        /// @brief Close a connection after finalizing its cached statements
+        static auto closeConnection(Connection &connection) noexcept -> void;
+
+        /// @brief Check whether a path names an in-memory database, which cannot be shared by a reader pool
+        [[nodiscard]] static auto isInMemory(const std::string &db_path) noexcept -> bool;
+
+        SQLiteOptions options_;
+        mutable Connection writer_;
+        std::vector<std::unique_ptr<Connection> > readers_;
+        mutable std::atomic<size_t> next_reader_{0};
     };
 } // common
@@ -0,0 +1,253 @@
+#include "SQLiteOptions.hpp"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <string_view>
+#include <utility>
+#include <yaml-cpp/yaml.h>
+#include <glog/logging.h>
+#include <fmt/format.h>
+#include "src/filesystem/type/YamlToolkit.hpp"
+
+namespace common::sql::sqlite {
+    SQLiteOptions::SQLiteOptions() = default;
+
+    SQLiteOptions::SQLiteOptions(std::string journal_mode, std::string synchronous, const int64_t mmap_size, const int32_t cache_size, const int32_t busy_timeout_ms, const int32_t reader_pool_size, const int32_t group_commit_max_batch, const int32_t group_commit_interval_ms, const int32_t shard_count) : journal_mode_(std::move(journal_mode)), synchronous_(std::move(synchronous)), mmap_size_(mmap_size), cache_size_(cache_size), busy_timeout_ms_(busy_timeout_ms), reader_pool_size_(reader_pool_size), group_commit_max_batch_(group_commit_max_batch), group_commit_interval_ms_(group_commit_interval_ms), shard_count_(shard_count) {
+        validateParameters();
+    }
+
+    auto SQLiteOptions::journalMode() const noexcept -> const std::string & {
+        return journal_mode_;
+    }
+
+    auto SQLiteOptions::journalMode(const std::string &value) -> void {
+        journal_mode_ = value;
+    }
+
+    auto SQLiteOptions::synchronous() const noexcept -> const std::string & {
+        return synchronous_;
+    }
+
+    auto SQLiteOptions::synchronous(const std::string &value) -> void {
+        synchronous_ = value;
+    }
+
+    auto SQLiteOptions::mmapSize() const noexcept -> int64_t {
+        return mmap_size_;
+    }
+
+    auto SQLiteOptions::mmapSize(const int64_t value) noexcept -> void {
+        mmap_size_ = value;
+    }
+
+    auto SQLiteOptions::cacheSize() const noexcept -> int32_t {
+        return cache_size_;
+    }
+
+    auto SQLiteOptions::cacheSize(const int32_t value) noexcept -> void {
+        cache_size_ = value;
+    }
+
+    auto SQLiteOptions::busyTimeoutMs() const noexcept -> int32_t {
+        return busy_timeout_ms_;
+    }
+
+    auto SQLiteOptions::busyTimeoutMs(const int32_t value) noexcept -> void {
+        busy_timeout_ms_ = value;
+    }
+
+    auto SQLiteOptions::readerPoolSize() const noexcept -> int32_t {
+        return reader_pool_size_;
+    }
+
+    auto SQLiteOptions::readerPoolSize(const int32_t value) noexcept -> void {
+        reader_pool_size_ = value;
+    }
+
+    auto SQLiteOptions::groupCommitMaxBatch() const noexcept -> int32_t {
+        return group_commit_max_batch_;
+    }
+
+    auto SQLiteOptions::groupCommitMaxBatch(const int32_t value) noexcept -> void {
+        group_commit_max_batch_ = value;
+    }
+
+    auto SQLiteOptions::groupCommitIntervalMs() const noexcept -> int32_t {
+        return group_commit_interval_ms_;
+    }
+
+    auto SQLiteOptions::groupCommitIntervalMs(const int32_t value) noexcept -> void {
+        group_commit_interval_ms_ = value;
+    }
+
+    auto SQLiteOptions::shardCount() const noexcept -> int32_t {
+        return shard_count_;
+    }
+
+    auto SQLiteOptions::shardCount(const int32_t value) noexcept -> void {
+        shard_count_ = value;
+    }
+
+    auto SQLiteOptions::useGroupCommit() const noexcept -> bool {
+        return group_commit_max_batch_ > 0;
+    }
+
+    auto SQLiteOptions::useReaderPool() const noexcept -> bool {
+        return journal_mode_ == "WAL" && reader_pool_size_ > 0;
+    }
+
+    auto SQLiteOptions::deserializedFromYamlFile(const std::filesystem::path &path) -> void {
+        if (!std::filesystem::exists(path)) {
+            const std::string error_msg = fmt::format("Configuration file does not exist: {}", path.string());
+            LOG(ERROR) << error_msg;
+            throw std::runtime_error(error_msg);
+        }
+
+        try {
+            const YAML::Node root = filesystem::YamlToolkit::read(path.string());
+            const YAML::Node sqliteNode = filesystem::YamlToolkit::getNodeOrRoot(root, "sqlite");
+
+            // Table-driven configuration loading for SQLite parameters
+            const std::vector<std::pair<std::string, std::function<void()> > > config_handlers = {
+                {"journalMode", [&]() { journal_mode_ = sqliteNode["journalMode"].as<std::string>(); }}, {"synchronous", [&]() { synchronous_ = sqliteNode["synchronous"].as<std::string>(); }}, {"mmapSize", [&]() { mmap_size_ = sqliteNode["mmapSize"].as<int64_t>(); }},
+                {"cacheSize", [&]() { cache_size_ = sqliteNode["cacheSize"].as<int32_t>(); }}, {"busyTimeoutMs", [&]() { busy_timeout_ms_ = sqliteNode["busyTimeoutMs"].as<int32_t>(); }}, {"readerPoolSize", [&]() { reader_pool_size_ = sqliteNode["readerPoolSize"].as<int32_t>(); }}, {"groupCommitMaxBatch", [&]() { group_commit_max_batch_ = sqliteNode["groupCommitMaxBatch"].as<int32_t>(); }}, {"groupCommitIntervalMs", [&]() { group_commit_interval_ms_ = sqliteNode["groupCommitIntervalMs"].as<int32_t>(); }},
+                {"shardCount", [&]() { shard_count_ = sqliteNode["shardCount"].as<int32_t>(); }}
+            };
+
+            for (const auto &[key, handler]: config_handlers) {
+                if (sqliteNode[key]) {
+                    handler();
+                }
+            }
+        } catch (const YAML::Exception &e) {
+            const std::string error_msg = fmt::format("Failed to parse YAML file '{}': {}", path.string(), e.what());
+            LOG(ERROR) << error_msg;
+            throw std::runtime_error(std::move(error_msg));
+        } catch (const std::exception &e) {
+            const std::string error_msg = fmt::format("Error processing configuration file '{}': {}", path.string(), e.what());
+            LOG(ERROR) << error_msg;
+            throw std::runtime_error(std::move(error_msg));
+        }
+
+        validateParameters();
+    }
+
+    auto SQLiteOptions::validateParameters() const -> void {
+        // Pragma values are interpolated into SQL, so only these keywords are accepted
+        static constexpr std::array<std::string_view, 6> journal_modes = {"DELETE", "TRUNCATE", "PERSIST", "MEMORY", "WAL", "OFF"};
+        static constexpr std::array<std::string_view, 4> synchronous_levels = {"OFF", "NORMAL", "FULL", "EXTRA"};
+
+        // Table-driven validation for parameter checks
+        const std::vector<std::tuple<bool, std::string, const char *> > validations = {
+            std::make_tuple(std::ranges::find(journal_modes, journal_mode_) == journal_modes.end(), fmt::format("Invalid journal mode: '{}'. Valid values are DELETE, TRUNCATE, PERSIST, MEMORY, WAL or OFF.", journal_mode_), "journal_mode_"), std::make_tuple(std::ranges::find(synchronous_levels, synchronous_) == synchronous_levels.end(), fmt::format("Invalid synchronous level: '{}'. Valid values are OFF, NORMAL, FULL or EXTRA.", synchronous_), "synchronous_"),
+            std::make_tuple(mmap_size_ < 0, fmt::format("Invalid mmap size: {}. Value must be greater than or equal to 0.", mmap_size_), "mmap_size_"), std::make_tuple(busy_timeout_ms_ < 0, fmt::format("Invalid busy timeout: {}ms. Value must be greater than or equal to 0.", busy_timeout_ms_), "busy_timeout_ms_"),
+            std::make_tuple(reader_pool_size_ < 0, fmt::format("Invalid reader pool size: {}. Value must be greater than or equal to 0.", reader_pool_size_), "reader_pool_size_"), std::make_tuple(group_commit_max_batch_ < 0, fmt::format("Invalid group commit batch size: {}. Value must be greater than or equal to 0.", group_commit_max_batch_), "group_commit_max_batch_"),
+            std::make_tuple(group_commit_interval_ms_ <= 0, fmt::format("Invalid group commit interval: {}ms. Value must be greater than 0.", group_commit_interval_ms_), "group_commit_interval_ms_"),
+            std::make_tuple(shard_count_ <= 0, fmt::format("Invalid shard count: {}. Value must be greater than 0.", shard_count_), "shard_count_")
+        };
+
+        for (const auto &[condition, error_message, param_name]: validations) {
+            if (condition) {
+                LOG(ERROR) << error_message;
+                throw std::invalid_argument(error_message);
+            }
+        }
+
+        // Table-driven validation for warning conditions
+        const std::vector<std::tuple<bool, std::string> > warning_checks = {
+            std::make_tuple(reader_pool_size_ > 0 && journal_mode_ != "WAL", fmt::format("Reader pool size is {} but journal mode is {}. Readers are only used in WAL mode, queries will go through the writer connection.", reader_pool_size_, journal_mode_)),
+            std::make_tuple(synchronous_ == "OFF", fmt::format("Synchronous is OFF. Committed transactions may be lost or the database corrupted on power loss.")),
+            std::make_tuple(group_commit_max_batch_ > 0 && group_commit_interval_ms_ > 100, fmt::format("Group commit interval is set to {}ms. Every write may wait that long before it is acknowledged.", group_commit_interval_ms_)),
+            std::make_tuple(shard_count_ > 1 && reader_pool_size_ * shard_count_ > 64, fmt::format("{} shards with {} readers each open {} reader connections.", shard_count_, reader_pool_size_, reader_pool_size_ * shard_count_))
+        };
+
+        for (const auto &[condition, warning_message]: warning_checks) {
+            if (condition) {
+                LOG(WARNING) << warning_message;
+            }
+        }
+    }
+
+    auto SQLiteOptions::Builder::journalMode(const std::string &value) -> Builder & {
+        journal_mode_ = value;
+        return *this;
+    }
+
+    auto SQLiteOptions::Builder::synchronous(const std::string &value) -> Builder & {
+        synchronous_ = value;
+        return *this;
+    }
+
+    auto SQLiteOptions::Builder::mmapSize(const int64_t value) noexcept -> Builder & {
+        mmap_size_ = value;
+        return *this;
+    }
+
+    auto SQLiteOptions::Builder::cacheSize(const int32_t value) noexcept -> Builder & {
+        cache_size_ = value;
+        return *this;
+    }
+
+    auto SQLiteOptions::Builder::busyTimeoutMs(const int32_t value) noexcept -> Builder & {
+        busy_timeout_ms_ = value;
+        return *this;
+    }
+
+    auto SQLiteOptions::Builder::readerPoolSize(const int32_t value) noexcept -> Builder & {
+        reader_pool_size_ = value;
+        return *this;
+    }
+
+    auto SQLiteOptions::Builder::groupCommitMaxBatch(const int32_t value) noexcept -> Builder & {
+        group_commit_max_batch_ = value;
+        return *this;
+    }
+
+    auto SQLiteOptions::Builder::groupCommitIntervalMs(const int32_t value) noexcept -> Builder & {
+        group_commit_interval_ms_ = value;
+        return *this;
+    }
+
+    auto SQLiteOptions::Builder::shardCount(const int32_t value) noexcept -> Builder & {
+        shard_count_ = value;
+        return *this;
+    }
+
+    auto SQLiteOptions::Builder::build() const -> SQLiteOptions {
+        return SQLiteOptions{journal_mode_, synchronous_, mmap_size_, cache_size_, busy_timeout_ms_, reader_pool_size_, group_commit_max_batch_, group_commit_interval_ms_, shard_count_};
+    }
+
+    auto SQLiteOptions::builder() -> Builder {
+        return Builder{};
+    }
+}
+
+auto YAML::convert<common::sql::sqlite::SQLiteOptions>::decode(const Node &node, common::sql::sqlite::SQLiteOptions &rhs) -> bool {
+    const std::vector<std::pair<std::string, std::function<void()> > > config_handlers = {
+        {"journalMode", [&]() { rhs.journalMode(node["journalMode"].as<std::string>()); }}, {"synchronous", [&]() { rhs.synchronous(node["synchronous"].as<std::string>()); }}, {"mmapSize", [&]() { rhs.mmapSize(node["mmapSize"].as<int64_t>()); }},
+        {"cacheSize", [&]() { rhs.cacheSize(node["cacheSize"].as<int32_t>()); }}, {"busyTimeoutMs", [&]() { rhs.busyTimeoutMs(node["busyTimeoutMs"].as<int32_t>()); }}, {"readerPoolSize", [&]() { rhs.readerPoolSize(node["readerPoolSize"].as<int32_t>()); }}, {"groupCommitMaxBatch", [&]() { rhs.groupCommitMaxBatch(node["groupCommitMaxBatch"].as<int32_t>()); }}, {"groupCommitIntervalMs", [&]() { rhs.groupCommitIntervalMs(node["groupCommitIntervalMs"].as<int32_t>()); }},
+        {"shardCount", [&]() { rhs.shardCount(node["shardCount"].as<int32_t>()); }}
+    };
+
+    for (const auto &[key, handler]: config_handlers) {
+        if (node[key]) {
+            handler();
+        }
+    }
+    return true;
+}
+
+auto YAML::convert<common::sql::sqlite::SQLiteOptions>::encode(const common::sql::sqlite::SQLiteOptions &rhs) -> Node {
+    Node node;
+    node["journalMode"] = rhs.journalMode();
+    node["synchronous"] = rhs.synchronous();
+    node["mmapSize"] = rhs.mmapSize();
+    node["cacheSize"] = rhs.cacheSize();
+    node["busyTimeoutMs"] = rhs.busyTimeoutMs();
+    node["readerPoolSize"] = rhs.readerPoolSize();
+    node["groupCommitMaxBatch"] = rhs.groupCommitMaxBatch();
+    node["groupCommitIntervalMs"] = rhs.groupCommitIntervalMs();
+    node["shardCount"] = rhs.shardCount();
+    return node;
+}
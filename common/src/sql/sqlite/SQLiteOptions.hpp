@@ -0,0 +1,270 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <yaml-cpp/node/node.h>
+
+#include "src/serializer/interface/IYamlConfigurable.hpp"
+
+namespace common::sql::sqlite {
+    /// @brief A class that holds SQLite connection tuning options
+    /// @details This class encapsulates the pragmas applied to every connection opened by
+    /// SQLiteManager, the size of its read-only connection pool and the number of database files
+    /// a store is sharded across. The configuration
+    /// parameters can be loaded from the "sqlite" section of a YAML configuration file.
+    ///
+    /// Example usage:
+    /// @code
+    /// auto options = SQLiteOptions::builder()
+    ///     .journalMode("WAL")
+    ///     .synchronous("NORMAL")
+    ///     .mmapSize(268435456)
+    ///     .cacheSize(-16000)
+    ///     .busyTimeoutMs(5000)
+    ///     .readerPoolSize(4)
+    ///     .groupCommitMaxBatch(256)
+    ///     .groupCommitIntervalMs(5)
+    ///     .shardCount(1)
+    ///     .build();
+    /// @endcode
+    class SQLiteOptions final : public interfaces::IYamlConfigurable {
+    public:
+        SQLiteOptions();
+
+        /// @brief Constructor with all parameters
+        SQLiteOptions(std::string journal_mode, std::string synchronous, int64_t mmap_size, int32_t cache_size, int32_t busy_timeout_ms, int32_t reader_pool_size, int32_t group_commit_max_batch, int32_t group_commit_interval_ms, int32_t shard_count);
+
+        /// @brief Get the journal mode
+        /// @return The journal mode pragma value (DELETE, TRUNCATE, PERSIST, MEMORY, WAL or OFF)
+        /// @details In WAL mode readers do not block the writer and the writer does not block
+        /// readers, which is what allows SQLiteManager to serve queries from a reader pool.
+        [[nodiscard]] auto journalMode() const noexcept -> const std::string &;
+
+        /// @brief Set the journal mode
+        /// @param value The journal mode pragma value
+        auto journalMode(const std::string &value) -> void;
+
+        /// @brief Get the synchronous level
+        /// @return The synchronous pragma value (OFF, NORMAL, FULL or EXTRA)
+        /// @details FULL by default. NORMAL is durable against application crashes in WAL mode but
+        /// may lose the most recent transactions on power loss, so it has to be chosen explicitly.
+        [[nodiscard]] auto synchronous() const noexcept -> const std::string &;
+
+        /// @brief Set the synchronous level
+        /// @param value The synchronous pragma value
+        auto synchronous(const std::string &value) -> void;
+
+        /// @brief Get the memory-mapped I/O size in bytes
+        /// @return The mmap_size pragma value, 0 disables memory-mapped I/O
+        [[nodiscard]] auto mmapSize() const noexcept -> int64_t;
+
+        /// @brief Set the memory-mapped I/O size in bytes
+        /// @param value The mmap_size pragma value
+        auto mmapSize(int64_t value) noexcept -> void;
+
+        /// @brief Get the page cache size
+        /// @return The cache_size pragma value, positive in pages or negative in KiB
+        [[nodiscard]] auto cacheSize() const noexcept -> int32_t;
+
+        /// @brief Set the page cache size
+        /// @param value The cache_size pragma value
+        auto cacheSize(int32_t value) noexcept -> void;
+
+        /// @brief Get the busy timeout in milliseconds
+        /// @return How long a connection waits for a lock held by another connection
+        [[nodiscard]] auto busyTimeoutMs() const noexcept -> int32_t;
+
+        /// @brief Set the busy timeout in milliseconds
+        /// @param value How long a connection waits for a lock held by another connection
+        auto busyTimeoutMs(int32_t value) noexcept -> void;
+
+        /// @brief Get the number of read-only connections
+        /// @return The reader pool size, 0 routes queries through the writer connection
+        /// @details The pool is only used in WAL mode for file-backed databases.
+        [[nodiscard]] auto readerPoolSize() const noexcept -> int32_t;
+
+        /// @brief Set the number of read-only connections
+        /// @param value The reader pool size
+        auto readerPoolSize(int32_t value) noexcept -> void;
+
+        /// @brief Get the maximum number of writes committed in one group
+        /// @return The group commit batch size, 0 disables group commit
+        /// @details When enabled, concurrent mutations are queued and committed together in one transaction,
+        /// so a whole batch pays for a single fsync. Each caller still returns only after its batch committed.
+        [[nodiscard]] auto groupCommitMaxBatch() const noexcept -> int32_t;
+
+        /// @brief Set the maximum number of writes committed in one group
+        /// @param value The group commit batch size, 0 disables group commit
+        auto groupCommitMaxBatch(int32_t value) noexcept -> void;
+
+        /// @brief Get the group commit interval in milliseconds
+        /// @return How long the first queued write waits for others to join its batch
+        [[nodiscard]] auto groupCommitIntervalMs() const noexcept -> int32_t;
+
+        /// @brief Set the group commit interval in milliseconds
+        /// @param value How long the first queued write waits for others to join its batch
+        auto groupCommitIntervalMs(int32_t value) noexcept -> void;
+
+        /// @brief Get the number of database files a store is sharded across
+        /// @return Shard count, 1 keeps a single file
+        /// @details Every shard has its own writer connection, reader pool and group-commit writer, so
+        /// writes to different shards do not wait for each other. Changing the count of an existing
+        /// store requires resharding it offline with script/reshard_users.py.
+        [[nodiscard]] auto shardCount() const noexcept -> int32_t;
+
+        /// @brief Set the number of database files a store is sharded across
+        /// @param value Shard count, 1 keeps a single file
+        auto shardCount(int32_t value) noexcept -> void;
+
+        /// @brief Check whether mutations are committed in groups
+        /// @return true if the group commit batch size is greater than 0
+        [[nodiscard]] auto useGroupCommit() const noexcept -> bool;
+
+        /// @brief Check whether queries can be served by dedicated reader connections
+        /// @return true if journal mode is WAL and the reader pool is not empty
+        [[nodiscard]] auto useReaderPool() const noexcept -> bool;
+
+        /// @brief Deserialize object configuration from a YAML file
+        /// @param path The file path to the YAML configuration file
+        /// @throws std::runtime_error If the file cannot be read or parsed
+        /// @details The expected YAML structure is:
+        /// @code
+        /// sqlite:
+        ///   journalMode: "WAL"
+        ///   synchronous: "NORMAL"
+        ///   mmapSize: 268435456
+        ///   cacheSize: -16000
+        ///   busyTimeoutMs: 5000
+        ///   readerPoolSize: 4
+        ///   groupCommitMaxBatch: 256
+        ///   groupCommitIntervalMs: 5
+        ///   shardCount: 1
+        /// @endcode
+        auto deserializedFromYamlFile(const std::filesystem::path &path) -> void override;
+
+        /// @brief Validate SQLite parameters for correctness
+        /// @details Pragma values are interpolated into SQL, so only the documented keywords are accepted.
+        auto validateParameters() const -> void;
+
+        /// @brief Builder class for constructing SQLiteOptions instances
+        class Builder {
+        public:
+            /// @brief Set the journal mode
+            /// @param value The journal mode pragma value
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto journalMode(const std::string &value) -> Builder &;
+
+            /// @brief Set the synchronous level
+            /// @param value The synchronous pragma value
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto synchronous(const std::string &value) -> Builder &;
+
+            /// @brief Set the memory-mapped I/O size in bytes
+            /// @param value The mmap_size pragma value
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto mmapSize(int64_t value) noexcept -> Builder &;
+
+            /// @brief Set the page cache size
+            /// @param value The cache_size pragma value
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto cacheSize(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the busy timeout in milliseconds
+            /// @param value The busy timeout in milliseconds
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto busyTimeoutMs(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the number of read-only connections
+            /// @param value The reader pool size
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto readerPoolSize(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the maximum number of writes committed in one group
+            /// @param value The group commit batch size, 0 disables group commit
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto groupCommitMaxBatch(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the group commit interval in milliseconds
+            /// @param value How long the first queued write waits for others to join its batch
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto groupCommitIntervalMs(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the number of database files a store is sharded across
+            /// @param value Shard count, 1 keeps a single file
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto shardCount(int32_t value) noexcept -> Builder &;
+
+            /// @brief Build the SQLiteOptions instance with the configured parameters
+            /// @return A new SQLiteOptions instance with the configured values
+            [[nodiscard]] auto build() const -> SQLiteOptions;
+
+        private:
+            std::string journal_mode_{"DELETE"};
+            std::string synchronous_{"FULL"};
+            int64_t mmap_size_{0};
+            int32_t cache_size_{-2000};
+            int32_t busy_timeout_ms_{5000};
+            int32_t reader_pool_size_{0};
+            int32_t group_commit_max_batch_{0};
+            int32_t group_commit_interval_ms_{5};
+            int32_t shard_count_{1};
+        };
+
+        /// @brief Create a new Builder instance for constructing SQLiteOptions
+        /// @return A new Builder instance with default values
+        static auto builder() -> Builder;
+
+    private:
+        /// @brief Journal mode pragma value
+        /// @details Default value is "DELETE", the SQLite default.
+        std::string journal_mode_{"DELETE"};
+
+        /// @brief Synchronous pragma value
+        /// @details Default value is "FULL", the SQLite default.
+        std::string synchronous_{"FULL"};
+
+        /// @brief Memory-mapped I/O size in bytes
+        /// @details Default value is 0 (disabled).
+        int64_t mmap_size_{0};
+
+        /// @brief Page cache size, positive in pages or negative in KiB
+        /// @details Default value is -2000 (about 2 MiB), the SQLite default.
+        int32_t cache_size_{-2000};
+
+        /// @brief Busy timeout in milliseconds
+        /// @details Default value is 5 seconds.
+        int32_t busy_timeout_ms_{5000};
+
+        /// @brief Number of read-only connections
+        /// @details Default value is 0, since readers are only used in WAL mode.
+        int32_t reader_pool_size_{0};
+
+        /// @brief Maximum number of writes committed in one group
+        /// @details Default value is 0 (group commit disabled).
+        int32_t group_commit_max_batch_{0};
+
+        /// @brief Group commit interval in milliseconds
+        /// @details Default value is 5 milliseconds.
+        int32_t group_commit_interval_ms_{5};
+
+        /// @brief Number of database files a store is sharded across
+        /// @details Default value is 1 (a single file).
+        int32_t shard_count_{1};
+    };
+}
+
+/// @brief YAML serialization specialization for SQLiteOptions.
+/// Provides methods to encode and decode SQLiteOptions to/from YAML nodes.
+template<>
+struct YAML::convert<common::sql::sqlite::SQLiteOptions> {
+    /// @brief Decode a YAML node into a SQLiteOptions object.
+    /// @param node The YAML node containing the configuration data.
+    /// @param rhs The SQLiteOptions object to populate.
+    /// @return True if decoding was successful.
+    static auto decode(const Node &node, common::sql::sqlite::SQLiteOptions &rhs) -> bool;
+
+    /// @brief Encode a SQLiteOptions object into a YAML node.
+    /// @param rhs The SQLiteOptions object to encode.
+    /// @return A YAML node containing the configuration data.
+    static auto encode(const common::sql::sqlite::SQLiteOptions &rhs) -> Node;
+};
@@ -36,6 +36,22 @@ namespace common::thread {
         }
     }
 
+    auto ThreadPool::tryExecute(std::function<void()> task) -> bool {
+        if (stop_) {
+            return false;
+        }
+
+        {
+            std::unique_lock lock(queue_mutex_);
+            if (stop_ || task_queue_.size() >= max_queue_size_) {
+                return false;
+            }
+            task_queue_.push(std::move(task));
+        }
+        condition_.notify_one();
+        return true;
+    }
+
     auto ThreadPool::shutdown() -> void {
         {
             std::unique_lock lock(queue_mutex_);
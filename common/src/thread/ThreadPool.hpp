@@ -10,6 +10,7 @@
 #include <type_traits>
 #include <stdexcept>
 #include <memory>
+#include <optional>
 
 namespace common::thread {
     /// @brief A thread pool implementation that manages a pool of worker threads to execute tasks asynchronously
@@ -37,6 +38,25 @@ namespace common::thread {
         template<class F, class... Args>
         [[nodiscard]] auto submit(F &&f, Args &&... args) -> std::future<std::invoke_result_t<F, Args...> >;
 
+        /// @brief Submit a task without throwing when the pool cannot accept it
+        /// @tparam F The type of the function to be executed
+        /// @tparam Args The types of the arguments to pass to the function
+        /// @param f The function to be executed
+        /// @param args The arguments to pass to the function
+        /// @return A future for the result, or std::nullopt if the queue is full or the pool is stopped
+        /// @details Intended for callers that shed load on saturation, where a rejected task is an
+        /// expected outcome rather than an error.
+        template<class F, class... Args>
+        [[nodiscard]] auto trySubmit(F &&f, Args &&... args) -> std::optional<std::future<std::invoke_result_t<F, Args...> > >;
+
+        /// @brief Queue a task whose result nobody waits for, without throwing when the pool cannot accept it
+        /// @param task The task to execute; it must not throw, nothing would catch the exception
+        /// @return true if the task was queued, false if the queue is full or the pool is stopped
+        /// @details Unlike trySubmit no packaged task and no shared state are created, so a task small
+        /// enough for std::function's inline storage, such as a lambda capturing one pointer, is queued
+        /// without any allocation once the queue has grown to its working size.
+        [[nodiscard]] auto tryExecute(std::function<void()> task) -> bool;
+
         /// @brief Gracefully shutdown the thread pool, waiting for all tasks to complete
         auto shutdown() -> void;
 
@@ -86,14 +106,31 @@ namespace common::thread {
             if (task_queue_.size() >= max_queue_size_) {
                 throw std::runtime_error("ThreadPool::submit: Task queue is full");
             }
-            task_queue_.emplace([task] {
-                try {
-                    (*task)();
-                } catch (...) {
-                    // If the task throws, propagate the exception through the future
-                    task->set_exception(std::current_exception());
-                }
-            });
+            // packaged_task stores any exception thrown by the task in the shared state of the future
+            task_queue_.emplace([task] { (*task)(); });
+        }
+        condition_.notify_one();
+        return res;
+    }
+
+    template<class F, class... Args>
+    auto ThreadPool::trySubmit(F &&f, Args &&... args) -> std::optional<std::future<std::invoke_result_t<F, Args...> > > {
+        using return_type = std::invoke_result_t<F, Args...>;
+
+        if (stop_) {
+            return std::nullopt;
+        }
+
+        auto task = std::make_shared<std::packaged_task<return_type()> >(std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+
+        std::future<return_type> res = task->get_future();
+        {
+            std::unique_lock lock(queue_mutex_);
+            if (stop_ || task_queue_.size() >= max_queue_size_) {
+                return std::nullopt;
+            }
+            // packaged_task stores any exception thrown by the task in the shared state of the future
+            task_queue_.emplace([task] { (*task)(); });
         }
         condition_.notify_one();
         return res;
@@ -0,0 +1,131 @@
+#include "LatencyHistogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace common::time {
+    /// @brief Shard of the calling thread, assigned round-robin on first use
+    /// @param shard_count Number of shards to choose from
+    /// @return Shard index shared by every histogram the thread records into
+    static auto threadShard(const size_t shard_count) noexcept -> size_t {
+        static std::atomic<size_t> next_shard{0};
+        thread_local const size_t shard = next_shard.fetch_add(1, std::memory_order_relaxed);
+        return shard % shard_count;
+    }
+
+    auto LatencyHistogram::Snapshot::count() const noexcept -> uint64_t {
+        return count_;
+    }
+
+    auto LatencyHistogram::Snapshot::valueAtPercentile(const double percentile) const noexcept -> std::chrono::microseconds {
+        if (count_ == 0) {
+            return std::chrono::microseconds{0};
+        }
+
+        // Rank of the requested value, at least the first one
+        const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(count_))));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            seen += buckets_[i];
+            if (seen >= rank) {
+                return std::chrono::microseconds{std::min(bucketUpperBound(i), max_us_)};
+            }
+        }
+        return std::chrono::microseconds{max_us_};
+    }
+
+    auto LatencyHistogram::Snapshot::max() const noexcept -> std::chrono::microseconds {
+        return std::chrono::microseconds{max_us_};
+    }
+
+    auto LatencyHistogram::Snapshot::mean() const noexcept -> std::chrono::microseconds {
+        return std::chrono::microseconds{count_ == 0 ? 0 : sum_us_ / count_};
+    }
+
+    auto LatencyHistogram::Snapshot::correctedForCoordinatedOmission(const std::chrono::microseconds expected_interval) const noexcept -> Snapshot {
+        Snapshot corrected = *this;
+        if (expected_interval.count() <= 0) {
+            return corrected;
+        }
+
+        const auto interval_us = static_cast<uint64_t>(expected_interval.count());
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            const auto value_us = std::min(bucketUpperBound(i), max_us_);
+            if (buckets_[i] == 0 || value_us < 2 * interval_us) {
+                continue;
+            }
+
+            // The omitted values are value_us - k * interval_us for k in [1, value_us / interval_us - 1];
+            // count the ones in each lower bucket at once instead of walking them one by one
+            const auto max_k = value_us / interval_us - 1;
+            for (size_t j = 0; j <= i; ++j) {
+                const auto lower_us = j == 0 ? 0 : bucketUpperBound(j - 1) + 1;
+                const auto upper_us = bucketUpperBound(j);
+                if (lower_us > value_us - interval_us) {
+                    break;
+                }
+                const auto first_k = std::max<uint64_t>(1, upper_us >= value_us ? 1 : (value_us - upper_us + interval_us - 1) / interval_us);
+                const auto last_k = std::min(max_k, (value_us - lower_us) / interval_us);
+                if (first_k > last_k) {
+                    continue;
+                }
+                const auto omitted = (last_k - first_k + 1) * buckets_[i];
+                corrected.buckets_[j] += omitted;
+                corrected.count_ += omitted;
+                corrected.sum_us_ += omitted * value_us - buckets_[i] * interval_us * (first_k + last_k) * (last_k - first_k + 1) / 2;
+            }
+        }
+        return corrected;
+    }
+
+    LatencyHistogram::LatencyHistogram() : shards_(std::make_unique<Shard[]>(SHARD_COUNT)) {
+    }
+
+    auto LatencyHistogram::record(const std::chrono::nanoseconds latency) noexcept -> void {
+        const auto value_us = std::min<uint64_t>(static_cast<uint64_t>(std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::microseconds>(latency).count())), MAX_VALUE_US);
+        auto &shard = shards_[threadShard(SHARD_COUNT)];
+        shard.buckets[bucketIndex(value_us)].fetch_add(1, std::memory_order_relaxed);
+        shard.sum_us.fetch_add(value_us, std::memory_order_relaxed);
+
+        auto max_us = shard.max_us.load(std::memory_order_relaxed);
+        while (value_us > max_us && !shard.max_us.compare_exchange_weak(max_us, value_us, std::memory_order_relaxed)) {
+        }
+    }
+
+    auto LatencyHistogram::snapshot() const -> Snapshot {
+        Snapshot snapshot;
+        for (size_t s = 0; s < SHARD_COUNT; ++s) {
+            const auto &shard = shards_[s];
+            for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+                snapshot.buckets_[i] += shard.buckets[i].load(std::memory_order_relaxed);
+            }
+            snapshot.sum_us_ += shard.sum_us.load(std::memory_order_relaxed);
+            snapshot.max_us_ = std::max(snapshot.max_us_, shard.max_us.load(std::memory_order_relaxed));
+        }
+
+        // Count from the merged buckets so percentiles never look past what was merged
+        for (const auto bucket: snapshot.buckets_) {
+            snapshot.count_ += bucket;
+        }
+        return snapshot;
+    }
+
+    auto LatencyHistogram::bucketIndex(const uint64_t value_us) noexcept -> size_t {
+        if (value_us < SUB_BUCKET_COUNT) {
+            return static_cast<size_t>(value_us);
+        }
+        // Values in [2^k, 2^(k+1)) keep their top SUB_BUCKET_BITS + 1 bits
+        const auto magnitude = static_cast<uint32_t>(std::bit_width(value_us)) - 1 - SUB_BUCKET_BITS;
+        return (magnitude + 1) * SUB_BUCKET_COUNT + static_cast<size_t>((value_us >> magnitude) - SUB_BUCKET_COUNT);
+    }
+
+    auto LatencyHistogram::bucketUpperBound(const size_t index) noexcept -> uint64_t {
+        if (index < SUB_BUCKET_COUNT) {
+            return index;
+        }
+        const auto magnitude = static_cast<uint32_t>(index / SUB_BUCKET_COUNT - 1);
+        const auto sub_bucket = static_cast<uint64_t>(index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT);
+        return ((sub_bucket + 1) << magnitude) - 1;
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace common::time {
+    /// @brief Lock-free latency histogram with log-linear buckets
+    /// @details Latencies are recorded in microseconds into buckets in the style of HdrHistogram: every
+    /// power of two is split into SUB_BUCKET_COUNT linear sub-buckets, so any recorded value is reported
+    /// within about 3% over the whole range from 1us to about 71 minutes, beyond which values are
+    /// clamped. Each thread records into one of SHARD_COUNT shards, chosen once per thread, with relaxed
+    /// atomic increments, so concurrent recorders rarely share a cache line and never wait. Readers merge
+    /// all shards into a Snapshot; a snapshot taken while calls are recorded may miss some of them.
+    class LatencyHistogram {
+    public:
+        /// @brief Number of bits of a value resolved linearly within its power of two
+        static constexpr uint32_t SUB_BUCKET_BITS = 5;
+
+        /// @brief Number of linear sub-buckets per power of two
+        static constexpr size_t SUB_BUCKET_COUNT = size_t{1} << SUB_BUCKET_BITS;
+
+        /// @brief Largest recordable value in microseconds, larger values are clamped
+        static constexpr uint64_t MAX_VALUE_US = 0xFFFFFFFF;
+
+        /// @brief Number of buckets needed to cover 0 to MAX_VALUE_US
+        static constexpr size_t BUCKET_COUNT = (32 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+        /// @brief Merged counts of all shards at one point in time
+        class Snapshot {
+        public:
+            /// @brief Get the number of recorded values
+            /// @return Count of recorded values
+            [[nodiscard]] auto count() const noexcept -> uint64_t;
+
+            /// @brief Get the value below which a percentage of the recorded values fall
+            /// @param percentile Percentage between 0 and 100
+            /// @return Upper bound of the bucket holding that value, 0 if nothing was recorded
+            [[nodiscard]] auto valueAtPercentile(double percentile) const noexcept -> std::chrono::microseconds;
+
+            /// @brief Get the largest recorded value
+            /// @return Largest value, 0 if nothing was recorded
+            [[nodiscard]] auto max() const noexcept -> std::chrono::microseconds;
+
+            /// @brief Get the mean of the recorded values
+            /// @return Mean value, 0 if nothing was recorded
+            [[nodiscard]] auto mean() const noexcept -> std::chrono::microseconds;
+
+            /// @brief Correct the counts for coordinated omission
+            /// @details A caller that waits for each response before sending the next request stops
+            /// sending while a slow response is outstanding, so the requests it would have sent in
+            /// the meantime are never measured. As in HdrHistogram, every value longer than the
+            /// expected interval between requests adds the values those requests would have seen:
+            /// value - interval, value - 2 * interval, and so on down to the interval.
+            /// @param expected_interval Time between requests when nothing stalls, 0 to skip the correction
+            /// @return Snapshot including the omitted values
+            [[nodiscard]] auto correctedForCoordinatedOmission(std::chrono::microseconds expected_interval) const noexcept -> Snapshot;
+
+        private:
+            friend class LatencyHistogram;
+
+            std::array<uint64_t, BUCKET_COUNT> buckets_{};
+            uint64_t count_{0};
+            uint64_t sum_us_{0};
+            uint64_t max_us_{0};
+        };
+
+        /// @brief Construct an empty histogram
+        LatencyHistogram();
+
+        /// @brief Copy constructor (deleted)
+        LatencyHistogram(const LatencyHistogram &) = delete;
+
+        /// @brief Copy assignment operator (deleted)
+        auto operator=(const LatencyHistogram &) -> LatencyHistogram & = delete;
+
+        /// @brief Record one latency
+        /// @param latency Latency to record, rounded down to microseconds
+        auto record(std::chrono::nanoseconds latency) noexcept -> void;
+
+        /// @brief Merge all shards into a snapshot
+        /// @return Counts recorded so far
+        [[nodiscard]] auto snapshot() const -> Snapshot;
+
+    private:
+        /// @brief Number of shards recording threads are spread over
+        static constexpr size_t SHARD_COUNT = 8;
+
+        /// @brief Counters written by a subset of the recording threads
+        struct alignas(64) Shard {
+            std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets{};
+            std::atomic<uint64_t> sum_us{0};
+            std::atomic<uint64_t> max_us{0};
+        };
+
+        /// @brief Map a value to its bucket
+        /// @param value_us Value in microseconds, at most MAX_VALUE_US
+        /// @return Bucket index
+        [[nodiscard]] static auto bucketIndex(uint64_t value_us) noexcept -> size_t;
+
+        /// @brief Get the largest value a bucket holds
+        /// @param index Bucket index
+        /// @return Largest value in microseconds that maps to the bucket
+        [[nodiscard]] static auto bucketUpperBound(size_t index) noexcept -> uint64_t;
+
+        std::unique_ptr<Shard[]> shards_;
+    };
+}
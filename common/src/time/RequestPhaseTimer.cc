@@ -0,0 +1,23 @@
+#include "RequestPhaseTimer.hpp"
+
+#include <utility>
+
+namespace common::time {
+    /// @brief Phase durations of the request running on this thread
+    static thread_local RequestPhaseDurations request_phases{};
+
+    ScopedPhaseTimer::ScopedPhaseTimer(const RequestPhase phase) noexcept : phase_(phase), started_(std::chrono::steady_clock::now()) {
+    }
+
+    ScopedPhaseTimer::~ScopedPhaseTimer() {
+        request_phases[static_cast<size_t>(phase_)] += std::chrono::steady_clock::now() - started_;
+    }
+
+    auto clearRequestPhases() noexcept -> void {
+        request_phases = {};
+    }
+
+    auto takeRequestPhases() noexcept -> RequestPhaseDurations {
+        return std::exchange(request_phases, {});
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace common::time {
+    /// @brief Parts of a request whose time is accounted separately
+    enum class RequestPhase : uint8_t {
+        Database,
+        KeyDerivation,
+    };
+
+    /// @brief Number of RequestPhase values, for tables indexed by the enum
+    inline constexpr size_t REQUEST_PHASE_COUNT = static_cast<size_t>(RequestPhase::KeyDerivation) + 1;
+
+    /// @brief Time spent in every phase, indexed by RequestPhase
+    using RequestPhaseDurations = std::array<std::chrono::nanoseconds, REQUEST_PHASE_COUNT>;
+
+    /// @brief Adds the time between its construction and destruction to a phase of the calling thread
+    /// @details Requests are handled on a single thread from start to finish, so the layers that touch
+    /// the database or derive keys only wrap those calls, and the RPC layer collects the totals with
+    /// takeRequestPhases() without any parameter being threaded through in between.
+    class ScopedPhaseTimer {
+    public:
+        /// @brief Start timing a phase
+        /// @param phase Phase the elapsed time is added to
+        explicit ScopedPhaseTimer(RequestPhase phase) noexcept;
+
+        /// @brief Add the elapsed time to the phase
+        ~ScopedPhaseTimer();
+
+        /// @brief Copy constructor (deleted)
+        ScopedPhaseTimer(const ScopedPhaseTimer &) = delete;
+
+        /// @brief Copy assignment operator (deleted)
+        auto operator=(const ScopedPhaseTimer &) -> ScopedPhaseTimer & = delete;
+
+    private:
+        RequestPhase phase_;
+        std::chrono::steady_clock::time_point started_;
+    };
+
+    /// @brief Forget the phase durations accumulated on the calling thread
+    /// @details Called before a request starts, so time from earlier work on the thread is not attributed to it.
+    auto clearRequestPhases() noexcept -> void;
+
+    /// @brief Get and clear the phase durations accumulated on the calling thread
+    /// @return Time spent in every phase since the last clear or take
+    [[nodiscard]] auto takeRequestPhases() noexcept -> RequestPhaseDurations;
+}
@@ -6,6 +6,7 @@
 #include <fmt/format.h>
 
 #include "formatter/CustomGlogPrefixFormatter.hpp"
+#include "sink/AsyncLogSink.hpp"
 
 namespace glog::config {
     // Static variable to hold the custom log sink for cleanup
@@ -40,9 +41,23 @@ namespace glog::config {
 
         // Apply custom log format if enabled
         if (config.customLogFormat()) {
-            google::InstallPrefixFormatter(&formatter::CustomGlogPrefixFormatter::MyPrefixFormatter);
+            google::InstallPrefixFormatter(&formatter::CustomGlogPrefixFormatter::CachedPrefixFormatter);
             LOG(INFO) << "Custom log format enabled...";
         }
+
+        // Hand every line to the background writer; glog itself writes neither to stderr nor to files
+        // and skips rendering the prefix, which the writer thread renders instead
+        if (config.asyncSink()) {
+            static_custom_log_sink_ = std::make_unique<sink::AsyncLogSink>(config.asyncQueueCapacity(), sink::AsyncLogSink::parseOverflowPolicy(config.asyncOverflowPolicy()), config.customLogFormat());
+            FLAGS_log_prefix = false;
+            FLAGS_logtostderr = false;
+            FLAGS_stderrthreshold = google::NUM_SEVERITIES;
+            for (int severity = 0; severity < google::NUM_SEVERITIES; ++severity) {
+                google::SetLogDestination(static_cast<google::LogSeverity>(severity), "");
+            }
+            google::AddLogSink(static_custom_log_sink_.get());
+            LOG(INFO) << "Asynchronous log sink enabled (queue capacity: " << config.asyncQueueCapacity() << ", overflow policy: " << config.asyncOverflowPolicy() << ")...";
+        }
     }
 
     auto GLogConfigurator::clean() noexcept -> void {
@@ -45,6 +45,7 @@ namespace glog::config {
 
     private:
         /// @brief Perform the actual glog configuration
+        /// @details Installs the asynchronous sink when enabled; the sink is removed and drained by clean()
         static auto doConfig(const parameter::GLogParameters &config) noexcept -> void;
 
         /// @brief Clean up glog resources
@@ -1,8 +1,45 @@
 #include "CustomGlogPrefixFormatter.hpp"
 
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
+#include <sstream>
+#include <string_view>
+#include <utility>
 
 namespace glog::formatter {
+    /// @brief Thread id type reported by the installed glog version
+    using ThreadId = decltype(std::declval<const google::LogMessage &>().thread_id());
+
+    /// @brief Timestamp and thread id last rendered on this thread
+    struct CachedPrefix {
+        bool valid{false}; ///< Whether the fields below have been rendered
+        int64_t second{-1}; ///< Packed year, month, day, hour, minute and second of the timestamp
+        std::array<char, 17> timestamp{}; ///< Rendered "YYYYMMDD HH:MM:SS"
+        ThreadId thread_id{}; ///< Thread id the padded text below belongs to
+        std::string thread_text; ///< Thread id right-aligned to five columns
+    };
+
+    static thread_local CachedPrefix cached_prefix_;
+
+    /// @brief Write a non-negative value as exactly width zero-padded digits
+    static auto writeDigits(char *out, int value, const int width) noexcept -> void {
+        for (int i = width - 1; i >= 0; --i) {
+            out[i] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+    }
+
+    /// @brief Copy text into the buffer as far as it fits
+    static auto append(char *&out, const char *end, const std::string_view text) noexcept -> void {
+        const auto length = std::min(text.size(), static_cast<size_t>(end - out));
+        std::memcpy(out, text.data(), length);
+        out += length;
+    }
+
     /// @brief Formats log message prefix according to custom specification
     /// @param s Output stream to write formatted prefix to
     /// @param m Log message containing metadata for the prefix
@@ -11,4 +48,51 @@ namespace glog::formatter {
         // Use the original stream-based approach to avoid fmt compatibility issues
         s << '[' << google::GetLogSeverityName(m.severity()) << "] [" << std::setw(4) << (kYearOffset_ + m.time().year()) << std::setw(2) << (kMonthOffset_ + m.time().month()) << std::setw(2) << m.time().day() << ' ' << std::setw(2) << m.time().hour() << ':' << std::setw(2) << m.time().min() << ':' << std::setw(2) << m.time().sec() << "." << std::setw(6) << m.time().usec() << "] [" << std::setfill(' ') << std::setw(5) << m.thread_id() << std::setfill('0') << "] [" << m.basename() << ':' << m.line() << "] ";
     }
+
+    auto CustomGlogPrefixFormatter::CachedPrefixFormatter(std::ostream &s, const google::LogMessage &m, void * /*data*/) noexcept -> void {
+        auto &cache = cached_prefix_;
+        const auto &time = m.time();
+        const int64_t second = ((((static_cast<int64_t>(time.year()) * 13 + time.month()) * 32 + time.day()) * 24 + time.hour()) * 60 + time.min()) * 61 + time.sec();
+        if (!cache.valid || cache.second != second) {
+            auto *out = cache.timestamp.data();
+            writeDigits(out, kYearOffset_ + time.year(), 4);
+            writeDigits(out + 4, kMonthOffset_ + time.month(), 2);
+            writeDigits(out + 6, time.day(), 2);
+            out[8] = ' ';
+            writeDigits(out + 9, time.hour(), 2);
+            out[11] = ':';
+            writeDigits(out + 12, time.min(), 2);
+            out[14] = ':';
+            writeDigits(out + 15, time.sec(), 2);
+            cache.second = second;
+        }
+        if (const auto thread_id = m.thread_id(); !cache.valid || cache.thread_id != thread_id) {
+            std::ostringstream thread_text;
+            thread_text << std::setw(5) << thread_id;
+            cache.thread_text = thread_text.str();
+            cache.thread_id = thread_id;
+        }
+        cache.valid = true;
+
+        std::array<char, kPrefixCapacity_> buffer;
+        auto *out = buffer.data();
+        const auto *end = buffer.data() + buffer.size();
+        append(out, end, "[");
+        append(out, end, google::GetLogSeverityName(m.severity()));
+        append(out, end, "] [");
+        append(out, end, std::string_view{cache.timestamp.data(), cache.timestamp.size()});
+        if (end - out >= 7) {
+            *out++ = '.';
+            writeDigits(out, static_cast<int>(time.usec()), 6);
+            out += 6;
+        }
+        append(out, end, "] [");
+        append(out, end, cache.thread_text);
+        append(out, end, "] [");
+        append(out, end, m.basename());
+        append(out, end, ":");
+        out = std::to_chars(out, buffer.data() + buffer.size(), m.line()).ptr;
+        append(out, end, "] ");
+        s.write(buffer.data(), out - buffer.data());
+    }
 }
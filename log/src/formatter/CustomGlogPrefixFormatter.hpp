@@ -31,11 +31,23 @@ namespace glog::formatter {
         /// @param data User data pointer (unused)
         static auto MyPrefixFormatter(std::ostream &s, const google::LogMessage &m, void *data) noexcept -> void;
 
+        /// @brief Formats the same prefix as MyPrefixFormatter from a per-thread cache
+        /// @details The "YYYYMMDD HH:MM:SS" part and the padded thread id are rendered once per second and
+        /// thread; every line only renders the microseconds, severity, file and line into a stack buffer,
+        /// which is handed to the stream with a single write.
+        /// @param s Output stream to write formatted prefix to
+        /// @param m Log message containing metadata for the prefix
+        /// @param data User data pointer (unused)
+        static auto CachedPrefixFormatter(std::ostream &s, const google::LogMessage &m, void *data) noexcept -> void;
+
     private:
         /// @brief Date format helper constant for year offset
         static constexpr int kYearOffset_ = 1900;
 
         /// @brief Date format helper constant for month offset
         static constexpr int kMonthOffset_ = 1;
+
+        /// @brief Capacity of the stack buffer a cached prefix is rendered into
+        static constexpr size_t kPrefixCapacity_ = 256;
     };
 }
@@ -4,6 +4,15 @@
 #include <fmt/format.h>
 
 namespace glog::parameter {
+    /// @brief Reject an asynchronous sink combined with file logging
+    /// @param parameters Parameters to check
+    /// @throws std::invalid_argument If asyncSink is enabled while logToStderr is disabled
+    static auto validateAsyncSink(const GLogParameters &parameters) -> void {
+        if (parameters.asyncSink() && !parameters.logToStderr()) {
+            throw std::invalid_argument("asyncSink writes to stderr only and requires logToStderr to be true");
+        }
+    }
+
     GLogParameters::GLogParameters(const int32_t min_log_level, std::string log_name, const bool log_to_stderr) : min_log_level_(min_log_level), log_name_(std::move(log_name)), log_to_stderr_(log_to_stderr) {
     }
 
@@ -39,6 +48,33 @@ namespace glog::parameter {
         custom_log_format_ = custom_log_format;
     }
 
+    auto GLogParameters::asyncSink() const noexcept -> bool {
+        return async_sink_;
+    }
+
+    auto GLogParameters::asyncSink(const bool async_sink) noexcept -> void {
+        async_sink_ = async_sink;
+    }
+
+    auto GLogParameters::asyncQueueCapacity() const noexcept -> uint32_t {
+        return async_queue_capacity_;
+    }
+
+    auto GLogParameters::asyncQueueCapacity(const uint32_t async_queue_capacity) noexcept -> void {
+        async_queue_capacity_ = async_queue_capacity;
+    }
+
+    auto GLogParameters::asyncOverflowPolicy() const noexcept -> std::string {
+        return async_overflow_policy_;
+    }
+
+    auto GLogParameters::asyncOverflowPolicy(const std::string &async_overflow_policy) -> void {
+        if (async_overflow_policy != "drop" && async_overflow_policy != "block") {
+            throw std::invalid_argument(fmt::format("Invalid asyncOverflowPolicy '{}', valid values are 'drop' or 'block'", async_overflow_policy));
+        }
+        async_overflow_policy_ = async_overflow_policy;
+    }
+
     auto GLogParameters::deserializedFromYamlFile(const std::filesystem::path &path) -> void {
         if (!std::filesystem::exists(path)) {
             throw std::runtime_error(fmt::format("Configuration file does not exist: {}", path.string()));
@@ -59,6 +95,15 @@ namespace glog::parameter {
                 if (glog_node["customLogFormat"]) {
                     custom_log_format_ = glog_node["customLogFormat"].as<bool>();
                 }
+                if (glog_node["asyncSink"]) {
+                    async_sink_ = glog_node["asyncSink"].as<bool>();
+                }
+                if (glog_node["asyncQueueCapacity"]) {
+                    async_queue_capacity_ = glog_node["asyncQueueCapacity"].as<uint32_t>();
+                }
+                if (glog_node["asyncOverflowPolicy"]) {
+                    asyncOverflowPolicy(glog_node["asyncOverflowPolicy"].as<std::string>());
+                }
             } else {
                 // If there's no "glog" section, try to parse the fields directly from root
                 if (node["minLogLevel"]) {
@@ -73,7 +118,17 @@ namespace glog::parameter {
                 if (node["customLogFormat"]) {
                     custom_log_format_ = node["customLogFormat"].as<bool>();
                 }
+                if (node["asyncSink"]) {
+                    async_sink_ = node["asyncSink"].as<bool>();
+                }
+                if (node["asyncQueueCapacity"]) {
+                    async_queue_capacity_ = node["asyncQueueCapacity"].as<uint32_t>();
+                }
+                if (node["asyncOverflowPolicy"]) {
+                    asyncOverflowPolicy(node["asyncOverflowPolicy"].as<std::string>());
+                }
             }
+            validateAsyncSink(*this);
         } catch (const YAML::Exception &e) {
             throw std::runtime_error(fmt::format("Failed to parse YAML file '{}': {}", path.string(), e.what()));
         } catch (const std::exception &e) {
@@ -82,7 +137,7 @@ namespace glog::parameter {
     }
 
     auto GLogParameters::operator==(const GLogParameters &other) const noexcept -> bool {
-        return min_log_level_ == other.min_log_level_ && log_name_ == other.log_name_ && log_to_stderr_ == other.log_to_stderr_ && custom_log_format_ == other.custom_log_format_;
+        return min_log_level_ == other.min_log_level_ && log_name_ == other.log_name_ && log_to_stderr_ == other.log_to_stderr_ && custom_log_format_ == other.custom_log_format_ && async_sink_ == other.async_sink_ && async_queue_capacity_ == other.async_queue_capacity_ && async_overflow_policy_ == other.async_overflow_policy_;
     }
 
     auto GLogParameters::operator!=(const GLogParameters &other) const noexcept -> bool {
@@ -107,6 +162,16 @@ auto YAML::convert<glog::parameter::GLogParameters>::decode(const YAML::Node &no
     if (node["customLogFormat"]) {
         rhs.customLogFormat(node["customLogFormat"].as<bool>());
     }
+    if (node["asyncSink"]) {
+        rhs.asyncSink(node["asyncSink"].as<bool>());
+    }
+    if (node["asyncQueueCapacity"]) {
+        rhs.asyncQueueCapacity(node["asyncQueueCapacity"].as<uint32_t>());
+    }
+    if (node["asyncOverflowPolicy"]) {
+        rhs.asyncOverflowPolicy(node["asyncOverflowPolicy"].as<std::string>());
+    }
+    glog::parameter::validateAsyncSink(rhs);
     return true;
 }
 
@@ -116,5 +181,8 @@ auto YAML::convert<glog::parameter::GLogParameters>::encode(const glog::paramete
     node["logName"] = rhs.logName();
     node["logToStderr"] = rhs.logToStderr();
     node["customLogFormat"] = rhs.customLogFormat();
+    node["asyncSink"] = rhs.asyncSink();
+    node["asyncQueueCapacity"] = rhs.asyncQueueCapacity();
+    node["asyncOverflowPolicy"] = rhs.asyncOverflowPolicy();
     return node;
 }
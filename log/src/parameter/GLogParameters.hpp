@@ -52,9 +52,36 @@ namespace glog::parameter {
         /// @param custom_log_format True to enable custom log format, false to disable.
         auto customLogFormat(bool custom_log_format) noexcept -> void;
 
+        /// @brief Check if log lines are handed to the asynchronous sink instead of being written by the logging thread.
+        /// @details The sink writes to stderr only, so it requires logToStderr; enabling it together with
+        /// file logging is rejected when the configuration is loaded.
+        /// @return True if the asynchronous sink is enabled, false otherwise.
+        [[nodiscard]] auto asyncSink() const noexcept -> bool;
+
+        /// @brief Enable or disable the asynchronous sink.
+        /// @param async_sink True to enable the asynchronous sink, false to disable.
+        auto asyncSink(bool async_sink) noexcept -> void;
+
+        /// @brief Get the number of messages the asynchronous sink can queue.
+        /// @return The queue capacity, rounded up to a power of two by the sink.
+        [[nodiscard]] auto asyncQueueCapacity() const noexcept -> uint32_t;
+
+        /// @brief Set the number of messages the asynchronous sink can queue.
+        /// @param async_queue_capacity The queue capacity to set.
+        auto asyncQueueCapacity(uint32_t async_queue_capacity) noexcept -> void;
+
+        /// @brief Get what the asynchronous sink does when its queue is full.
+        /// @return "drop" to discard the message or "block" to wait for space.
+        [[nodiscard]] auto asyncOverflowPolicy() const noexcept -> std::string;
+
+        /// @brief Set what the asynchronous sink does when its queue is full.
+        /// @param async_overflow_policy "drop" or "block".
+        /// @throws std::invalid_argument If the policy is neither "drop" nor "block".
+        auto asyncOverflowPolicy(const std::string &async_overflow_policy) -> void;
+
         /// @brief Deserialize object configuration from a YAML file
         /// @param path The file path to the YAML configuration file
-        /// @throws std::runtime_error If the file cannot be read or parsed
+        /// @throws std::runtime_error If the file cannot be read or parsed, or asyncSink is enabled without logToStderr
         auto deserializedFromYamlFile(const std::filesystem::path &path) -> void override;
 
         /// @brief Equality operator.
@@ -72,6 +99,9 @@ namespace glog::parameter {
         std::string log_name_{};
         bool log_to_stderr_{};
         bool custom_log_format_{false};
+        bool async_sink_{false};
+        uint32_t async_queue_capacity_{8192};
+        std::string async_overflow_policy_{"block"};
     };
 }
 
@@ -0,0 +1,221 @@
+#include "AsyncLogSink.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <climits>
+#include <chrono>
+#include <cstring>
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+namespace glog::sink {
+    /// @brief Number of times a blocked producer yields before it starts sleeping
+    static constexpr int BLOCK_YIELDS = 64;
+
+    /// @brief Sleep of a blocked producer once yielding did not free a slot
+    static constexpr auto BLOCK_SLEEP = std::chrono::microseconds(50);
+
+    /// @brief Trailing newline appended to every message
+    static constexpr char NEWLINE[] = "\n";
+
+    AsyncLogSink::AsyncLogSink(const size_t capacity, const OverflowPolicy overflow_policy, const bool custom_format, const int fd) : mask_(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1), overflow_policy_(overflow_policy), custom_format_(custom_format), fd_(fd), records_(std::make_unique<Record[]>(mask_ + 1)), prefixes_(MAX_BATCH), iov_(MAX_BATCH * 3) {
+        for (size_t i = 0; i <= mask_; ++i) {
+            records_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        writer_ = std::thread(&AsyncLogSink::run, this);
+    }
+
+    AsyncLogSink::~AsyncLogSink() noexcept {
+        stopping_.store(true, std::memory_order_release);
+        wake_epoch_.fetch_add(1, std::memory_order_release);
+        wake_epoch_.notify_one();
+        if (writer_.joinable()) {
+            writer_.join();
+        }
+    }
+
+    auto AsyncLogSink::send(const google::LogSeverity severity, const char * /*full_filename*/, const char *base_filename, const int line, const google::LogMessageTime &time, const char *message, const size_t message_len) -> void {
+        // Errors and FATAL messages are never dropped, they usually explain what happens next
+        auto *record = claim(overflow_policy_ == OverflowPolicy::Drop && severity < google::GLOG_ERROR);
+        if (record == nullptr) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            dropped_total_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        record->severity = severity;
+        record->line = line;
+        record->base_filename = base_filename;
+        record->thread_id = std::this_thread::get_id();
+        record->time = time;
+        record->length = message_len;
+        if (message_len <= INLINE_MESSAGE_BYTES) {
+            std::memcpy(record->text.data(), message, message_len);
+        } else {
+            record->spill.assign(message, message_len);
+        }
+
+        const auto position = record->sequence.load(std::memory_order_relaxed);
+        record->sequence.store(position + 1, std::memory_order_release);
+        wakeWriter();
+
+        if (severity >= google::GLOG_FATAL) {
+            flush();
+        }
+    }
+
+    auto AsyncLogSink::WaitTillSent() -> void {
+    }
+
+    auto AsyncLogSink::flush() noexcept -> void {
+        const auto target = enqueue_position_.load(std::memory_order_acquire);
+        while (written_position_.load(std::memory_order_acquire) < target) {
+            wakeWriter();
+            std::this_thread::sleep_for(BLOCK_SLEEP);
+        }
+    }
+
+    auto AsyncLogSink::droppedCount() const noexcept -> uint64_t {
+        return dropped_total_.load(std::memory_order_relaxed);
+    }
+
+    auto AsyncLogSink::parseOverflowPolicy(const std::string_view name) noexcept -> OverflowPolicy {
+        return name == "drop" ? OverflowPolicy::Drop : OverflowPolicy::Block;
+    }
+
+    auto AsyncLogSink::claim(const bool may_drop) noexcept -> Record * {
+        int attempts = 0;
+        auto position = enqueue_position_.load(std::memory_order_relaxed);
+        while (true) {
+            auto &record = records_[position & mask_];
+            const auto sequence = record.sequence.load(std::memory_order_acquire);
+            if (sequence == position) {
+                if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    return &record;
+                }
+            } else if (sequence < position) {
+                // The slot still holds a message from the previous lap, so the ring is full
+                if (may_drop) {
+                    return nullptr;
+                }
+                wakeWriter();
+                if (++attempts < BLOCK_YIELDS) {
+                    std::this_thread::yield();
+                } else {
+                    std::this_thread::sleep_for(BLOCK_SLEEP);
+                }
+                position = enqueue_position_.load(std::memory_order_relaxed);
+            } else {
+                position = enqueue_position_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    auto AsyncLogSink::wakeWriter() noexcept -> void {
+        // Pairs with the fence in run(): either the writer sees the published slot or this sees it idle
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (writer_idle_.load(std::memory_order_relaxed)) {
+            wake_epoch_.fetch_add(1, std::memory_order_release);
+            wake_epoch_.notify_one();
+        }
+    }
+
+    auto AsyncLogSink::run() noexcept -> void {
+        while (true) {
+            size_t count = 0;
+            while (count < MAX_BATCH && records_[(read_position_ + count) & mask_].sequence.load(std::memory_order_acquire) == read_position_ + count + 1) {
+                ++count;
+            }
+
+            if (count > 0) {
+                writeBatch(count);
+                for (size_t i = 0; i < count; ++i) {
+                    auto &record = records_[(read_position_ + i) & mask_];
+                    record.spill.clear();
+                    record.sequence.store(read_position_ + i + mask_ + 1, std::memory_order_release);
+                }
+                read_position_ += count;
+                written_position_.store(read_position_, std::memory_order_release);
+                if (const auto dropped = dropped_.exchange(0, std::memory_order_relaxed); dropped > 0) {
+                    reportDropped(dropped);
+                }
+                continue;
+            }
+
+            if (stopping_.load(std::memory_order_acquire)) {
+                break;
+            }
+
+            const auto epoch = wake_epoch_.load(std::memory_order_acquire);
+            writer_idle_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (records_[read_position_ & mask_].sequence.load(std::memory_order_acquire) != read_position_ + 1 && !stopping_.load(std::memory_order_acquire)) {
+                wake_epoch_.wait(epoch, std::memory_order_acquire);
+            }
+            writer_idle_.store(false, std::memory_order_relaxed);
+        }
+
+        if (const auto dropped = dropped_.exchange(0, std::memory_order_relaxed); dropped > 0) {
+            reportDropped(dropped);
+        }
+    }
+
+    auto AsyncLogSink::writeBatch(const size_t count) noexcept -> void {
+        size_t iov_count = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const auto &record = records_[(read_position_ + i) & mask_];
+            const auto prefix_length = renderPrefix(record, prefixes_[i]);
+            iov_[iov_count++] = {prefixes_[i].data(), prefix_length};
+            const char *text = record.length <= INLINE_MESSAGE_BYTES ? record.text.data() : record.spill.data();
+            iov_[iov_count++] = {const_cast<char *>(text), record.length};
+            iov_[iov_count++] = {const_cast<char *>(NEWLINE), 1};
+        }
+        writeFully(iov_.data(), iov_count);
+    }
+
+    auto AsyncLogSink::renderPrefix(const Record &record, std::array<char, PREFIX_CAPACITY> &buffer) const noexcept -> size_t {
+        const auto &time = record.time;
+        try {
+            if (custom_format_) {
+                // Same layout as CustomGlogPrefixFormatter::MyPrefixFormatter
+                return std::min(fmt::format_to_n(buffer.data(), buffer.size(), "[{}] [{:04}{:02}{:02} {:02}:{:02}:{:02}.{:06}] [{:>5}] [{}:{}] ", google::GetLogSeverityName(record.severity), 1900 + time.year(), 1 + time.month(), time.day(), time.hour(), time.min(), time.sec(), time.usec(), record.thread_id, record.base_filename, record.line).size, buffer.size());
+            }
+            // Same layout as glog's default prefix
+            return std::min(fmt::format_to_n(buffer.data(), buffer.size(), "{}{:04}{:02}{:02} {:02}:{:02}:{:02}.{:06} {:>5} {}:{}] ", google::GetLogSeverityName(record.severity)[0], 1900 + time.year(), 1 + time.month(), time.day(), time.hour(), time.min(), time.sec(), time.usec(), record.thread_id, record.base_filename, record.line).size, buffer.size());
+        } catch (...) {
+            return 0;
+        }
+    }
+
+    auto AsyncLogSink::writeFully(iovec *iov, size_t count) const noexcept -> void {
+        while (count > 0) {
+            const auto written = ::writev(fd_, iov, static_cast<int>(std::min<size_t>(count, IOV_MAX)));
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                // Nothing sensible is left to do with the lines; logging the failure would recurse
+                return;
+            }
+
+            auto remaining = static_cast<size_t>(written);
+            while (count > 0 && remaining >= iov->iov_len) {
+                remaining -= iov->iov_len;
+                ++iov;
+                --count;
+            }
+            if (count > 0) {
+                iov->iov_base = static_cast<char *>(iov->iov_base) + remaining;
+                iov->iov_len -= remaining;
+            }
+        }
+    }
+
+    auto AsyncLogSink::reportDropped(const uint64_t dropped) const noexcept -> void {
+        std::array<char, PREFIX_CAPACITY> buffer{};
+        const auto length = std::min(fmt::format_to_n(buffer.data(), buffer.size(), "AsyncLogSink: {} log messages dropped, the queue was full\n", dropped).size, buffer.size());
+        iovec iov{buffer.data(), length};
+        writeFully(&iov, 1);
+    }
+}
@@ -0,0 +1,148 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <glog/logging.h>
+
+namespace glog::sink {
+    /// @brief glog sink that hands log lines to a background writer instead of writing them on the logging thread
+    /// @details send() copies the message into a slot of a bounded lock-free multi-producer single-consumer
+    /// ring and returns. A dedicated writer thread drains the ring, renders the prefixes and writes whole
+    /// batches with a single writev call, so the logging thread neither formats a prefix nor blocks in a
+    /// system call, and send() takes no lock of its own. When the ring is full the message is either
+    /// dropped (and counted) or the logging thread waits for a free slot, depending on the overflow
+    /// policy; ERROR and FATAL messages always wait. glog calls send() while holding its global log
+    /// mutex, so a producer waiting for a slot stalls every other logging thread until the writer catches
+    /// up. FATAL messages are flushed before send() returns, so they are on the descriptor before glog
+    /// aborts the process.
+    class AsyncLogSink final : public google::LogSink {
+    public:
+        /// @brief Behaviour of send() when every slot of the ring is occupied
+        enum class OverflowPolicy {
+            Drop, ///< Discard the message and count it, unless it is an ERROR or FATAL message
+            Block ///< Wait until the writer frees a slot
+        };
+
+        /// @brief Construct the sink and start its writer thread
+        /// @param capacity Number of ring slots, rounded up to a power of two
+        /// @param overflow_policy Behaviour when the ring is full
+        /// @param custom_format Render the CustomGlogPrefixFormatter layout instead of the glog default prefix
+        /// @param fd Descriptor the log lines are written to
+        AsyncLogSink(size_t capacity, OverflowPolicy overflow_policy, bool custom_format, int fd = STDERR_FILENO);
+
+        /// @brief Destructor writing every queued message and stopping the writer thread
+        /// @details The sink must have been removed from glog before it is destroyed.
+        ~AsyncLogSink() noexcept override;
+
+        /// @brief Copy constructor (deleted)
+        AsyncLogSink(const AsyncLogSink &) = delete;
+
+        /// @brief Copy assignment operator (deleted)
+        auto operator=(const AsyncLogSink &) -> AsyncLogSink & = delete;
+
+        /// @brief Move constructor (deleted)
+        AsyncLogSink(AsyncLogSink &&) = delete;
+
+        /// @brief Move assignment operator (deleted)
+        auto operator=(AsyncLogSink &&) -> AsyncLogSink & = delete;
+
+        /// @brief Queue one log message for the writer thread
+        /// @param severity Severity of the message
+        /// @param full_filename Full path of the source file (unused)
+        /// @param base_filename Base name of the source file, a string literal that outlives the sink
+        /// @param line Source line of the message
+        /// @param time Time the message was logged
+        /// @param message Message text without prefix and trailing newline
+        /// @param message_len Length of the message text
+        auto send(google::LogSeverity severity, const char *full_filename, const char *base_filename, int line, const google::LogMessageTime &time, const char *message, size_t message_len) -> void override;
+
+        /// @brief Called by glog after every message; returns immediately since only FATAL messages are flushed synchronously
+        auto WaitTillSent() -> void override;
+
+        /// @brief Block until every message queued so far has been written
+        auto flush() noexcept -> void;
+
+        /// @brief Get the number of messages discarded because the ring was full
+        /// @return Total number of dropped messages
+        [[nodiscard]] auto droppedCount() const noexcept -> uint64_t;
+
+        /// @brief Parse an overflow policy name
+        /// @param name "drop" or "block"
+        /// @return The matching policy, Block for any other name
+        [[nodiscard]] static auto parseOverflowPolicy(std::string_view name) noexcept -> OverflowPolicy;
+
+    private:
+        /// @brief Message bytes stored inside a slot; longer messages spill into a heap string
+        static constexpr size_t INLINE_MESSAGE_BYTES = 384;
+
+        /// @brief Maximum number of messages written by one writev call
+        static constexpr size_t MAX_BATCH = 256;
+
+        /// @brief Capacity of a rendered prefix
+        static constexpr size_t PREFIX_CAPACITY = 192;
+
+        /// @brief One ring slot, cache line aligned so neighbouring producers do not share a line
+        struct alignas(64) Record {
+            std::atomic<uint64_t> sequence{0}; ///< Ring position the slot is ready for; position + 1 once published
+            google::LogSeverity severity{}; ///< Severity of the message
+            int line{0}; ///< Source line of the message
+            const char *base_filename{nullptr}; ///< Base name of the source file
+            std::thread::id thread_id; ///< Thread that logged the message
+            google::LogMessageTime time; ///< Time the message was logged
+            size_t length{0}; ///< Length of the message text
+            std::array<char, INLINE_MESSAGE_BYTES> text{}; ///< Message text when it fits inline
+            std::string spill; ///< Message text when it does not fit inline
+        };
+
+        /// @brief Claim a free slot for the message
+        /// @param may_drop Give up when the ring is full instead of waiting for a free slot
+        /// @return Claimed slot, or nullptr if the ring is full and the message may be dropped
+        [[nodiscard]] auto claim(bool may_drop) noexcept -> Record *;
+
+        /// @brief Wake the writer thread if it is waiting for messages
+        auto wakeWriter() noexcept -> void;
+
+        /// @brief Writer thread body
+        auto run() noexcept -> void;
+
+        /// @brief Render the prefixes of the published slots starting at the read position and write them in one batch
+        auto writeBatch(size_t count) noexcept -> void;
+
+        /// @brief Render the prefix of one slot
+        /// @return Number of prefix bytes written to the buffer
+        [[nodiscard]] auto renderPrefix(const Record &record, std::array<char, PREFIX_CAPACITY> &buffer) const noexcept -> size_t;
+
+        /// @brief Write every byte described by the vector, retrying partial writes and interrupts
+        auto writeFully(iovec *iov, size_t count) const noexcept -> void;
+
+        /// @brief Write a notice about dropped messages
+        auto reportDropped(uint64_t dropped) const noexcept -> void;
+
+        const size_t mask_;
+        const OverflowPolicy overflow_policy_;
+        const bool custom_format_;
+        const int fd_;
+        std::unique_ptr<Record[]> records_;
+
+        alignas(64) std::atomic<uint64_t> enqueue_position_{0}; ///< Next ring position handed to a producer
+        alignas(64) std::atomic<uint64_t> written_position_{0}; ///< Ring positions before this one have been written
+        std::atomic<uint32_t> wake_epoch_{0}; ///< Bumped to wake the writer
+        std::atomic<bool> writer_idle_{false}; ///< Set while the writer waits for messages
+        std::atomic<bool> stopping_{false}; ///< Set by the destructor to stop the writer
+        std::atomic<uint64_t> dropped_{0}; ///< Messages dropped since the last notice
+        std::atomic<uint64_t> dropped_total_{0}; ///< Messages dropped since construction
+
+        // Writer thread state
+        uint64_t read_position_{0};
+        std::vector<std::array<char, PREFIX_CAPACITY> > prefixes_;
+        std::vector<iovec> iov_;
+        std::thread writer_;
+    };
+}
@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+"""
+Script to move the users of a credential store to a different number of SQLite shard files.
+
+The server must be stopped while the script runs. Shard files are named and selected exactly
+like PasswordSQL does: a single shard is the configured path itself, otherwise the shard index
+is inserted before the extension ("users.db" becomes "users.0.db", "users.1.db", ...), and a user
+belongs to the shard given by the 64-bit FNV-1a hash of its username modulo the shard count.
+"""
+
+import os
+import sqlite3
+import argparse
+import sys
+from typing import Dict, List
+
+FNV_OFFSET_BASIS = 14695981039346656037
+FNV_PRIME = 1099511628211
+UINT64_MASK = (1 << 64) - 1
+
+# Must match CREATE_USERS_TABLE_SQL and CREATE_SHARD_LAYOUT_TABLE_SQL in server/src/sql/PasswordSQL.hpp
+CREATE_USERS_TABLE_SQL = """
+    CREATE TABLE IF NOT EXISTS users (
+        id INTEGER PRIMARY KEY AUTOINCREMENT,
+        username TEXT UNIQUE NOT NULL,
+        salt BLOB NOT NULL,
+        hash BLOB NOT NULL,
+        kdf_id INTEGER NOT NULL,
+        iterations INTEGER NOT NULL,
+        created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
+    );
+"""
+
+CREATE_SHARD_LAYOUT_TABLE_SQL = """
+    CREATE TABLE IF NOT EXISTS shard_layout (
+        id INTEGER PRIMARY KEY CHECK (id = 0),
+        shard_index INTEGER NOT NULL,
+        shard_count INTEGER NOT NULL
+    );
+"""
+
+SQLITE_SIDE_FILES = ('-wal', '-shm', '-journal')
+
+
+def shard_index(username: str, shard_count: int) -> int:
+    """
+    Select the shard a username is stored in.
+
+    @param username: Username
+    @param shard_count: Number of shards
+    @return: Index of the shard
+    """
+    value = FNV_OFFSET_BASIS
+    for byte in username.encode('utf-8'):
+        value ^= byte
+        value = (value * FNV_PRIME) & UINT64_MASK
+    return value % shard_count
+
+
+def shard_path(db_path: str, shard: int, shard_count: int) -> str:
+    """
+    Derive the path of a shard file.
+
+    @param db_path: Configured database path
+    @param shard: Index of the shard
+    @param shard_count: Number of shards
+    @return: Path of the shard file
+    """
+    if shard_count <= 1:
+        return db_path
+    stem, extension = os.path.splitext(db_path)
+    return f"{stem}.{shard}{extension}"
+
+
+def read_users(path: str) -> List[tuple]:
+    """
+    Read every user of a shard file.
+
+    @param path: Path of the shard file
+    @return: Rows of username, salt, hash, kdf_id, iterations and created_at
+    """
+    connection = sqlite3.connect(f"file:{path}?mode=ro", uri=True)
+    try:
+        columns = {row[1] for row in connection.execute("PRAGMA table_info('users')")}
+        if 'password' in columns:
+            raise RuntimeError(f"{path} still uses the legacy password column, start the server once to migrate it")
+        legacy = connection.execute("SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = 'users_legacy'").fetchone()
+        if legacy:
+            print(f"Warning: {path} has a users_legacy table with unmigrated users, they are not copied")
+        return connection.execute("SELECT username, salt, hash, kdf_id, iterations, created_at FROM users ORDER BY id").fetchall()
+    finally:
+        connection.close()
+
+
+def write_shard(path: str, shard: int, shard_count: int, rows: List[tuple]) -> None:
+    """
+    Create a shard file holding the given users.
+
+    @param path: Path of the new shard file
+    @param shard: Index of the shard
+    @param shard_count: Number of shards
+    @param rows: Rows of username, salt, hash, kdf_id, iterations and created_at
+    """
+    connection = sqlite3.connect(path)
+    try:
+        connection.execute(CREATE_USERS_TABLE_SQL)
+        connection.execute(CREATE_SHARD_LAYOUT_TABLE_SQL)
+        connection.execute("INSERT INTO shard_layout (id, shard_index, shard_count) VALUES (0, ?, ?)", (shard, shard_count))
+        connection.executemany("INSERT INTO users (username, salt, hash, kdf_id, iterations, created_at) VALUES (?, ?, ?, ?, ?, ?)", rows)
+        connection.commit()
+    finally:
+        connection.close()
+
+
+def count_users(path: str) -> int:
+    """
+    Count the users of a shard file.
+
+    @param path: Path of the shard file
+    @return: Number of users
+    """
+    connection = sqlite3.connect(f"file:{path}?mode=ro", uri=True)
+    try:
+        return connection.execute("SELECT COUNT(*) FROM users").fetchone()[0]
+    finally:
+        connection.close()
+
+
+def remove_database(path: str) -> None:
+    """
+    Delete a database file together with its journal files.
+
+    @param path: Path of the database file
+    """
+    for candidate in [path] + [path + suffix for suffix in SQLITE_SIDE_FILES]:
+        if os.path.exists(candidate):
+            os.remove(candidate)
+
+
+def reshard(source: str, source_shards: int, target: str, target_shards: int, remove_source: bool, dry_run: bool) -> int:
+    """
+    Move every user from the source shards to the target shards.
+
+    @param source: Configured database path of the existing store
+    @param source_shards: Shard count of the existing store
+    @param target: Configured database path of the new store
+    @param target_shards: Shard count of the new store
+    @param remove_source: Delete the source files once the copy is verified
+    @param dry_run: Only report how the users would be distributed
+    @return: Exit code (0 for success, 1 for error)
+    """
+    source_paths = [shard_path(source, shard, source_shards) for shard in range(source_shards)]
+    target_paths = [shard_path(target, shard, target_shards) for shard in range(target_shards)]
+
+    missing = [path for path in source_paths if not os.path.isfile(path)]
+    if missing:
+        print(f"Error: Source shard files not found: {', '.join(missing)}")
+        return 1
+
+    overlapping = [path for path in target_paths if os.path.exists(path)]
+    foreign = [path for path in overlapping if os.path.abspath(path) not in {os.path.abspath(p) for p in source_paths}]
+    if foreign:
+        print(f"Error: Target files already exist: {', '.join(foreign)}")
+        return 1
+    if overlapping and not remove_source:
+        print(f"Error: Target files would replace source files ({', '.join(overlapping)}), pass --remove-source to allow it")
+        return 1
+
+    distribution: Dict[int, List[tuple]] = {shard: [] for shard in range(target_shards)}
+    total = 0
+    for path in source_paths:
+        rows = read_users(path)
+        print(f"Read {len(rows)} users from {path}")
+        for row in rows:
+            distribution[shard_index(row[0], target_shards)].append(row)
+        total += len(rows)
+
+    for shard in range(target_shards):
+        print(f"Shard {shard}: {len(distribution[shard])} users -> {target_paths[shard]}")
+    if dry_run:
+        print("DRY RUN MODE - No files were written")
+        return 0
+
+    # Write next to the final files first, so a failure never leaves a half-written store behind
+    staging_paths = [path + '.resharding' for path in target_paths]
+    for path in staging_paths:
+        remove_database(path)
+    try:
+        for shard in range(target_shards):
+            write_shard(staging_paths[shard], shard, target_shards, distribution[shard])
+        written = sum(count_users(path) for path in staging_paths)
+        if written != total:
+            raise RuntimeError(f"wrote {written} users but read {total}")
+    except Exception as e:
+        for path in staging_paths:
+            remove_database(path)
+        print(f"Error: Resharding failed: {e}")
+        return 1
+
+    if remove_source:
+        for path in source_paths:
+            remove_database(path)
+            print(f"Removed {path}")
+    for staging, final in zip(staging_paths, target_paths):
+        os.replace(staging, final)
+
+    print(f"\nResharding completed. Moved {total} users from {source_shards} to {target_shards} shards.")
+    if not remove_source and os.path.abspath(source) == os.path.abspath(target):
+        print(f"Move the source files away before starting the server with {target_shards} shards.")
+    return 0
+
+
+def main() -> int:
+    """
+    Main function to parse arguments and execute resharding.
+
+    @return: Exit code (0 for success, 1 for error)
+    """
+    parser = argparse.ArgumentParser(
+        description='Move the users of a credential store to a different number of SQLite shards.',
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""description:
+Reads every user from the source shard files and writes them to new shard files, selected by
+the same FNV-1a username hash the server uses. Stop the server before running this script and
+set sqlite.shardCount to the target shard count afterwards."""
+    )
+
+    parser.add_argument(
+        '--source',
+        default='./users.db',
+        help='Configured database path of the existing store (default: ./users.db)'
+    )
+
+    parser.add_argument(
+        '--source-shards',
+        type=int,
+        default=1,
+        help='Shard count of the existing store (default: 1)'
+    )
+
+    parser.add_argument(
+        '--target',
+        help='Configured database path of the new store (default: same as --source)'
+    )
+
+    parser.add_argument(
+        '--target-shards',
+        type=int,
+        required=True,
+        help='Shard count of the new store'
+    )
+
+    parser.add_argument(
+        '--remove-source',
+        action='store_true',
+        help='Delete the source files once the copy is verified'
+    )
+
+    parser.add_argument(
+        '--dry-run',
+        action='store_true',
+        help='Show how the users would be distributed without writing anything'
+    )
+
+    args = parser.parse_args()
+
+    # Validate shard counts
+    if args.source_shards <= 0 or args.target_shards <= 0:
+        print("Error: Shard counts must be greater than 0")
+        return 1
+
+    target = args.target if args.target else args.source
+    if os.path.abspath(target) == os.path.abspath(args.source) and args.source_shards == args.target_shards:
+        print("Error: Source and target layouts are identical, nothing to do")
+        return 1
+
+    return reshard(args.source, args.source_shards, target, args.target_shards, args.remove_source, args.dry_run)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,124 @@
+#include "AdmissionController.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace server_app::auth {
+    /// @brief Method names indexed by RpcMethod
+    static constexpr std::array<std::string_view, RPC_METHOD_COUNT> RPC_METHOD_NAMES = {
+        "RegisterUser",
+        "AuthenticateUser",
+        "ChangePassword",
+        "ResetPassword",
+        "DeleteUser",
+        "UserExists",
+        "BatchUserExists",
+        "BatchRegisterUsers",
+        "AuthenticateStream",
+        "ValidateToken",
+        "GetServerStats",
+    };
+
+    auto rpcMethodName(const RpcMethod method) noexcept -> std::string_view {
+        return RPC_METHOD_NAMES[static_cast<size_t>(method)];
+    }
+
+    auto rpcMethodFromName(const std::string_view name) noexcept -> std::optional<RpcMethod> {
+        const auto it = std::ranges::find(RPC_METHOD_NAMES, name);
+        if (it == RPC_METHOD_NAMES.end()) {
+            return std::nullopt;
+        }
+        return static_cast<RpcMethod>(it - RPC_METHOD_NAMES.begin());
+    }
+
+    AdmissionController::Permit::Permit(AdmissionController *const controller, const RpcMethod method) noexcept : controller_(controller), method_(method) {
+    }
+
+    AdmissionController::Permit::Permit(Permit &&other) noexcept : controller_(std::exchange(other.controller_, nullptr)), method_(other.method_) {
+    }
+
+    auto AdmissionController::Permit::operator=(Permit &&other) noexcept -> Permit & {
+        if (this != &other) {
+            if (controller_) {
+                controller_->release(method_);
+            }
+            controller_ = std::exchange(other.controller_, nullptr);
+            method_ = other.method_;
+        }
+        return *this;
+    }
+
+    AdmissionController::Permit::~Permit() {
+        if (controller_) {
+            controller_->release(method_);
+        }
+    }
+
+    AdmissionController::AdmissionController(const Limits &limits) noexcept : queue_timeout_(limits.queue_timeout), target_queue_delay_(limits.target_queue_delay) {
+        for (size_t i = 0; i < RPC_METHOD_COUNT; ++i) {
+            methods_[i].max_limit = limits.max_concurrency[i];
+            methods_[i].limit.store(limits.max_concurrency[i], std::memory_order_relaxed);
+        }
+    }
+
+    auto AdmissionController::tryAcquire(const RpcMethod method) noexcept -> std::optional<Permit> {
+        auto &state = methods_[static_cast<size_t>(method)];
+        const auto in_flight = state.in_flight.fetch_add(1, std::memory_order_acq_rel);
+        if (const auto limit = state.limit.load(std::memory_order_relaxed); limit != 0 && in_flight >= limit) {
+            state.in_flight.fetch_sub(1, std::memory_order_acq_rel);
+            state.rejected.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        return Permit{this, method};
+    }
+
+    auto AdmissionController::admitQueued(const RpcMethod method, const std::chrono::steady_clock::time_point enqueued_at) noexcept -> bool {
+        auto &state = methods_[static_cast<size_t>(method)];
+        const auto now = std::chrono::steady_clock::now();
+        const auto delay = now - enqueued_at;
+
+        if (target_queue_delay_.count() > 0 && state.max_limit != 0) {
+            adapt(state, delay, now);
+        }
+
+        if (queue_timeout_.count() > 0 && delay > queue_timeout_) {
+            state.rejected.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    auto AdmissionController::stats(const RpcMethod method) const noexcept -> MethodStats {
+        const auto &state = methods_[static_cast<size_t>(method)];
+        return {state.limit.load(std::memory_order_relaxed), state.in_flight.load(std::memory_order_relaxed), state.rejected.load(std::memory_order_relaxed)};
+    }
+
+    auto AdmissionController::release(const RpcMethod method) noexcept -> void {
+        methods_[static_cast<size_t>(method)].in_flight.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    auto AdmissionController::adapt(MethodState &state, const std::chrono::steady_clock::duration delay, const std::chrono::steady_clock::time_point now) const noexcept -> void {
+        auto limit = state.limit.load(std::memory_order_relaxed);
+
+        if (delay <= target_queue_delay_) {
+            // Additive increase: one step per limit's worth of calls that queued below the target
+            if (state.on_target.fetch_add(1, std::memory_order_relaxed) + 1 < limit) {
+                return;
+            }
+            state.on_target.store(0, std::memory_order_relaxed);
+            while (limit < state.max_limit && !state.limit.compare_exchange_weak(limit, limit + 1, std::memory_order_relaxed)) {
+            }
+            return;
+        }
+
+        // Multiplicative decrease, once per target interval so one burst does not collapse the limit
+        const auto now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+        auto last_decrease_ns = state.last_decrease_ns.load(std::memory_order_relaxed);
+        if (now_ns - last_decrease_ns < std::chrono::duration_cast<std::chrono::nanoseconds>(target_queue_delay_).count() || !state.last_decrease_ns.compare_exchange_strong(last_decrease_ns, now_ns, std::memory_order_relaxed)) {
+            return;
+        }
+        state.on_target.store(0, std::memory_order_relaxed);
+        while (!state.limit.compare_exchange_weak(limit, std::max(MIN_LIMIT, static_cast<uint32_t>(limit * DECREASE_FACTOR)), std::memory_order_relaxed)) {
+        }
+    }
+}
@@ -0,0 +1,147 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace server_app::auth {
+    /// @brief AuthService methods subject to admission control
+    enum class RpcMethod : uint8_t {
+        RegisterUser,
+        AuthenticateUser,
+        ChangePassword,
+        ResetPassword,
+        DeleteUser,
+        UserExists,
+        BatchUserExists,
+        BatchRegisterUsers,
+        AuthenticateStream,
+        ValidateToken,
+        GetServerStats,
+    };
+
+    /// @brief Number of RpcMethod values, for tables indexed by the enum
+    inline constexpr size_t RPC_METHOD_COUNT = static_cast<size_t>(RpcMethod::GetServerStats) + 1;
+
+    /// @brief Get the service method name of an RpcMethod
+    /// @param method Method to name
+    /// @return Method name as declared in RpcService.proto
+    [[nodiscard]] auto rpcMethodName(RpcMethod method) noexcept -> std::string_view;
+
+    /// @brief Look up an RpcMethod by its service method name
+    /// @param name Method name as declared in RpcService.proto
+    /// @return Matching method, nullopt if the name is unknown
+    [[nodiscard]] auto rpcMethodFromName(std::string_view name) noexcept -> std::optional<RpcMethod>;
+
+    /// @brief Per-method concurrency limiter with queue-time load shedding
+    /// @details Every call takes a permit of its method before any work starts and is rejected when the
+    /// method already runs at its limit. Calls that wait for a key-derivation worker are checked again
+    /// when they are dequeued: a call that queued longer than the queue timeout is rejected before any
+    /// hashing starts, since its client has most likely given up. The queueing delay observed at that
+    /// point also drives an AIMD limit: a delay above the target shrinks the method's limit by a
+    /// constant factor, at most once per target interval, while every limit's worth of calls that
+    /// queued below the target grows it by one, up to the configured cap.
+    class AdmissionController {
+    public:
+        /// @brief Static configuration of the controller
+        struct Limits {
+            std::array<uint32_t, RPC_METHOD_COUNT> max_concurrency{}; ///< Concurrency cap of every method, 0 for unlimited
+            std::chrono::milliseconds queue_timeout{0}; ///< Longest wait for a key-derivation worker, 0 to never shed
+            std::chrono::milliseconds target_queue_delay{0}; ///< Queueing delay the adaptive limit aims for, 0 to keep the caps fixed
+        };
+
+        /// @brief Admission of one call, released when destroyed
+        class Permit {
+        public:
+            /// @brief Move constructor that takes over the admission
+            Permit(Permit &&other) noexcept;
+
+            /// @brief Move assignment operator that releases the held admission first
+            auto operator=(Permit &&other) noexcept -> Permit &;
+
+            /// @brief Copy constructor (deleted)
+            Permit(const Permit &) = delete;
+
+            /// @brief Copy assignment operator (deleted)
+            auto operator=(const Permit &) -> Permit & = delete;
+
+            /// @brief Destructor that releases the admission
+            ~Permit();
+
+        private:
+            friend class AdmissionController;
+
+            Permit(AdmissionController *controller, RpcMethod method) noexcept;
+
+            AdmissionController *controller_;
+            RpcMethod method_;
+        };
+
+        /// @brief Point-in-time view of one method
+        struct MethodStats {
+            uint32_t limit{0}; ///< Current concurrency limit, 0 for unlimited
+            uint32_t in_flight{0}; ///< Calls currently holding a permit
+            uint64_t rejected{0}; ///< Calls rejected by the limit or the queue timeout
+        };
+
+        /// @brief Construct a controller with the given limits
+        /// @param limits Concurrency caps and queueing thresholds
+        explicit AdmissionController(const Limits &limits) noexcept;
+
+        /// @brief Copy constructor (deleted)
+        AdmissionController(const AdmissionController &) = delete;
+
+        /// @brief Copy assignment operator (deleted)
+        auto operator=(const AdmissionController &) -> AdmissionController & = delete;
+
+        /// @brief Admit a call if its method is below its limit
+        /// @param method Method of the call
+        /// @return Permit to hold until the call finished, nullopt if the call must be rejected
+        [[nodiscard]] auto tryAcquire(RpcMethod method) noexcept -> std::optional<Permit>;
+
+        /// @brief Check a call leaving the key-derivation queue and feed its delay to the adaptive limit
+        /// @param method Method of the call
+        /// @param enqueued_at Time the call was queued
+        /// @return true if the call may proceed, false if it queued longer than the queue timeout
+        [[nodiscard]] auto admitQueued(RpcMethod method, std::chrono::steady_clock::time_point enqueued_at) noexcept -> bool;
+
+        /// @brief Get the current state of a method
+        /// @param method Method to inspect
+        /// @return Limit, in-flight calls and rejections of the method
+        [[nodiscard]] auto stats(RpcMethod method) const noexcept -> MethodStats;
+
+    private:
+        /// @brief Factor the limit is multiplied with when the queueing delay exceeds the target
+        static constexpr double DECREASE_FACTOR = 0.9;
+
+        /// @brief Floor of the adaptive limit, so a method is never shut off completely
+        static constexpr uint32_t MIN_LIMIT = 1;
+
+        /// @brief Mutable state of one method
+        struct MethodState {
+            std::atomic<uint32_t> limit{0};
+            std::atomic<uint32_t> in_flight{0};
+            std::atomic<uint32_t> on_target{0}; ///< Calls below the target delay since the last increase
+            std::atomic<int64_t> last_decrease_ns{0}; ///< Steady clock time of the last decrease
+            std::atomic<uint64_t> rejected{0};
+            uint32_t max_limit{0};
+        };
+
+        /// @brief Release the permit of a finished call
+        /// @param method Method of the call
+        auto release(RpcMethod method) noexcept -> void;
+
+        /// @brief Adjust the limit of a method after a call left the queue
+        /// @param state State of the call's method
+        /// @param delay Time the call spent queued
+        /// @param now Time the call was dequeued
+        auto adapt(MethodState &state, std::chrono::steady_clock::duration delay, std::chrono::steady_clock::time_point now) const noexcept -> void;
+
+        std::array<MethodState, RPC_METHOD_COUNT> methods_;
+        std::chrono::milliseconds queue_timeout_;
+        std::chrono::milliseconds target_queue_delay_;
+    };
+}
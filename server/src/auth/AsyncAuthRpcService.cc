@@ -0,0 +1,215 @@
+#include "AsyncAuthRpcService.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <fmt/format.h>
+#include <glog/logging.h>
+
+namespace server_app::auth {
+    /// @brief State machine for a single unary AuthService call
+    /// @tparam RequestType Request message type of the method
+    /// @tparam ResponseType Response message type of the method
+    /// @details Each instance requests exactly one call from the completion queue. Once the call
+    /// arrives it immediately requests its successor, passes admission control and runs the handler,
+    /// either on the poller thread or, for password hashing methods, on the key-derivation executor
+    /// which then finishes the call itself. No successor is requested once the service is shutting
+    /// down. The admission permit is held until the response is sent, and the latency from admission
+    /// until then is recorded together with the handler's phase split. The instance deletes itself
+    /// when the finish tag comes back.
+    template<typename RequestType, typename ResponseType>
+    class AsyncAuthRpcService::UnaryCallData final : public ICallData {
+    public:
+        using RequestMethod = void (HybridService::*)(grpc::ServerContext *, RequestType *, grpc::ServerAsyncResponseWriter<ResponseType> *, grpc::CompletionQueue *, grpc::ServerCompletionQueue *, void *);
+        using HandlerMethod = grpc::Status (AuthRpcService::*)(const RequestType *, ResponseType *);
+
+        UnaryCallData(AsyncAuthRpcService &owner, grpc::ServerCompletionQueue *cq, const RpcMethod method, const RequestMethod request_method, const HandlerMethod handler_method, const bool offload) : owner_(owner), service_(owner.service_), handler_(owner.handler_), cq_(cq), method_(method), request_method_(request_method), handler_method_(handler_method), offload_(offload), responder_(&context_) {
+            (service_.*request_method_)(&context_, &request_, &responder_, cq_, cq_, this);
+        }
+
+        auto proceed(const bool ok) -> void override {
+            if (state_ == CallState::FINISH || !ok) {
+                // Either the response has been sent or the server is shutting down
+                delete this;
+                return;
+            }
+
+            // Keep one outstanding request per method so the next call can be accepted right away. The
+            // successor is requested under the shutdown lock so it never races the queue's Shutdown().
+            {
+                const std::lock_guard lock(owner_.shutdown_mutex_);
+                if (!owner_.shutting_down_) {
+                    new UnaryCallData(owner_, cq_, method_, request_method_, handler_method_, offload_);
+                }
+            }
+
+            permit_ = handler_.TryAdmit(method_);
+            if (!permit_) {
+                finish(AuthRpcService::RejectOverloaded(&response_));
+                return;
+            }
+            started_at_ = std::chrono::steady_clock::now();
+
+            if (!offload_) {
+                process();
+                return;
+            }
+
+            // Password hashing must not occupy a poller thread, the worker finishes the call
+            if (!handler_.TrySubmitKdf([this] {
+                timing_.queue = std::chrono::steady_clock::now() - started_at_;
+                // Shed the call before hashing if its client has most likely given up already
+                if (!handler_.AdmitQueued(method_, started_at_)) {
+                    recordLatency();
+                    finish(AuthRpcService::RejectOverloaded(&response_));
+                    return;
+                }
+                process();
+            })) {
+                finish(AuthRpcService::RejectBusy(&response_));
+            }
+        }
+
+    private:
+        /// @brief Run the handler and send its response
+        auto process() -> void {
+            grpc::Status status;
+            try {
+                status = AuthRpcService::RunTimed([this] { return (handler_.*handler_method_)(&request_, &response_); }, timing_);
+            } catch (const std::exception &e) {
+                response_.set_success(false);
+                response_.set_message(fmt::format("System error: {}", e.what()));
+                response_.set_error_code(500);
+                status = grpc::Status{grpc::StatusCode::INTERNAL, e.what()};
+            }
+            recordLatency();
+            finish(status);
+        }
+
+        /// @brief Record the latency of the call from admission until now
+        auto recordLatency() noexcept -> void {
+            timing_.total = std::chrono::steady_clock::now() - started_at_;
+            handler_.RecordLatency(method_, timing_);
+        }
+
+        /// @brief Send the response and wait for the finish tag
+        /// @param status Status to send to the client
+        auto finish(const grpc::Status &status) -> void {
+            permit_.reset();
+            state_ = CallState::FINISH;
+            responder_.Finish(response_, status, this);
+        }
+
+        enum class CallState { PROCESS, FINISH };
+
+        AsyncAuthRpcService &owner_;
+        HybridService &service_;
+        AuthRpcService &handler_;
+        grpc::ServerCompletionQueue *cq_;
+        RpcMethod method_;
+        RequestMethod request_method_;
+        HandlerMethod handler_method_;
+        bool offload_;
+        grpc::ServerContext context_;
+        RequestType request_;
+        ResponseType response_;
+        grpc::ServerAsyncResponseWriter<ResponseType> responder_;
+        CallState state_{CallState::PROCESS};
+        std::optional<AdmissionController::Permit> permit_;
+        std::chrono::steady_clock::time_point started_at_;
+        RpcLatencyStats::CallTiming timing_;
+    };
+
+    AsyncAuthRpcService::HybridService::HybridService(AuthRpcService &handler) noexcept : handler_(handler) {
+    }
+
+    auto AsyncAuthRpcService::HybridService::AuthenticateStream(::grpc::ServerContext *context, ::grpc::ServerReaderWriter<::rpc::AuthResponse, ::rpc::AuthenticateUserRequest> *stream) -> ::grpc::Status {
+        return handler_.AuthenticateStream(context, stream);
+    }
+
+    AsyncAuthRpcService::AsyncAuthRpcService(AuthRpcService &handler) noexcept : handler_(handler), service_(handler) {
+    }
+
+    AsyncAuthRpcService::~AsyncAuthRpcService() noexcept {
+        shutdown();
+    }
+
+    auto AsyncAuthRpcService::registerWith(grpc::ServerBuilder &builder, const int32_t completion_queue_count) -> void {
+        if (completion_queue_count <= 0) {
+            throw std::invalid_argument(fmt::format("AsyncAuthRpcService::registerWith: completion queue count must be greater than 0, got {}", completion_queue_count));
+        }
+
+        builder.RegisterService(&service_);
+        completion_queues_.reserve(static_cast<size_t>(completion_queue_count));
+        for (int32_t i = 0; i < completion_queue_count; ++i) {
+            completion_queues_.emplace_back(builder.AddCompletionQueue());
+        }
+        LOG(INFO) << fmt::format("Async AuthService registered with {} completion queues", completion_queue_count);
+    }
+
+    auto AsyncAuthRpcService::start(const int32_t poller_threads_per_queue) -> void {
+        if (completion_queues_.empty()) {
+            throw std::logic_error("AsyncAuthRpcService::start: registerWith must be called before start");
+        }
+
+        if (poller_threads_per_queue <= 0) {
+            throw std::invalid_argument(fmt::format("AsyncAuthRpcService::start: poller threads per queue must be greater than 0, got {}", poller_threads_per_queue));
+        }
+
+        if (started_.exchange(true)) {
+            throw std::logic_error("AsyncAuthRpcService::start: service is already running");
+        }
+
+        pollers_.reserve(completion_queues_.size() * static_cast<size_t>(poller_threads_per_queue));
+        for (const auto &cq: completion_queues_) {
+            seedCalls(cq.get());
+            for (int32_t i = 0; i < poller_threads_per_queue; ++i) {
+                pollers_.emplace_back(&AsyncAuthRpcService::poll, cq.get());
+            }
+        }
+        LOG(INFO) << fmt::format("Async AuthService started with {} poller threads", pollers_.size());
+    }
+
+    auto AsyncAuthRpcService::shutdown() noexcept -> void {
+        if (!started_ || shut_down_.exchange(true)) {
+            return;
+        }
+
+        LOG(INFO) << "Shutting down async AuthService completion queues";
+        {
+            const std::lock_guard lock(shutdown_mutex_);
+            shutting_down_ = true;
+            for (const auto &cq: completion_queues_) {
+                cq->Shutdown();
+            }
+        }
+        for (auto &poller: pollers_) {
+            if (poller.joinable()) {
+                poller.join();
+            }
+        }
+        LOG(INFO) << "Async AuthService completion queues drained";
+    }
+
+    auto AsyncAuthRpcService::seedCalls(grpc::ServerCompletionQueue *cq) -> void {
+        new UnaryCallData<rpc::RegisterUserRequest, rpc::AuthResponse>(*this, cq, RpcMethod::RegisterUser, &HybridService::RequestRegisterUser, &AuthRpcService::HandleRegisterUser, true);
+        new UnaryCallData<rpc::AuthenticateUserRequest, rpc::AuthResponse>(*this, cq, RpcMethod::AuthenticateUser, &HybridService::RequestAuthenticateUser, &AuthRpcService::HandleAuthenticateUser, true);
+        new UnaryCallData<rpc::ChangePasswordRequest, rpc::AuthResponse>(*this, cq, RpcMethod::ChangePassword, &HybridService::RequestChangePassword, &AuthRpcService::HandleChangePassword, true);
+        new UnaryCallData<rpc::ResetPasswordRequest, rpc::AuthResponse>(*this, cq, RpcMethod::ResetPassword, &HybridService::RequestResetPassword, &AuthRpcService::HandleResetPassword, true);
+        new UnaryCallData<rpc::DeleteUserRequest, rpc::AuthResponse>(*this, cq, RpcMethod::DeleteUser, &HybridService::RequestDeleteUser, &AuthRpcService::HandleDeleteUser, false);
+        new UnaryCallData<rpc::UserExistsRequest, rpc::AuthResponse>(*this, cq, RpcMethod::UserExists, &HybridService::RequestUserExists, &AuthRpcService::HandleUserExists, false);
+        new UnaryCallData<rpc::BatchUserExistsRequest, rpc::BatchUserExistsResponse>(*this, cq, RpcMethod::BatchUserExists, &HybridService::RequestBatchUserExists, &AuthRpcService::HandleBatchUserExists, false);
+        new UnaryCallData<rpc::BatchRegisterUsersRequest, rpc::BatchRegisterUsersResponse>(*this, cq, RpcMethod::BatchRegisterUsers, &HybridService::RequestBatchRegisterUsers, &AuthRpcService::HandleBatchRegisterUsers, true);
+        new UnaryCallData<rpc::ValidateTokenRequest, rpc::ValidateTokenResponse>(*this, cq, RpcMethod::ValidateToken, &HybridService::RequestValidateToken, &AuthRpcService::HandleValidateToken, false);
+        new UnaryCallData<rpc::GetServerStatsRequest, rpc::GetServerStatsResponse>(*this, cq, RpcMethod::GetServerStats, &HybridService::RequestGetServerStats, &AuthRpcService::HandleGetServerStats, false);
+    }
+
+    auto AsyncAuthRpcService::poll(grpc::ServerCompletionQueue *cq) -> void {
+        void *tag = nullptr;
+        bool ok = false;
+        while (cq->Next(&tag, &ok)) {
+            static_cast<ICallData *>(tag)->proceed(ok);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <grpcpp/server_builder.h>
+
+#include "generated/RpcService.grpc.pb.h"
+#include "AuthRpcService.hpp"
+
+namespace server_app::auth {
+    /// @brief Completion-queue driven implementation of the AuthService
+    /// @details Instead of pinning one gRPC sync-server thread to every in-flight RPC, this class
+    /// registers every unary method as async, owns a configurable number of server completion queues
+    /// and drains each of them with a fixed number of poller threads. The bidirectional
+    /// AuthenticateStream stays a sync method of the same service and runs on the server's sync
+    /// thread pool. The business logic is delegated to an AuthRpcService instance so both server
+    /// modes share one implementation.
+    class AsyncAuthRpcService final {
+    public:
+        /// @brief Construct an async service that forwards every call to the given handler
+        /// @param handler Service implementation that performs the actual work
+        explicit AsyncAuthRpcService(AuthRpcService &handler) noexcept;
+
+        /// @brief Destructor that drains the completion queues and joins the poller threads
+        ~AsyncAuthRpcService() noexcept;
+
+        /// @brief Copy constructor (deleted)
+        AsyncAuthRpcService(const AsyncAuthRpcService &) = delete;
+
+        /// @brief Copy assignment operator (deleted)
+        auto operator=(const AsyncAuthRpcService &) -> AsyncAuthRpcService & = delete;
+
+        /// @brief Move constructor (deleted)
+        AsyncAuthRpcService(AsyncAuthRpcService &&) = delete;
+
+        /// @brief Move assignment operator (deleted)
+        auto operator=(AsyncAuthRpcService &&) -> AsyncAuthRpcService & = delete;
+
+        /// @brief Register the async service and its completion queues with a server builder
+        /// @param builder Server builder that has not been started yet
+        /// @param completion_queue_count Number of completion queues to create
+        auto registerWith(grpc::ServerBuilder &builder, int32_t completion_queue_count) -> void;
+
+        /// @brief Start serving requests once the server has been built
+        /// @param poller_threads_per_queue Number of threads draining each completion queue
+        /// @throws std::logic_error if called before registerWith or called twice
+        auto start(int32_t poller_threads_per_queue) -> void;
+
+        /// @brief Shut down all completion queues and join the poller threads
+        /// @details Must be called after grpc::Server::Shutdown and after the handler drained its
+        /// key-derivation executor, so that no worker finishes a call on a shut down queue.
+        auto shutdown() noexcept -> void;
+
+    private:
+        /// @brief Generated service with every unary method switched to the async API
+        using UnaryAsyncService = rpc::AuthService::WithAsyncMethod_RegisterUser<rpc::AuthService::WithAsyncMethod_AuthenticateUser<rpc::AuthService::WithAsyncMethod_ChangePassword<rpc::AuthService::WithAsyncMethod_ResetPassword<rpc::AuthService::WithAsyncMethod_DeleteUser<rpc::AuthService::WithAsyncMethod_UserExists<rpc::AuthService::WithAsyncMethod_BatchUserExists<rpc::AuthService::WithAsyncMethod_BatchRegisterUsers<rpc::AuthService::WithAsyncMethod_ValidateToken<rpc::AuthService::WithAsyncMethod_GetServerStats<rpc::AuthService::Service> > > > > > > > > >;
+
+        /// @brief Async unary service that serves AuthenticateStream synchronously through the handler
+        class HybridService final : public UnaryAsyncService {
+        public:
+            /// @brief Construct a service forwarding the streaming method to the given handler
+            /// @param handler Service implementation that performs the actual work
+            explicit HybridService(AuthRpcService &handler) noexcept;
+
+            /// @brief Authenticate a stream of credentials on a sync server thread
+            [[nodiscard]] auto AuthenticateStream(::grpc::ServerContext *context, ::grpc::ServerReaderWriter<::rpc::AuthResponse, ::rpc::AuthenticateUserRequest> *stream) -> ::grpc::Status override;
+
+        private:
+            AuthRpcService &handler_;
+        };
+
+        /// @brief Common interface for per-call state machines stored as completion queue tags
+        class ICallData {
+        public:
+            virtual ~ICallData() = default;
+
+            /// @brief Advance the state machine after the completion queue delivered this tag
+            /// @param ok Whether the operation associated with the tag succeeded
+            virtual auto proceed(bool ok) -> void = 0;
+        };
+
+        template<typename RequestType, typename ResponseType>
+        class UnaryCallData;
+
+        /// @brief Seed one pending call for every unary AuthService method on a completion queue
+        /// @param cq Completion queue that will receive the new calls
+        auto seedCalls(grpc::ServerCompletionQueue *cq) -> void;
+
+        /// @brief Poller loop draining one completion queue until it is shut down
+        /// @param cq Completion queue to drain
+        static auto poll(grpc::ServerCompletionQueue *cq) -> void;
+
+        AuthRpcService &handler_;
+        HybridService service_;
+        std::vector<std::unique_ptr<grpc::ServerCompletionQueue> > completion_queues_;
+        std::vector<std::thread> pollers_;
+        std::atomic<bool> started_{false};
+        std::atomic<bool> shut_down_{false};
+        std::mutex shutdown_mutex_;
+        bool shutting_down_{false};
+    };
+}
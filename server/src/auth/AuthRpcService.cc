@@ -1,21 +1,41 @@
 #include "AuthRpcService.hpp"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <fmt/format.h>
+#include <glog/logging.h>
 
 namespace server_app::auth {
-    /// @brief Map exception types to error codes using table-driven approach
-    const std::unordered_map<std::string_view, int> AuthRpcService::error_map_ = {
-        {"already exists", 409}, // Conflict
-        {"not found", 404}, // Not found
-        {"locked", 423}, // Locked
-        {"Invalid password", 401} // Unauthorized
+    /// @brief Error codes indexed by common::auth::AuthError
+    static constexpr std::array<int, common::auth::AUTH_ERROR_COUNT> ERROR_CODES = {
+        400, // InvalidUsername: Bad request
+        409, // UserAlreadyExists: Conflict
+        400, // WeakPassword: Bad request
+        400, // WeakNewPassword: Bad request
+        404, // UserNotFound: Not found
+        423, // AccountLocked: Locked
+        401, // InvalidPassword: Unauthorized
+        400, // IncorrectCurrentPassword: Bad request
+        400, // UnsupportedKdf: Bad request
+        400, // ConcurrentPasswordChange: Bad request
+        400, // CredentialsChanged: Bad request
+        500, // StorageFailure: Internal server error
     };
 
     /// @brief Helper function to validate request parameters
-    template<typename RequestType, typename ValidatorFunc>
-    [[nodiscard]] static auto ValidateRequest(const RequestType *request, ValidatorFunc &&validator, const std::string &error_msg, ::rpc::AuthResponse *response) noexcept -> std::optional<::grpc::Status> {
+    /// @details Validators only inspect the request and messages are passed as views of static strings,
+    /// so validation itself never allocates.
+    template<typename RequestType, typename ResponseType, typename ValidatorFunc>
+    [[nodiscard]] static auto ValidateRequest(const RequestType *request, ValidatorFunc &&validator, const std::string_view error_msg, ResponseType *response) noexcept -> std::optional<::grpc::Status> {
         if (!request || !validator(request)) {
             response->set_success(false);
             response->set_message(error_msg);
@@ -25,10 +45,129 @@ namespace server_app::auth {
         return std::nullopt; // No error, continue with normal processing
     }
 
-    AuthRpcService::AuthRpcService(const std::string &db_path) noexcept : authenticator_(db_path) {
+    /// @brief Copy the percentiles of a latency histogram into a response summary
+    /// @param snapshot Merged histogram
+    /// @param summary Summary to populate
+    static auto FillLatencySummary(const common::time::LatencyHistogram::Snapshot &snapshot, ::rpc::LatencySummary *const summary) -> void {
+        summary->set_count(snapshot.count());
+        summary->set_p50_us(static_cast<uint64_t>(snapshot.valueAtPercentile(50.0).count()));
+        summary->set_p99_us(static_cast<uint64_t>(snapshot.valueAtPercentile(99.0).count()));
+        summary->set_p999_us(static_cast<uint64_t>(snapshot.valueAtPercentile(99.9).count()));
+        summary->set_max_us(static_cast<uint64_t>(snapshot.max().count()));
+    }
+
+    AuthRpcService::AuthRpcService(const std::string &db_path, const common::sql::sqlite::SQLiteOptions &sqlite_options, const common::auth::UserAuthenticatorOptions &authenticator_options, const size_t kdf_worker_threads, const size_t kdf_queue_size, const AdmissionController::Limits &admission_limits) : authenticator_(db_path, common::auth::PasswordPolicy(), sqlite_options, authenticator_options), kdf_executor_(kdf_worker_threads, kdf_worker_threads, kdf_queue_size, std::chrono::minutes(1)), admission_(admission_limits) {
     }
 
     [[nodiscard]] auto AuthRpcService::RegisterUser(::grpc::ServerContext * /*context*/, const ::rpc::RegisterUserRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
+        return RunOnKdfExecutor(RpcMethod::RegisterUser, response, [this, request, response] { return HandleRegisterUser(request, response); });
+    }
+
+    [[nodiscard]] auto AuthRpcService::AuthenticateUser(::grpc::ServerContext * /*context*/, const ::rpc::AuthenticateUserRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
+        return RunOnKdfExecutor(RpcMethod::AuthenticateUser, response, [this, request, response] { return HandleAuthenticateUser(request, response); });
+    }
+
+    [[nodiscard]] auto AuthRpcService::ChangePassword(::grpc::ServerContext * /*context*/, const ::rpc::ChangePasswordRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
+        return RunOnKdfExecutor(RpcMethod::ChangePassword, response, [this, request, response] { return HandleChangePassword(request, response); });
+    }
+
+    [[nodiscard]] auto AuthRpcService::ResetPassword(::grpc::ServerContext * /*context*/, const ::rpc::ResetPasswordRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
+        return RunOnKdfExecutor(RpcMethod::ResetPassword, response, [this, request, response] { return HandleResetPassword(request, response); });
+    }
+
+    [[nodiscard]] auto AuthRpcService::DeleteUser(::grpc::ServerContext * /*context*/, const ::rpc::DeleteUserRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
+        return RunAdmitted(RpcMethod::DeleteUser, response, [this, request, response] { return HandleDeleteUser(request, response); });
+    }
+
+    [[nodiscard]] auto AuthRpcService::UserExists(::grpc::ServerContext * /*context*/, const ::rpc::UserExistsRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
+        return RunAdmitted(RpcMethod::UserExists, response, [this, request, response] { return HandleUserExists(request, response); });
+    }
+
+    [[nodiscard]] auto AuthRpcService::BatchUserExists(::grpc::ServerContext * /*context*/, const ::rpc::BatchUserExistsRequest *const request, ::rpc::BatchUserExistsResponse *const response) -> ::grpc::Status {
+        return RunAdmitted(RpcMethod::BatchUserExists, response, [this, request, response] { return HandleBatchUserExists(request, response); });
+    }
+
+    [[nodiscard]] auto AuthRpcService::BatchRegisterUsers(::grpc::ServerContext * /*context*/, const ::rpc::BatchRegisterUsersRequest *const request, ::rpc::BatchRegisterUsersResponse *const response) -> ::grpc::Status {
+        return RunOnKdfExecutor(RpcMethod::BatchRegisterUsers, response, [this, request, response] { return HandleBatchRegisterUsers(request, response); });
+    }
+
+    [[nodiscard]] auto AuthRpcService::AuthenticateStream(::grpc::ServerContext * /*context*/, ::grpc::ServerReaderWriter<::rpc::AuthResponse, ::rpc::AuthenticateUserRequest> *const stream) -> ::grpc::Status {
+        /// @brief One request of the stream together with its response and pending status
+        struct PendingAuthentication {
+            ::rpc::AuthenticateUserRequest request;
+            ::rpc::AuthResponse response;
+            std::optional<std::future<::grpc::Status> > status;
+        };
+
+        // The stream as a whole holds one permit, its requests are shed individually when they queue too long
+        const auto permit = admission_.tryAcquire(RpcMethod::AuthenticateStream);
+        if (!permit) {
+            return {::grpc::StatusCode::UNAVAILABLE, "Admission limit reached"};
+        }
+
+        std::deque<std::unique_ptr<PendingAuthentication> > in_flight;
+
+        // Workers reference the queued entries, so they must finish before the entries are released
+        const auto wait_in_flight = [&in_flight] {
+            for (const auto &pending: in_flight) {
+                if (pending->status) {
+                    pending->status->wait();
+                }
+            }
+        };
+
+        // Responses are written in request order, waiting for the oldest request first
+        const auto write_oldest = [&in_flight, stream] {
+            const auto pending = std::move(in_flight.front());
+            in_flight.pop_front();
+            if (pending->status) {
+                static_cast<void>(pending->status->get());
+            }
+            return stream->Write(pending->response);
+        };
+
+        auto next = std::make_unique<PendingAuthentication>();
+        while (stream->Read(&next->request)) {
+            auto *const pending = next.get();
+            if (auto future = kdf_executor_.trySubmit([this, pending, enqueued_at = std::chrono::steady_clock::now()] {
+                RpcLatencyStats::CallTiming timing;
+                timing.queue = std::chrono::steady_clock::now() - enqueued_at;
+                const auto status = admission_.admitQueued(RpcMethod::AuthenticateStream, enqueued_at) ? RunTimed([this, pending] { return HandleAuthenticateUser(&pending->request, &pending->response); }, timing) : RejectOverloaded(&pending->response);
+                timing.total = std::chrono::steady_clock::now() - enqueued_at;
+                latency_stats_.record(RpcMethod::AuthenticateStream, timing);
+                return status;
+            })) {
+                pending->status = std::move(*future);
+            } else {
+                static_cast<void>(RejectBusy(&pending->response));
+            }
+            in_flight.push_back(std::move(next));
+            next = std::make_unique<PendingAuthentication>();
+
+            if (in_flight.size() >= STREAM_PIPELINE_DEPTH && !write_oldest()) {
+                wait_in_flight();
+                return {::grpc::StatusCode::CANCELLED, "Stream closed by client"};
+            }
+        }
+
+        while (!in_flight.empty()) {
+            if (!write_oldest()) {
+                wait_in_flight();
+                return {::grpc::StatusCode::CANCELLED, "Stream closed by client"};
+            }
+        }
+        return ::grpc::Status::OK;
+    }
+
+    [[nodiscard]] auto AuthRpcService::ValidateToken(::grpc::ServerContext * /*context*/, const ::rpc::ValidateTokenRequest *const request, ::rpc::ValidateTokenResponse *const response) -> ::grpc::Status {
+        return RunAdmitted(RpcMethod::ValidateToken, response, [this, request, response] { return HandleValidateToken(request, response); });
+    }
+
+    [[nodiscard]] auto AuthRpcService::GetServerStats(::grpc::ServerContext * /*context*/, const ::rpc::GetServerStatsRequest *const request, ::rpc::GetServerStatsResponse *const response) -> ::grpc::Status {
+        return RunAdmitted(RpcMethod::GetServerStats, response, [this, request, response] { return HandleGetServerStats(request, response); });
+    }
+
+    [[nodiscard]] auto AuthRpcService::HandleRegisterUser(const ::rpc::RegisterUserRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
         // Validate request parameters using table-driven validation
         const auto validation_status = ValidateRequest(request, [](const ::rpc::RegisterUserRequest *req) {
             return !req->username().empty() && !req->password().empty();
@@ -41,12 +180,12 @@ namespace server_app::auth {
         try {
             const auto &username = request->username();
             const auto &password = request->password();
-            const bool success = authenticator_.register_user(username, password);
-            response->set_success(success);
-            response->set_message(success ? "User registered successfully" : "Registration failed");
+            if (const auto registered = authenticator_.register_user(username, password); !registered) {
+                return HandleAuthError(registered.error(), response);
+            }
+            response->set_success(true);
+            response->set_message("User registered successfully");
             return ::grpc::Status::OK;
-        } catch (const common::exception::AuthenticationException &e) {
-            return HandleAuthException(e, response);
         } catch (const std::exception &e) {
             response->set_success(false);
             response->set_message(fmt::format("System error: {}", e.what()));
@@ -55,7 +194,7 @@ namespace server_app::auth {
         }
     }
 
-    [[nodiscard]] auto AuthRpcService::AuthenticateUser(::grpc::ServerContext * /*context*/, const ::rpc::AuthenticateUserRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
+    [[nodiscard]] auto AuthRpcService::HandleAuthenticateUser(const ::rpc::AuthenticateUserRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
         // Validate request parameters using table-driven validation
         const auto validation_status = ValidateRequest(request, [](const ::rpc::AuthenticateUserRequest *req) {
             return !req->username().empty() && !req->password().empty();
@@ -68,12 +207,17 @@ namespace server_app::auth {
         try {
             const auto &username = request->username();
             const auto &password = request->password();
-            const bool success = authenticator_.authenticate(username, password);
-            response->set_success(success);
-            response->set_message(success ? "Authentication successful" : "Invalid credentials");
+            auto authenticated = authenticator_.authenticate_session(username, password);
+            if (!authenticated) {
+                return HandleAuthError(authenticated.error(), response);
+            }
+            if (auto &issued_token = *authenticated) {
+                response->set_session_token(std::move(issued_token->token));
+                response->set_session_expires_at_ms(std::chrono::duration_cast<std::chrono::milliseconds>(issued_token->expires_at.time_since_epoch()).count());
+            }
+            response->set_success(true);
+            response->set_message("Authentication successful");
             return ::grpc::Status::OK;
-        } catch (const common::exception::AuthenticationException &e) {
-            return HandleAuthException(e, response);
         } catch (const std::exception &e) {
             response->set_success(false);
             response->set_message(fmt::format("System error: {}", e.what()));
@@ -82,7 +226,7 @@ namespace server_app::auth {
         }
     }
 
-    [[nodiscard]] auto AuthRpcService::ChangePassword(::grpc::ServerContext * /*context*/, const ::rpc::ChangePasswordRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
+    [[nodiscard]] auto AuthRpcService::HandleChangePassword(const ::rpc::ChangePasswordRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
         // Validate request parameters using table-driven validation
         const auto validation_status = ValidateRequest(request, [](const ::rpc::ChangePasswordRequest *req) {
             return !req->username().empty() && !req->current_password().empty() && !req->new_password().empty();
@@ -97,12 +241,12 @@ namespace server_app::auth {
             const auto &current_password = request->current_password();
             const auto &new_password = request->new_password();
 
-            const bool success = authenticator_.change_password(username, current_password, new_password);
-            response->set_success(success);
-            response->set_message(success ? "Password changed successfully" : "Password change failed");
+            if (const auto changed = authenticator_.change_password(username, current_password, new_password); !changed) {
+                return HandleAuthError(changed.error(), response);
+            }
+            response->set_success(true);
+            response->set_message("Password changed successfully");
             return ::grpc::Status::OK;
-        } catch (const common::exception::AuthenticationException &e) {
-            return HandleAuthException(e, response);
         } catch (const std::exception &e) {
             response->set_success(false);
             response->set_message(fmt::format("System error: {}", e.what()));
@@ -111,7 +255,7 @@ namespace server_app::auth {
         }
     }
 
-    [[nodiscard]] auto AuthRpcService::ResetPassword(::grpc::ServerContext * /*context*/, const ::rpc::ResetPasswordRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
+    [[nodiscard]] auto AuthRpcService::HandleResetPassword(const ::rpc::ResetPasswordRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
         // Validate request parameters using table-driven validation
         const auto validation_status = ValidateRequest(request, [](const ::rpc::ResetPasswordRequest *req) {
             return !req->username().empty() && !req->new_password().empty();
@@ -125,12 +269,12 @@ namespace server_app::auth {
             const auto &username = request->username();
             const auto &new_password = request->new_password();
 
-            const bool success = authenticator_.reset_password(username, new_password);
-            response->set_success(success);
-            response->set_message(success ? "Password reset successfully" : "Password reset failed");
+            if (const auto reset = authenticator_.reset_password(username, new_password); !reset) {
+                return HandleAuthError(reset.error(), response);
+            }
+            response->set_success(true);
+            response->set_message("Password reset successfully");
             return ::grpc::Status::OK;
-        } catch (const common::exception::AuthenticationException &e) {
-            return HandleAuthException(e, response);
         } catch (const std::exception &e) {
             response->set_success(false);
             response->set_message(fmt::format("System error: {}", e.what()));
@@ -139,7 +283,7 @@ namespace server_app::auth {
         }
     }
 
-    [[nodiscard]] auto AuthRpcService::DeleteUser(::grpc::ServerContext * /*context*/, const ::rpc::DeleteUserRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
+    [[nodiscard]] auto AuthRpcService::HandleDeleteUser(const ::rpc::DeleteUserRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
         // Validate request parameters using table-driven validation
         const auto validation_status = ValidateRequest(request, [](const ::rpc::DeleteUserRequest *req) {
             return !req->username().empty();
@@ -163,7 +307,7 @@ namespace server_app::auth {
         }
     }
 
-    [[nodiscard]] auto AuthRpcService::UserExists(::grpc::ServerContext * /*context*/, const ::rpc::UserExistsRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
+    [[nodiscard]] auto AuthRpcService::HandleUserExists(const ::rpc::UserExistsRequest *const request, ::rpc::AuthResponse *const response) -> ::grpc::Status {
         // Validate request parameters using table-driven validation
         const auto validation_status = ValidateRequest(request, [](const ::rpc::UserExistsRequest *req) {
             return !req->username().empty();
@@ -187,21 +331,256 @@ namespace server_app::auth {
         }
     }
 
-    [[nodiscard]] auto AuthRpcService::HandleAuthException(const common::exception::AuthenticationException &e, ::rpc::AuthResponse *const response) noexcept -> ::grpc::Status {
-        response->set_success(false);
-        response->set_message(e.what());
+    [[nodiscard]] auto AuthRpcService::HandleBatchUserExists(const ::rpc::BatchUserExistsRequest *const request, ::rpc::BatchUserExistsResponse *const response) -> ::grpc::Status {
+        // Formatted once, rejections only hand out a view of it
+        static const std::string invalid_message = fmt::format("Invalid request: between 1 and {} non-empty usernames are required", MAX_BATCH_SIZE);
 
-        const std::string error_msg = e.what();
-        response->set_error_code(400); // Default error code (Bad request)
+        // Validate request parameters using table-driven validation
+        const auto validation_status = ValidateRequest(request, [](const ::rpc::BatchUserExistsRequest *req) {
+            return req->usernames_size() > 0 && req->usernames_size() <= MAX_BATCH_SIZE && std::ranges::none_of(req->usernames(), [](const std::string_view username) { return username.empty(); });
+        }, invalid_message, response);
+
+        if (validation_status) {
+            return *validation_status;
+        }
 
-        // Use range-based for loop to check for error patterns
-        for (const auto &[pattern, code]: error_map_) {
-            if (error_msg.find(pattern) != std::string::npos) {
-                response->set_error_code(code);
-                break;
+        try {
+            // Views into the request, the usernames are not copied
+            const std::vector<std::string_view> usernames(request->usernames().begin(), request->usernames().end());
+            const auto exists = authenticator_.users_exist(usernames);
+            response->mutable_exists()->Reserve(static_cast<int>(exists.size()));
+            for (const bool user_exists: exists) {
+                response->add_exists(user_exists);
             }
+            response->set_success(true);
+            response->set_message(fmt::format("{} of {} users exist", std::ranges::count(exists, true), exists.size()));
+            return ::grpc::Status::OK;
+        } catch (const std::exception &e) {
+            response->set_success(false);
+            response->set_message(fmt::format("System error: {}", e.what()));
+            response->set_error_code(500);
+            return {::grpc::StatusCode::INTERNAL, e.what()};
         }
+    }
 
+    [[nodiscard]] auto AuthRpcService::HandleBatchRegisterUsers(const ::rpc::BatchRegisterUsersRequest *const request, ::rpc::BatchRegisterUsersResponse *const response) -> ::grpc::Status {
+        // Formatted once, rejections only hand out a view of it
+        static const std::string invalid_message = fmt::format("Invalid request: between 1 and {} users are required", MAX_BATCH_SIZE);
+
+        // Validate request parameters using table-driven validation
+        const auto validation_status = ValidateRequest(request, [](const ::rpc::BatchRegisterUsersRequest *req) {
+            return req->users_size() > 0 && req->users_size() <= MAX_BATCH_SIZE;
+        }, invalid_message, response);
+
+        if (validation_status) {
+            return *validation_status;
+        }
+
+        try {
+            std::vector<std::pair<std::string_view, std::string_view> > users;
+            users.reserve(static_cast<size_t>(request->users_size()));
+            for (const auto &user: request->users()) {
+                users.emplace_back(user.username(), user.password());
+            }
+
+            const auto results = authenticator_.register_users(users);
+            size_t registered = 0;
+            response->mutable_results()->Reserve(static_cast<int>(results.size()));
+            for (const auto &registration: results) {
+                auto *const result = response->add_results();
+                result->set_success(registration.has_value());
+                if (registration) {
+                    result->set_message("User registered successfully");
+                    ++registered;
+                } else {
+                    result->set_message(common::auth::auth_error_message(registration.error()));
+                    result->set_error_code(ErrorCodeFor(registration.error()));
+                }
+            }
+            response->set_success(true);
+            response->set_message(fmt::format("Registered {} of {} users", registered, results.size()));
+            return ::grpc::Status::OK;
+        } catch (const std::exception &e) {
+            response->set_success(false);
+            response->set_message(fmt::format("System error: {}", e.what()));
+            response->set_error_code(500);
+            return {::grpc::StatusCode::INTERNAL, e.what()};
+        }
+    }
+
+    [[nodiscard]] auto AuthRpcService::HandleValidateToken(const ::rpc::ValidateTokenRequest *const request, ::rpc::ValidateTokenResponse *const response) -> ::grpc::Status {
+        // Validate request parameters using table-driven validation
+        const auto validation_status = ValidateRequest(request, [](const ::rpc::ValidateTokenRequest *req) {
+            return !req->session_token().empty();
+        }, "Invalid request: session token is required", response);
+
+        if (validation_status) {
+            return *validation_status;
+        }
+
+        try {
+            const auto claims = authenticator_.validate_session_token(request->session_token());
+            if (!claims) {
+                response->set_success(false);
+                response->set_message("Invalid or expired session token");
+                response->set_error_code(401); // Unauthorized
+                return ::grpc::Status::OK;
+            }
+            response->set_success(true);
+            response->set_message("Session token is valid");
+            response->set_username(claims->username);
+            response->set_session_expires_at_ms(std::chrono::duration_cast<std::chrono::milliseconds>(claims->expires_at.time_since_epoch()).count());
+            return ::grpc::Status::OK;
+        } catch (const std::exception &e) {
+            response->set_success(false);
+            response->set_message(fmt::format("System error: {}", e.what()));
+            response->set_error_code(500);
+            return {::grpc::StatusCode::INTERNAL, e.what()};
+        }
+    }
+
+    [[nodiscard]] auto AuthRpcService::HandleGetServerStats(const ::rpc::GetServerStatsRequest * /*request*/, ::rpc::GetServerStatsResponse *const response) -> ::grpc::Status {
+        try {
+            response->mutable_methods()->Reserve(static_cast<int>(RPC_METHOD_COUNT));
+            for (size_t i = 0; i < RPC_METHOD_COUNT; ++i) {
+                const auto method = static_cast<RpcMethod>(i);
+                const auto admission = admission_.stats(method);
+                auto *const method_stats = response->add_methods();
+                method_stats->set_method(rpcMethodName(method));
+                FillLatencySummary(latency_stats_.snapshot(method, LatencyPhase::Total), method_stats->mutable_total());
+                FillLatencySummary(latency_stats_.snapshot(method, LatencyPhase::Queue), method_stats->mutable_queue());
+                FillLatencySummary(latency_stats_.snapshot(method, LatencyPhase::Database), method_stats->mutable_database());
+                FillLatencySummary(latency_stats_.snapshot(method, LatencyPhase::KeyDerivation), method_stats->mutable_key_derivation());
+                method_stats->set_concurrency_limit(admission.limit);
+                method_stats->set_in_flight(admission.in_flight);
+                method_stats->set_rejected(admission.rejected);
+            }
+
+            auto *const negative_cache = response->mutable_negative_cache();
+            if (const auto cache_stats = authenticator_.negative_cache_stats()) {
+                negative_cache->set_enabled(true);
+                negative_cache->set_hits(cache_stats->hits);
+                negative_cache->set_misses(cache_stats->misses);
+                negative_cache->set_false_positives(cache_stats->false_positives);
+                negative_cache->set_element_count(cache_stats->element_count);
+                negative_cache->set_estimated_false_positive_rate(cache_stats->estimated_false_positive_rate);
+            }
+
+            const auto credential_stats = authenticator_.credential_cache_stats();
+            auto *const credential_cache = response->mutable_credential_cache();
+            credential_cache->set_hits(credential_stats.hits);
+            credential_cache->set_misses(credential_stats.misses);
+            credential_cache->set_hit_ratio(credential_stats.hit_ratio());
+            credential_cache->set_evictions(credential_stats.evictions);
+            credential_cache->set_rejections(credential_stats.rejections);
+            credential_cache->set_entry_count(credential_stats.entry_count);
+            credential_cache->set_memory_bytes(credential_stats.weight);
+            credential_cache->set_budget_bytes(credential_stats.capacity);
+            response->set_success(true);
+            response->set_message("Server statistics collected");
+            return ::grpc::Status::OK;
+        } catch (const std::exception &e) {
+            response->set_success(false);
+            response->set_message(fmt::format("System error: {}", e.what()));
+            response->set_error_code(500);
+            return {::grpc::StatusCode::INTERNAL, e.what()};
+        }
+    }
+
+    auto AuthRpcService::LogServerStats() -> void {
+        const ::rpc::GetServerStatsRequest request;
+        ::rpc::GetServerStatsResponse response;
+        if (!HandleGetServerStats(&request, &response).ok()) {
+            LOG(WARNING) << "Failed to collect server statistics: " << response.message();
+            return;
+        }
+
+        for (const auto &method: response.methods()) {
+            if (method.total().count() == 0 && method.rejected() == 0) {
+                continue;
+            }
+            const auto &total = method.total();
+            LOG(INFO) << fmt::format("RPC stats - {}: calls {}, p50 {}us, p99 {}us, p999 {}us, max {}us, queue p99 {}us, database p99 {}us, key derivation p99 {}us, limit {}, in flight {}, rejected {}", method.method(), total.count(), total.p50_us(), total.p99_us(), total.p999_us(), total.max_us(), method.queue().p99_us(), method.database().p99_us(), method.key_derivation().p99_us(), method.concurrency_limit(), method.in_flight(), method.rejected());
+        }
+
+        if (const auto &cache = response.negative_cache(); cache.enabled()) {
+            LOG(INFO) << fmt::format("Negative cache stats - hits {}, misses {}, false positives {}, users {}, estimated false positive rate {:.4f}", cache.hits(), cache.misses(), cache.false_positives(), cache.element_count(), cache.estimated_false_positive_rate());
+        }
+
+        const auto &credential_cache = response.credential_cache();
+        LOG(INFO) << fmt::format("Credential cache stats - hits {}, misses {}, hit ratio {:.4f}, evictions {}, rejections {}, users {}, memory {} of {} bytes", credential_cache.hits(), credential_cache.misses(), credential_cache.hit_ratio(), credential_cache.evictions(), credential_cache.rejections(), credential_cache.entry_count(), credential_cache.memory_bytes(), credential_cache.budget_bytes());
+    }
+
+    [[nodiscard]] auto AuthRpcService::HandleAuthError(const common::auth::AuthError error, ::rpc::AuthResponse *const response) -> ::grpc::Status {
+        response->set_success(false);
+        response->set_message(common::auth::auth_error_message(error));
+        response->set_error_code(ErrorCodeFor(error));
         return ::grpc::Status::OK;
     }
+
+    [[nodiscard]] auto AuthRpcService::ErrorCodeFor(const common::auth::AuthError error) noexcept -> int {
+        return ERROR_CODES[static_cast<size_t>(error)];
+    }
+
+    auto AuthRpcService::TrySubmitKdf(std::function<void()> task) -> bool {
+        return kdf_executor_.tryExecute(std::move(task));
+    }
+
+    auto AuthRpcService::TryAdmit(const RpcMethod method) noexcept -> std::optional<AdmissionController::Permit> {
+        return admission_.tryAcquire(method);
+    }
+
+    auto AuthRpcService::AdmitQueued(const RpcMethod method, const std::chrono::steady_clock::time_point enqueued_at) noexcept -> bool {
+        return admission_.admitQueued(method, enqueued_at);
+    }
+
+    auto AuthRpcService::RecordLatency(const RpcMethod method, const RpcLatencyStats::CallTiming &timing) noexcept -> void {
+        latency_stats_.record(method, timing);
+    }
+
+    auto AuthRpcService::DrainKdfExecutor() -> void {
+        kdf_executor_.shutdown();
+    }
+
+    template<typename ResponseType>
+    [[nodiscard]] auto AuthRpcService::RunAdmitted(const RpcMethod method, ResponseType *const response, const std::function<::grpc::Status()> &work) -> ::grpc::Status {
+        const auto permit = admission_.tryAcquire(method);
+        if (!permit) {
+            return RejectOverloaded(response);
+        }
+
+        const auto started_at = std::chrono::steady_clock::now();
+        RpcLatencyStats::CallTiming timing;
+        const auto status = RunTimed(work, timing);
+        timing.total = std::chrono::steady_clock::now() - started_at;
+        latency_stats_.record(method, timing);
+        return status;
+    }
+
+    template<typename ResponseType>
+    [[nodiscard]] auto AuthRpcService::RunOnKdfExecutor(const RpcMethod method, ResponseType *const response, const std::function<::grpc::Status()> &work) -> ::grpc::Status {
+        const auto permit = admission_.tryAcquire(method);
+        if (!permit) {
+            return RejectOverloaded(response);
+        }
+
+        const auto started_at = std::chrono::steady_clock::now();
+        RpcLatencyStats::CallTiming timing;
+        auto future = kdf_executor_.trySubmit([this, method, response, &work, &timing, started_at] {
+            timing.queue = std::chrono::steady_clock::now() - started_at;
+            // Shed the call before hashing if its client has most likely given up already
+            if (!admission_.admitQueued(method, started_at)) {
+                return RejectOverloaded(response);
+            }
+            return RunTimed(work, timing);
+        });
+        if (!future.has_value()) {
+            return RejectBusy(response);
+        }
+
+        const auto status = future->get();
+        timing.total = std::chrono::steady_clock::now() - started_at;
+        latency_stats_.record(method, timing);
+        return status;
+    }
 }
@@ -1,21 +1,37 @@
 #pragma once
 #include <src/auth/UserAuthenticator.hpp>
-#include <src/exception/AuthenticationException.hpp>
 
+#include "AdmissionController.hpp"
+#include "RpcLatencyStats.hpp"
 #include "generated/RpcService.grpc.pb.h"
+#include "src/thread/ThreadPool.hpp"
+#include <chrono>
+#include <functional>
+#include <optional>
 #include <string>
-#include <string_view>
-#include <unordered_map>
+#include <utility>
 
 namespace server_app::auth {
     /// @brief RPC service implementation for handling remote procedure calls
     /// @details This class implements the gRPC service interface defined in RpcService.grpc.pb.h
-    /// and provides the actual business logic for handling RPC requests.
+    /// and provides the actual business logic for handling RPC requests. RPCs that derive keys from
+    /// passwords are executed on a dedicated bounded executor; when it is saturated they fail fast with
+    /// RESOURCE_EXHAUSTED, while cheap RPCs such as UserExists and ValidateToken always run inline.
+    /// Every call first passes the admission controller, which rejects it with UNAVAILABLE when its
+    /// method is at its concurrency limit or when it waited too long for a key-derivation worker.
+    /// Admitted calls record their latency, split into queue, database and key derivation time, in
+    /// per-method histograms that GetServerStats and LogServerStats report as percentiles.
     class AuthRpcService final : public rpc::AuthService::Service {
     public:
-        /// @brief Constructor with database path
+        /// @brief Constructor with database path and key-derivation executor sizing
         /// @param db_path Path to SQLite database file
-        explicit AuthRpcService(const std::string &db_path) noexcept;
+        /// @param sqlite_options Connection pragmas and reader pool configuration
+        /// @param authenticator_options Negative lookup cache, key derivation and session token configuration
+        /// @param kdf_worker_threads Number of threads dedicated to password hashing
+        /// @param kdf_queue_size Maximum number of pending password hashing requests
+        /// @param admission_limits Per-method concurrency caps and queueing thresholds
+        /// @throws std::invalid_argument if the executor sizing is invalid
+        explicit AuthRpcService(const std::string &db_path, const common::sql::sqlite::SQLiteOptions &sqlite_options = common::sql::sqlite::SQLiteOptions(), const common::auth::UserAuthenticatorOptions &authenticator_options = common::auth::UserAuthenticatorOptions(), size_t kdf_worker_threads = 4, size_t kdf_queue_size = 256, const AdmissionController::Limits &admission_limits = AdmissionController::Limits());
 
         /// @brief Default destructor
         ~AuthRpcService() noexcept override = default;
@@ -50,17 +66,168 @@ namespace server_app::auth {
         /// @brief Check if user exists
         [[nodiscard]] auto UserExists(::grpc::ServerContext *context, const ::rpc::UserExistsRequest *request, ::rpc::AuthResponse *response) -> ::grpc::Status override;
 
+        /// @brief Check which of several users exist
+        [[nodiscard]] auto BatchUserExists(::grpc::ServerContext *context, const ::rpc::BatchUserExistsRequest *request, ::rpc::BatchUserExistsResponse *response) -> ::grpc::Status override;
+
+        /// @brief Register several user accounts in one transaction
+        [[nodiscard]] auto BatchRegisterUsers(::grpc::ServerContext *context, const ::rpc::BatchRegisterUsersRequest *request, ::rpc::BatchRegisterUsersResponse *response) -> ::grpc::Status override;
+
+        /// @brief Authenticate a stream of credentials
+        /// @details Up to STREAM_PIPELINE_DEPTH requests of the stream are hashed concurrently on the
+        /// key-derivation executor; responses are still written in request order. A saturated executor
+        /// rejects the affected request with error code 429 and keeps the stream open.
+        [[nodiscard]] auto AuthenticateStream(::grpc::ServerContext *context, ::grpc::ServerReaderWriter<::rpc::AuthResponse, ::rpc::AuthenticateUserRequest> *stream) -> ::grpc::Status override;
+
+        /// @brief Validate a session token issued by AuthenticateUser
+        [[nodiscard]] auto ValidateToken(::grpc::ServerContext *context, const ::rpc::ValidateTokenRequest *request, ::rpc::ValidateTokenResponse *response) -> ::grpc::Status override;
+
+        /// @brief Report latency percentiles, admission state and negative lookup cache counters
+        [[nodiscard]] auto GetServerStats(::grpc::ServerContext *context, const ::rpc::GetServerStatsRequest *request, ::rpc::GetServerStatsResponse *response) -> ::grpc::Status override;
+
+        /// @brief Register new user account on the calling thread
+        [[nodiscard]] auto HandleRegisterUser(const ::rpc::RegisterUserRequest *request, ::rpc::AuthResponse *response) -> ::grpc::Status;
+
+        /// @brief Authenticate user credentials on the calling thread
+        [[nodiscard]] auto HandleAuthenticateUser(const ::rpc::AuthenticateUserRequest *request, ::rpc::AuthResponse *response) -> ::grpc::Status;
+
+        /// @brief Change user password on the calling thread
+        [[nodiscard]] auto HandleChangePassword(const ::rpc::ChangePasswordRequest *request, ::rpc::AuthResponse *response) -> ::grpc::Status;
+
+        /// @brief Reset user password on the calling thread
+        [[nodiscard]] auto HandleResetPassword(const ::rpc::ResetPasswordRequest *request, ::rpc::AuthResponse *response) -> ::grpc::Status;
+
+        /// @brief Delete user account on the calling thread
+        [[nodiscard]] auto HandleDeleteUser(const ::rpc::DeleteUserRequest *request, ::rpc::AuthResponse *response) -> ::grpc::Status;
+
+        /// @brief Check if user exists on the calling thread
+        [[nodiscard]] auto HandleUserExists(const ::rpc::UserExistsRequest *request, ::rpc::AuthResponse *response) -> ::grpc::Status;
+
+        /// @brief Check which of several users exist on the calling thread
+        [[nodiscard]] auto HandleBatchUserExists(const ::rpc::BatchUserExistsRequest *request, ::rpc::BatchUserExistsResponse *response) -> ::grpc::Status;
+
+        /// @brief Register several user accounts on the calling thread
+        [[nodiscard]] auto HandleBatchRegisterUsers(const ::rpc::BatchRegisterUsersRequest *request, ::rpc::BatchRegisterUsersResponse *response) -> ::grpc::Status;
+
+        /// @brief Validate a session token on the calling thread
+        [[nodiscard]] auto HandleValidateToken(const ::rpc::ValidateTokenRequest *request, ::rpc::ValidateTokenResponse *response) -> ::grpc::Status;
+
+        /// @brief Collect server statistics on the calling thread
+        [[nodiscard]] auto HandleGetServerStats(const ::rpc::GetServerStatsRequest *request, ::rpc::GetServerStatsResponse *response) -> ::grpc::Status;
+
+        /// @brief Write the latency percentiles and admission state of every called method to the log
+        /// @details Driven periodically by the server task; methods without calls are skipped.
+        auto LogServerStats() -> void;
+
+        /// @brief Record the latency of a finished call
+        /// @param method Method of the call
+        /// @param timing Latency split of the call
+        auto RecordLatency(RpcMethod method, const RpcLatencyStats::CallTiming &timing) noexcept -> void;
+
+        /// @brief Queue work on the key-derivation executor without waiting for it
+        /// @param task Work to run on a key-derivation worker, which must handle its own exceptions
+        /// @return true if the task was queued, false if the executor is saturated or stopped
+        /// @details No future is created; a task capturing a single pointer is queued without allocating.
+        [[nodiscard]] auto TrySubmitKdf(std::function<void()> task) -> bool;
+
+        /// @brief Admit a call if its method is below its concurrency limit
+        /// @param method Method of the call
+        /// @return Permit to hold until the call finished, nullopt if the call must be rejected
+        [[nodiscard]] auto TryAdmit(RpcMethod method) noexcept -> std::optional<AdmissionController::Permit>;
+
+        /// @brief Check a call leaving the key-derivation queue against the queue timeout
+        /// @param method Method of the call
+        /// @param enqueued_at Time the call was queued
+        /// @return true if the call may proceed, false if it must be rejected before hashing
+        [[nodiscard]] auto AdmitQueued(RpcMethod method, std::chrono::steady_clock::time_point enqueued_at) noexcept -> bool;
+
+        /// @brief Finish all queued key-derivation work and stop the executor
+        /// @details Called during shutdown after the gRPC server stopped accepting calls.
+        auto DrainKdfExecutor() -> void;
+
+        /// @brief Run a handler on the calling thread and collect the database and key derivation time it spent
+        /// @tparam Work Callable returning the handler status
+        /// @param work Handler invocation
+        /// @param timing Receives the phase durations of the handler
+        /// @return Status produced by the handler
+        template<typename Work>
+        [[nodiscard]] static auto RunTimed(Work &&work, RpcLatencyStats::CallTiming &timing) -> ::grpc::Status {
+            common::time::clearRequestPhases();
+            auto status = std::forward<Work>(work)();
+            timing.phases = common::time::takeRequestPhases();
+            return status;
+        }
+
+        /// @brief Populate a response rejected because the key-derivation executor is saturated
+        /// @tparam ResponseType Response message type carrying success, message and error code
+        /// @param response Response to populate with error details
+        /// @return RESOURCE_EXHAUSTED status
+        template<typename ResponseType>
+        [[nodiscard]] static auto RejectBusy(ResponseType *response) noexcept -> ::grpc::Status {
+            response->set_success(false);
+            response->set_message("Server is busy, please retry later");
+            response->set_error_code(429); // Too many requests
+            return {::grpc::StatusCode::RESOURCE_EXHAUSTED, "Key derivation queue is full"};
+        }
+
+        /// @brief Populate a response rejected by the admission controller
+        /// @tparam ResponseType Response message type carrying success, message and error code
+        /// @param response Response to populate with error details
+        /// @return UNAVAILABLE status
+        template<typename ResponseType>
+        [[nodiscard]] static auto RejectOverloaded(ResponseType *response) noexcept -> ::grpc::Status {
+            response->set_success(false);
+            response->set_message("Server is overloaded, please retry later");
+            response->set_error_code(503); // Service unavailable
+            return {::grpc::StatusCode::UNAVAILABLE, "Admission limit reached"};
+        }
+
     private:
+        /// @brief Maximum number of entries accepted by a batch RPC
+        static constexpr int MAX_BATCH_SIZE = 1000;
+
+        /// @brief Maximum number of requests of one AuthenticateStream call hashed concurrently
+        static constexpr size_t STREAM_PIPELINE_DEPTH = 8;
+
         /// @brief Authenticator instance for managing user accounts
         common::auth::UserAuthenticator authenticator_;
 
-        /// @brief Map exception types to error codes using table-driven approach
-        static const std::unordered_map<std::string_view, int> error_map_;
+        /// @brief Bounded executor running password hashing off the RPC threads
+        common::thread::ThreadPool kdf_executor_;
+
+        /// @brief Per-method concurrency limits and queue-time load shedding
+        AdmissionController admission_;
+
+        /// @brief Per-method latency histograms
+        RpcLatencyStats latency_stats_;
 
-        /// @brief Convert AuthenticationException to grpc::Status
-        /// @param e AuthenticationException to handle
+        /// @brief Populate a response for a rejected operation
+        /// @param error Reason the authenticator rejected the operation
         /// @param response Response to populate with error details
-        /// @return Appropriate gRPC status
-        [[nodiscard]] static auto HandleAuthException(const common::exception::AuthenticationException &e, ::rpc::AuthResponse *response) noexcept -> ::grpc::Status;
+        /// @return OK status, the rejection is reported in the response
+        [[nodiscard]] static auto HandleAuthError(common::auth::AuthError error, ::rpc::AuthResponse *response) -> ::grpc::Status;
+
+        /// @brief Map an authentication error to an error code
+        /// @param error Error to classify
+        /// @return Error code from the ERROR_CODES table
+        [[nodiscard]] static auto ErrorCodeFor(common::auth::AuthError error) noexcept -> int;
+
+        /// @brief Run work on the calling thread once admitted
+        /// @tparam ResponseType Response message type carrying success, message and error code
+        /// @param method Method of the call
+        /// @param response Response populated on rejection
+        /// @param work Handler invocation
+        /// @return Status produced by the work, or UNAVAILABLE if the call was not admitted
+        template<typename ResponseType>
+        [[nodiscard]] auto RunAdmitted(RpcMethod method, ResponseType *response, const std::function<::grpc::Status()> &work) -> ::grpc::Status;
+
+        /// @brief Run work on the key-derivation executor once admitted and wait for its status
+        /// @tparam ResponseType Response message type carrying success, message and error code
+        /// @param method Method of the call
+        /// @param response Response populated on rejection
+        /// @param work Handler invocation to run on a key-derivation worker
+        /// @return Status produced by the work, RESOURCE_EXHAUSTED if it could not be queued, or
+        /// UNAVAILABLE if it was not admitted or queued longer than the queue timeout
+        template<typename ResponseType>
+        [[nodiscard]] auto RunOnKdfExecutor(RpcMethod method, ResponseType *response, const std::function<::grpc::Status()> &work) -> ::grpc::Status;
     };
 }
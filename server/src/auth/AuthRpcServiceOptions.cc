@@ -1,17 +1,21 @@
 #include "AuthRpcServiceOptions.hpp"
 
+#include <algorithm>
 #include <functional>
+#include <map>
+#include <thread>
 #include <utility>
 #include <yaml-cpp/yaml.h>
 #include <glog/logging.h>
 #include <fmt/format.h>
 #include "src/filesystem/type/YamlToolkit.hpp"
+#include "AdmissionController.hpp"
 
 namespace app_server::auth {
     AuthRpcServiceOptions::AuthRpcServiceOptions() = default;
 
-    AuthRpcServiceOptions::AuthRpcServiceOptions(const int32_t max_connection_idle_ms, const int32_t max_connection_age_ms, const int32_t max_connection_age_grace_ms, const int32_t keepalive_time_ms, const int32_t keepalive_timeout_ms, const int32_t keepalive_permit_without_calls, std::string server_address) : max_connection_idle_ms_(max_connection_idle_ms), max_connection_age_ms_(max_connection_age_ms), max_connection_age_grace_ms_(max_connection_age_grace_ms), keepalive_time_ms_(keepalive_time_ms), keepalive_timeout_ms_(keepalive_timeout_ms),
-                                                                                                                                                                                                                                                                                                                        keepalive_permit_without_calls_(keepalive_permit_without_calls), server_address_(std::move(server_address)) {
+    AuthRpcServiceOptions::AuthRpcServiceOptions(const int32_t max_connection_idle_ms, const int32_t max_connection_age_ms, const int32_t max_connection_age_grace_ms, const int32_t keepalive_time_ms, const int32_t keepalive_timeout_ms, const int32_t keepalive_permit_without_calls, std::string server_address, std::string server_mode, const int32_t completion_queue_count, const int32_t poller_threads_per_queue, const int32_t kdf_worker_threads, const int32_t kdf_queue_size, const int32_t admission_max_concurrency, std::map<std::string, int32_t> admission_method_limits, const int32_t admission_queue_timeout_ms, const int32_t admission_target_queue_delay_ms, const int32_t stats_dump_interval_sec) : max_connection_idle_ms_(max_connection_idle_ms), max_connection_age_ms_(max_connection_age_ms), max_connection_age_grace_ms_(max_connection_age_grace_ms), keepalive_time_ms_(keepalive_time_ms), keepalive_timeout_ms_(keepalive_timeout_ms),
+                                                                                                                                                                                                                                                                                                                        keepalive_permit_without_calls_(keepalive_permit_without_calls), server_address_(std::move(server_address)), server_mode_(std::move(server_mode)), completion_queue_count_(completion_queue_count), poller_threads_per_queue_(poller_threads_per_queue), kdf_worker_threads_(kdf_worker_threads), kdf_queue_size_(kdf_queue_size), admission_max_concurrency_(admission_max_concurrency), admission_method_limits_(std::move(admission_method_limits)), admission_queue_timeout_ms_(admission_queue_timeout_ms), admission_target_queue_delay_ms_(admission_target_queue_delay_ms), stats_dump_interval_sec_(stats_dump_interval_sec) {
         validateParameters();
     }
 
@@ -72,6 +76,99 @@ namespace app_server::auth {
         server_address_ = value;
     }
 
+    auto AuthRpcServiceOptions::serverMode() const noexcept -> const std::string & {
+        return server_mode_;
+    }
+
+    auto AuthRpcServiceOptions::serverMode(const std::string &value) -> void {
+        server_mode_ = value;
+    }
+
+    auto AuthRpcServiceOptions::completionQueueCount() const noexcept -> int32_t {
+        return completion_queue_count_;
+    }
+
+    auto AuthRpcServiceOptions::completionQueueCount(const int32_t value) noexcept -> void {
+        completion_queue_count_ = value;
+    }
+
+    auto AuthRpcServiceOptions::pollerThreadsPerQueue() const noexcept -> int32_t {
+        return poller_threads_per_queue_;
+    }
+
+    auto AuthRpcServiceOptions::pollerThreadsPerQueue(const int32_t value) noexcept -> void {
+        poller_threads_per_queue_ = value;
+    }
+
+    auto AuthRpcServiceOptions::kdfWorkerThreads() const noexcept -> int32_t {
+        return kdf_worker_threads_;
+    }
+
+    auto AuthRpcServiceOptions::kdfWorkerThreads(const int32_t value) noexcept -> void {
+        kdf_worker_threads_ = value;
+    }
+
+    auto AuthRpcServiceOptions::kdfQueueSize() const noexcept -> int32_t {
+        return kdf_queue_size_;
+    }
+
+    auto AuthRpcServiceOptions::kdfQueueSize(const int32_t value) noexcept -> void {
+        kdf_queue_size_ = value;
+    }
+
+    auto AuthRpcServiceOptions::admissionMaxConcurrency() const noexcept -> int32_t {
+        return admission_max_concurrency_;
+    }
+
+    auto AuthRpcServiceOptions::admissionMaxConcurrency(const int32_t value) noexcept -> void {
+        admission_max_concurrency_ = value;
+    }
+
+    auto AuthRpcServiceOptions::admissionMethodLimits() const noexcept -> const std::map<std::string, int32_t> & {
+        return admission_method_limits_;
+    }
+
+    auto AuthRpcServiceOptions::admissionMethodLimits(const std::map<std::string, int32_t> &value) -> void {
+        admission_method_limits_ = value;
+    }
+
+    auto AuthRpcServiceOptions::admissionQueueTimeoutMs() const noexcept -> int32_t {
+        return admission_queue_timeout_ms_;
+    }
+
+    auto AuthRpcServiceOptions::admissionQueueTimeoutMs(const int32_t value) noexcept -> void {
+        admission_queue_timeout_ms_ = value;
+    }
+
+    auto AuthRpcServiceOptions::admissionTargetQueueDelayMs() const noexcept -> int32_t {
+        return admission_target_queue_delay_ms_;
+    }
+
+    auto AuthRpcServiceOptions::admissionTargetQueueDelayMs(const int32_t value) noexcept -> void {
+        admission_target_queue_delay_ms_ = value;
+    }
+
+    auto AuthRpcServiceOptions::statsDumpIntervalSec() const noexcept -> int32_t {
+        return stats_dump_interval_sec_;
+    }
+
+    auto AuthRpcServiceOptions::statsDumpIntervalSec(const int32_t value) noexcept -> void {
+        stats_dump_interval_sec_ = value;
+    }
+
+    auto AuthRpcServiceOptions::admissionLimitFor(const std::string &method_name) const -> int32_t {
+        const auto it = admission_method_limits_.find(method_name);
+        return it != admission_method_limits_.end() ? it->second : admission_max_concurrency_;
+    }
+
+    auto AuthRpcServiceOptions::isAsyncMode() const noexcept -> bool {
+        return server_mode_ == "async";
+    }
+
+    auto AuthRpcServiceOptions::isCallbackMode() const noexcept -> bool {
+        return server_mode_ == "callback";
+    }
+
     auto AuthRpcServiceOptions::deserializedFromYamlFile(const std::filesystem::path &path) -> void {
         if (!std::filesystem::exists(path)) {
             const std::string error_msg = fmt::format("Configuration file does not exist: {}", path.string());
@@ -86,7 +183,10 @@ namespace app_server::auth {
             // Table-driven configuration loading for gRPC parameters
             const std::vector<std::pair<std::string, std::function<void()> > > config_handlers = {
                 {"maxConnectionIdleMs", [&]() { max_connection_idle_ms_ = grpcNode["maxConnectionIdleMs"].as<int32_t>(); }}, {"maxConnectionAgeMs", [&]() { max_connection_age_ms_ = grpcNode["maxConnectionAgeMs"].as<int32_t>(); }}, {"maxConnectionAgeGraceMs", [&]() { max_connection_age_grace_ms_ = grpcNode["maxConnectionAgeGraceMs"].as<int32_t>(); }}, {"keepaliveTimeMs", [&]() { keepalive_time_ms_ = grpcNode["keepaliveTimeMs"].as<int32_t>(); }}, {"keepaliveTimeoutMs", [&]() { keepalive_timeout_ms_ = grpcNode["keepaliveTimeoutMs"].as<int32_t>(); }},
-                {"keepalivePermitWithoutCalls", [&]() { keepalive_permit_without_calls_ = grpcNode["keepalivePermitWithoutCalls"].as<int32_t>(); }}, {"serverAddress", [&]() { server_address_ = grpcNode["serverAddress"].as<std::string>(); }}
+                {"keepalivePermitWithoutCalls", [&]() { keepalive_permit_without_calls_ = grpcNode["keepalivePermitWithoutCalls"].as<int32_t>(); }}, {"serverAddress", [&]() { server_address_ = grpcNode["serverAddress"].as<std::string>(); }},
+                {"serverMode", [&]() { server_mode_ = grpcNode["serverMode"].as<std::string>(); }}, {"completionQueueCount", [&]() { completion_queue_count_ = grpcNode["completionQueueCount"].as<int32_t>(); }}, {"pollerThreadsPerQueue", [&]() { poller_threads_per_queue_ = grpcNode["pollerThreadsPerQueue"].as<int32_t>(); }}, {"kdfWorkerThreads", [&]() { kdf_worker_threads_ = grpcNode["kdfWorkerThreads"].as<int32_t>(); }}, {"kdfQueueSize", [&]() { kdf_queue_size_ = grpcNode["kdfQueueSize"].as<int32_t>(); }},
+                {"admissionMaxConcurrency", [&]() { admission_max_concurrency_ = grpcNode["admissionMaxConcurrency"].as<int32_t>(); }}, {"admissionMethodLimits", [&]() { admission_method_limits_ = grpcNode["admissionMethodLimits"].as<std::map<std::string, int32_t> >(); }}, {"admissionQueueTimeoutMs", [&]() { admission_queue_timeout_ms_ = grpcNode["admissionQueueTimeoutMs"].as<int32_t>(); }},
+                {"admissionTargetQueueDelayMs", [&]() { admission_target_queue_delay_ms_ = grpcNode["admissionTargetQueueDelayMs"].as<int32_t>(); }}, {"statsDumpIntervalSec", [&]() { stats_dump_interval_sec_ = grpcNode["statsDumpIntervalSec"].as<int32_t>(); }}
             };
 
             for (const auto &[key, handler]: config_handlers) {
@@ -112,7 +212,14 @@ namespace app_server::auth {
         const std::vector<std::tuple<bool, std::string, const char *> > numeric_validations = {
             std::make_tuple(max_connection_idle_ms_ <= 0, fmt::format("Invalid max connection idle time: {}ms. Value must be greater than 0.", max_connection_idle_ms_), "max_connection_idle_ms_"), std::make_tuple(max_connection_age_ms_ <= 0, fmt::format("Invalid max connection age: {}ms. Value must be greater than 0.", max_connection_age_ms_), "max_connection_age_ms_"), std::make_tuple(max_connection_age_grace_ms_ < 0, fmt::format("Invalid max connection age grace period: {}ms. Value must be greater than or equal to 0.", max_connection_age_grace_ms_), "max_connection_age_grace_ms_"),
             std::make_tuple(keepalive_time_ms_ <= 0, fmt::format("Invalid keepalive time: {}ms. Value must be greater than 0.", keepalive_time_ms_), "keepalive_time_ms_"), std::make_tuple(keepalive_timeout_ms_ <= 0, fmt::format("Invalid keepalive timeout: {}ms. Value must be greater than 0.", keepalive_timeout_ms_), "keepalive_timeout_ms_"), std::make_tuple(keepalive_permit_without_calls_ != 0 && keepalive_permit_without_calls_ != 1, fmt::format("Invalid keepalive permit without calls: {}. Valid values are 0 or 1.", keepalive_permit_without_calls_), "keepalive_permit_without_calls_"),
-            std::make_tuple(server_address_.empty(), fmt::format("Server address is empty."), "server_address_")
+            std::make_tuple(server_address_.empty(), fmt::format("Server address is empty."), "server_address_"), std::make_tuple(server_mode_ != "sync" && server_mode_ != "async" && server_mode_ != "callback", fmt::format("Invalid server mode: '{}'. Valid values are 'sync', 'async' or 'callback'.", server_mode_), "server_mode_"),
+            std::make_tuple(completion_queue_count_ <= 0, fmt::format("Invalid completion queue count: {}. Value must be greater than 0.", completion_queue_count_), "completion_queue_count_"), std::make_tuple(poller_threads_per_queue_ <= 0, fmt::format("Invalid poller threads per queue: {}. Value must be greater than 0.", poller_threads_per_queue_), "poller_threads_per_queue_"),
+            std::make_tuple(kdf_worker_threads_ <= 0, fmt::format("Invalid KDF worker threads: {}. Value must be greater than 0.", kdf_worker_threads_), "kdf_worker_threads_"),
+            std::make_tuple(kdf_queue_size_ <= 0, fmt::format("Invalid KDF queue size: {}. Value must be greater than 0.", kdf_queue_size_), "kdf_queue_size_"),
+            std::make_tuple(admission_max_concurrency_ < 0, fmt::format("Invalid admission max concurrency: {}. Value must be greater than or equal to 0.", admission_max_concurrency_), "admission_max_concurrency_"),
+            std::make_tuple(admission_queue_timeout_ms_ < 0, fmt::format("Invalid admission queue timeout: {}ms. Value must be greater than or equal to 0.", admission_queue_timeout_ms_), "admission_queue_timeout_ms_"),
+            std::make_tuple(admission_target_queue_delay_ms_ < 0, fmt::format("Invalid admission target queue delay: {}ms. Value must be greater than or equal to 0.", admission_target_queue_delay_ms_), "admission_target_queue_delay_ms_"),
+            std::make_tuple(stats_dump_interval_sec_ < 0, fmt::format("Invalid stats dump interval: {}s. Value must be greater than or equal to 0.", stats_dump_interval_sec_), "stats_dump_interval_sec_")
         };
 
         // Execute numeric validations
@@ -123,10 +230,23 @@ namespace app_server::auth {
             }
         }
 
+        // Every per-method limit must name an AuthService method and be non-negative
+        for (const auto &[method_name, limit]: admission_method_limits_) {
+            if (!server_app::auth::rpcMethodFromName(method_name) || limit < 0) {
+                const std::string error_message = fmt::format("Invalid admission method limit '{}: {}'. Keys must be AuthService method names and values must be greater than or equal to 0.", method_name, limit);
+                LOG(ERROR) << error_message;
+                throw std::invalid_argument(error_message);
+            }
+        }
+
         // Table-driven validation for warning conditions
         const std::vector<std::tuple<bool, std::string> > warning_checks = {
             std::make_tuple(max_connection_idle_ms_ > 0 && max_connection_idle_ms_ < 1000, fmt::format("Max connection idle time is set to a very short interval ({}ms). This may cause excessive connection churn.", max_connection_idle_ms_)), std::make_tuple(keepalive_time_ms_ > 0 && keepalive_time_ms_ < 1000, fmt::format("Keepalive time is set to a very short interval ({}ms). This may cause excessive network traffic.", keepalive_time_ms_)),
-            std::make_tuple(keepalive_timeout_ms_ > 0 && keepalive_timeout_ms_ > keepalive_time_ms_, fmt::format("Keepalive timeout ({}ms) is greater than keepalive time ({}ms). This may lead to unexpected connection issues.", keepalive_timeout_ms_, keepalive_time_ms_)), std::make_tuple(max_connection_age_ms_ > 0 && max_connection_idle_ms_ > 0 && max_connection_age_ms_ < max_connection_idle_ms_, fmt::format("Max connection age ({}ms) is less than max connection idle time ({}ms). This may lead to unexpected connection behavior.", max_connection_age_ms_, max_connection_idle_ms_))
+            std::make_tuple(keepalive_timeout_ms_ > 0 && keepalive_timeout_ms_ > keepalive_time_ms_, fmt::format("Keepalive timeout ({}ms) is greater than keepalive time ({}ms). This may lead to unexpected connection issues.", keepalive_timeout_ms_, keepalive_time_ms_)), std::make_tuple(max_connection_age_ms_ > 0 && max_connection_idle_ms_ > 0 && max_connection_age_ms_ < max_connection_idle_ms_, fmt::format("Max connection age ({}ms) is less than max connection idle time ({}ms). This may lead to unexpected connection behavior.", max_connection_age_ms_, max_connection_idle_ms_)),
+            std::make_tuple(static_cast<uint32_t>(completion_queue_count_) * static_cast<uint32_t>(poller_threads_per_queue_) > 4 * std::max(1u, std::thread::hardware_concurrency()), fmt::format("Completion queues ({}) x pollers per queue ({}) greatly exceeds the number of hardware threads ({}). Extra pollers only add contention.", completion_queue_count_, poller_threads_per_queue_, std::thread::hardware_concurrency())),
+            std::make_tuple(static_cast<uint32_t>(kdf_worker_threads_) > std::max(1u, std::thread::hardware_concurrency()), fmt::format("KDF worker threads ({}) exceed the number of hardware threads ({}). Key derivation is CPU bound, extra workers only add latency.", kdf_worker_threads_, std::thread::hardware_concurrency())),
+            std::make_tuple(admission_queue_timeout_ms_ > 0 && admission_target_queue_delay_ms_ >= admission_queue_timeout_ms_, fmt::format("Admission target queue delay ({}ms) is not below the queue timeout ({}ms). Calls will be shed before the adaptive limit reacts.", admission_target_queue_delay_ms_, admission_queue_timeout_ms_)),
+            std::make_tuple(admission_target_queue_delay_ms_ > 0 && admission_max_concurrency_ == 0 && std::ranges::none_of(admission_method_limits_, [](const auto &entry) { return entry.second > 0; }), fmt::format("Admission target queue delay is set ({}ms) but no method has a concurrency cap. The adaptive limit has nothing to adjust.", admission_target_queue_delay_ms_))
         };
 
         // Execute warning checks
@@ -172,8 +292,58 @@ namespace app_server::auth {
         return *this;
     }
 
+    auto AuthRpcServiceOptions::Builder::serverMode(const std::string &value) -> Builder & {
+        server_mode_ = value;
+        return *this;
+    }
+
+    auto AuthRpcServiceOptions::Builder::completionQueueCount(const int32_t value) noexcept -> Builder & {
+        completion_queue_count_ = value;
+        return *this;
+    }
+
+    auto AuthRpcServiceOptions::Builder::pollerThreadsPerQueue(const int32_t value) noexcept -> Builder & {
+        poller_threads_per_queue_ = value;
+        return *this;
+    }
+
+    auto AuthRpcServiceOptions::Builder::kdfWorkerThreads(const int32_t value) noexcept -> Builder & {
+        kdf_worker_threads_ = value;
+        return *this;
+    }
+
+    auto AuthRpcServiceOptions::Builder::kdfQueueSize(const int32_t value) noexcept -> Builder & {
+        kdf_queue_size_ = value;
+        return *this;
+    }
+
+    auto AuthRpcServiceOptions::Builder::admissionMaxConcurrency(const int32_t value) noexcept -> Builder & {
+        admission_max_concurrency_ = value;
+        return *this;
+    }
+
+    auto AuthRpcServiceOptions::Builder::admissionMethodLimits(const std::map<std::string, int32_t> &value) -> Builder & {
+        admission_method_limits_ = value;
+        return *this;
+    }
+
+    auto AuthRpcServiceOptions::Builder::admissionQueueTimeoutMs(const int32_t value) noexcept -> Builder & {
+        admission_queue_timeout_ms_ = value;
+        return *this;
+    }
+
+    auto AuthRpcServiceOptions::Builder::admissionTargetQueueDelayMs(const int32_t value) noexcept -> Builder & {
+        admission_target_queue_delay_ms_ = value;
+        return *this;
+    }
+
+    auto AuthRpcServiceOptions::Builder::statsDumpIntervalSec(const int32_t value) noexcept -> Builder & {
+        stats_dump_interval_sec_ = value;
+        return *this;
+    }
+
     auto AuthRpcServiceOptions::Builder::build() const -> AuthRpcServiceOptions {
-        AuthRpcServiceOptions options{max_connection_idle_ms_, max_connection_age_ms_, max_connection_age_grace_ms_, keepalive_time_ms_, keepalive_timeout_ms_, keepalive_permit_without_calls_, server_address_};
+        AuthRpcServiceOptions options{max_connection_idle_ms_, max_connection_age_ms_, max_connection_age_grace_ms_, keepalive_time_ms_, keepalive_timeout_ms_, keepalive_permit_without_calls_, server_address_, server_mode_, completion_queue_count_, poller_threads_per_queue_, kdf_worker_threads_, kdf_queue_size_, admission_max_concurrency_, admission_method_limits_, admission_queue_timeout_ms_, admission_target_queue_delay_ms_, stats_dump_interval_sec_};
         options.validateParameters();
         return options;
     }
@@ -186,7 +356,10 @@ namespace app_server::auth {
 auto YAML::convert<app_server::auth::AuthRpcServiceOptions>::decode(const Node &node, app_server::auth::AuthRpcServiceOptions &rhs) -> bool {
     const std::vector<std::pair<std::string, std::function<void()> > > config_handlers = {
         {"maxConnectionIdleMs", [&]() { rhs.maxConnectionIdleMs(node["maxConnectionIdleMs"].as<int32_t>()); }}, {"maxConnectionAgeMs", [&]() { rhs.maxConnectionAgeMs(node["maxConnectionAgeMs"].as<int32_t>()); }}, {"maxConnectionAgeGraceMs", [&]() { rhs.maxConnectionAgeGraceMs(node["maxConnectionAgeGraceMs"].as<int32_t>()); }}, {"keepaliveTimeMs", [&]() { rhs.keepaliveTimeMs(node["keepaliveTimeMs"].as<int32_t>()); }}, {"keepaliveTimeoutMs", [&]() { rhs.keepaliveTimeoutMs(node["keepaliveTimeoutMs"].as<int32_t>()); }},
-        {"keepalivePermitWithoutCalls", [&]() { rhs.keepalivePermitWithoutCalls(node["keepalivePermitWithoutCalls"].as<int32_t>()); }}, {"serverAddress", [&]() { rhs.serverAddress(node["serverAddress"].as<std::string>()); }}
+        {"keepalivePermitWithoutCalls", [&]() { rhs.keepalivePermitWithoutCalls(node["keepalivePermitWithoutCalls"].as<int32_t>()); }}, {"serverAddress", [&]() { rhs.serverAddress(node["serverAddress"].as<std::string>()); }},
+        {"serverMode", [&]() { rhs.serverMode(node["serverMode"].as<std::string>()); }}, {"completionQueueCount", [&]() { rhs.completionQueueCount(node["completionQueueCount"].as<int32_t>()); }}, {"pollerThreadsPerQueue", [&]() { rhs.pollerThreadsPerQueue(node["pollerThreadsPerQueue"].as<int32_t>()); }}, {"kdfWorkerThreads", [&]() { rhs.kdfWorkerThreads(node["kdfWorkerThreads"].as<int32_t>()); }}, {"kdfQueueSize", [&]() { rhs.kdfQueueSize(node["kdfQueueSize"].as<int32_t>()); }},
+        {"admissionMaxConcurrency", [&]() { rhs.admissionMaxConcurrency(node["admissionMaxConcurrency"].as<int32_t>()); }}, {"admissionMethodLimits", [&]() { rhs.admissionMethodLimits(node["admissionMethodLimits"].as<std::map<std::string, int32_t> >()); }}, {"admissionQueueTimeoutMs", [&]() { rhs.admissionQueueTimeoutMs(node["admissionQueueTimeoutMs"].as<int32_t>()); }},
+        {"admissionTargetQueueDelayMs", [&]() { rhs.admissionTargetQueueDelayMs(node["admissionTargetQueueDelayMs"].as<int32_t>()); }}, {"statsDumpIntervalSec", [&]() { rhs.statsDumpIntervalSec(node["statsDumpIntervalSec"].as<int32_t>()); }}
     };
 
     for (const auto &[key, handler]: config_handlers) {
@@ -206,5 +379,15 @@ auto YAML::convert<app_server::auth::AuthRpcServiceOptions>::encode(const app_se
     node["keepaliveTimeoutMs"] = rhs.keepaliveTimeoutMs();
     node["keepalivePermitWithoutCalls"] = rhs.keepalivePermitWithoutCalls();
     node["serverAddress"] = rhs.serverAddress();
+    node["serverMode"] = rhs.serverMode();
+    node["completionQueueCount"] = rhs.completionQueueCount();
+    node["pollerThreadsPerQueue"] = rhs.pollerThreadsPerQueue();
+    node["kdfWorkerThreads"] = rhs.kdfWorkerThreads();
+    node["kdfQueueSize"] = rhs.kdfQueueSize();
+    node["admissionMaxConcurrency"] = rhs.admissionMaxConcurrency();
+    node["admissionMethodLimits"] = rhs.admissionMethodLimits();
+    node["admissionQueueTimeoutMs"] = rhs.admissionQueueTimeoutMs();
+    node["admissionTargetQueueDelayMs"] = rhs.admissionTargetQueueDelayMs();
+    node["statsDumpIntervalSec"] = rhs.statsDumpIntervalSec();
     return node;
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include <filesystem>
+#include <map>
 #include <string>
 #include <yaml-cpp/node/node.h>
 
@@ -21,6 +22,16 @@ namespace app_server::auth {
     ///     .keepaliveTimeoutMs(5000)
     ///     .keepalivePermitWithoutCalls(1)
     ///     .serverAddress("0.0.0.0:50051")
+    ///     .serverMode("async")
+    ///     .completionQueueCount(4)
+    ///     .pollerThreadsPerQueue(2)
+    ///     .kdfWorkerThreads(4)
+    ///     .kdfQueueSize(256)
+    ///     .admissionMaxConcurrency(256)
+    ///     .admissionMethodLimits({{"AuthenticateUser", 128}})
+    ///     .admissionQueueTimeoutMs(1000)
+    ///     .admissionTargetQueueDelayMs(100)
+    ///     .statsDumpIntervalSec(60)
     ///     .build();
     /// @endcode
     class AuthRpcServiceOptions final : public common::interfaces::IYamlConfigurable {
@@ -28,7 +39,7 @@ namespace app_server::auth {
         AuthRpcServiceOptions();
 
         /// @brief Constructor with all parameters
-        AuthRpcServiceOptions(int32_t max_connection_idle_ms, int32_t max_connection_age_ms, int32_t max_connection_age_grace_ms, int32_t keepalive_time_ms, int32_t keepalive_timeout_ms, int32_t keepalive_permit_without_calls, std::string server_address);
+        AuthRpcServiceOptions(int32_t max_connection_idle_ms, int32_t max_connection_age_ms, int32_t max_connection_age_grace_ms, int32_t keepalive_time_ms, int32_t keepalive_timeout_ms, int32_t keepalive_permit_without_calls, std::string server_address, std::string server_mode, int32_t completion_queue_count, int32_t poller_threads_per_queue, int32_t kdf_worker_threads, int32_t kdf_queue_size, int32_t admission_max_concurrency, std::map<std::string, int32_t> admission_method_limits, int32_t admission_queue_timeout_ms, int32_t admission_target_queue_delay_ms, int32_t stats_dump_interval_sec);
 
         /// @brief Get the maximum connection idle time in milliseconds
         /// @return The maximum connection idle time in milliseconds
@@ -121,6 +132,117 @@ namespace app_server::auth {
         /// in the format "host:port". Using "0.0.0.0" binds to all available interfaces.
         auto serverAddress(const std::string &value) -> void;
 
+        /// @brief Get the server threading mode
+        /// @return "sync", "async" or "callback"
+        /// @details In "sync" mode every in-flight RPC occupies a gRPC sync-server thread for its whole
+        /// duration. In "async" mode RPCs are driven from completion queues by a fixed set of poller threads.
+        /// In "callback" mode unary RPCs use the gRPC callback API with pooled, arena-backed messages, and
+        /// AuthenticateStream runs on the sync-server threads.
+        [[nodiscard]] auto serverMode() const noexcept -> const std::string &;
+
+        /// @brief Set the server threading mode
+        /// @param value "sync", "async" or "callback"
+        auto serverMode(const std::string &value) -> void;
+
+        /// @brief Get the number of server completion queues
+        /// @return The number of completion queues
+        /// @details In async mode this is the number of queues added to the server builder.
+        /// In sync mode it is forwarded as the NUM_CQS sync-server option.
+        [[nodiscard]] auto completionQueueCount() const noexcept -> int32_t;
+
+        /// @brief Set the number of server completion queues
+        /// @param value The number of completion queues
+        auto completionQueueCount(int32_t value) noexcept -> void;
+
+        /// @brief Get the number of poller threads per completion queue
+        /// @return The number of poller threads attached to each completion queue
+        /// @details In async mode each queue is drained by this many threads, so the total number of
+        /// RPC threads is completionQueueCount * pollerThreadsPerQueue. In sync mode it is forwarded
+        /// as the MIN_POLLERS sync-server option.
+        [[nodiscard]] auto pollerThreadsPerQueue() const noexcept -> int32_t;
+
+        /// @brief Set the number of poller threads per completion queue
+        /// @param value The number of poller threads attached to each completion queue
+        auto pollerThreadsPerQueue(int32_t value) noexcept -> void;
+
+        /// @brief Get the number of key-derivation worker threads
+        /// @return The number of threads running password hashing
+        /// @details Password hashing (PBKDF2) for register, authenticate, change and reset runs on a dedicated
+        /// executor of this size so that cheap RPCs keep their RPC threads during a hashing storm.
+        [[nodiscard]] auto kdfWorkerThreads() const noexcept -> int32_t;
+
+        /// @brief Set the number of key-derivation worker threads
+        /// @param value The number of threads running password hashing
+        auto kdfWorkerThreads(int32_t value) noexcept -> void;
+
+        /// @brief Get the maximum number of pending key-derivation tasks
+        /// @return The capacity of the key-derivation queue
+        /// @details Requests that would exceed this capacity fail fast with RESOURCE_EXHAUSTED instead of queueing.
+        [[nodiscard]] auto kdfQueueSize() const noexcept -> int32_t;
+
+        /// @brief Set the maximum number of pending key-derivation tasks
+        /// @param value The capacity of the key-derivation queue
+        auto kdfQueueSize(int32_t value) noexcept -> void;
+
+        /// @brief Get the default per-method concurrency cap
+        /// @return The maximum number of concurrent calls of a method, 0 for unlimited
+        /// @details Applies to every method without an entry in admissionMethodLimits. Calls beyond the
+        /// cap are rejected with UNAVAILABLE before any work starts.
+        [[nodiscard]] auto admissionMaxConcurrency() const noexcept -> int32_t;
+
+        /// @brief Set the default per-method concurrency cap
+        /// @param value The maximum number of concurrent calls of a method, 0 for unlimited
+        auto admissionMaxConcurrency(int32_t value) noexcept -> void;
+
+        /// @brief Get the per-method concurrency caps
+        /// @return Concurrency cap by method name as declared in RpcService.proto, 0 for unlimited
+        [[nodiscard]] auto admissionMethodLimits() const noexcept -> const std::map<std::string, int32_t> &;
+
+        /// @brief Set the per-method concurrency caps
+        /// @param value Concurrency cap by method name as declared in RpcService.proto, 0 for unlimited
+        auto admissionMethodLimits(const std::map<std::string, int32_t> &value) -> void;
+
+        /// @brief Get the longest time a call may wait for a key-derivation worker in milliseconds
+        /// @return The queue timeout in milliseconds, 0 to never shed queued calls
+        /// @details Calls that waited longer are rejected with UNAVAILABLE before hashing starts.
+        [[nodiscard]] auto admissionQueueTimeoutMs() const noexcept -> int32_t;
+
+        /// @brief Set the longest time a call may wait for a key-derivation worker in milliseconds
+        /// @param value The queue timeout in milliseconds, 0 to never shed queued calls
+        auto admissionQueueTimeoutMs(int32_t value) noexcept -> void;
+
+        /// @brief Get the queueing delay the adaptive concurrency limit aims for in milliseconds
+        /// @return The target queueing delay in milliseconds, 0 to keep the caps fixed
+        /// @details Above the target a method's limit shrinks multiplicatively, below it the limit grows
+        /// additively back up to the method's cap.
+        [[nodiscard]] auto admissionTargetQueueDelayMs() const noexcept -> int32_t;
+
+        /// @brief Set the queueing delay the adaptive concurrency limit aims for in milliseconds
+        /// @param value The target queueing delay in milliseconds, 0 to keep the caps fixed
+        auto admissionTargetQueueDelayMs(int32_t value) noexcept -> void;
+
+        /// @brief Get the interval between server statistics dumps in seconds
+        /// @return How often per-method latency percentiles are written to the log, 0 disables the dump
+        /// @details The same statistics are always available through the GetServerStats RPC.
+        [[nodiscard]] auto statsDumpIntervalSec() const noexcept -> int32_t;
+
+        /// @brief Set the interval between server statistics dumps in seconds
+        /// @param value How often per-method latency percentiles are written to the log, 0 disables the dump
+        auto statsDumpIntervalSec(int32_t value) noexcept -> void;
+
+        /// @brief Get the concurrency cap of one method
+        /// @param method_name Method name as declared in RpcService.proto
+        /// @return The method's entry in admissionMethodLimits, admissionMaxConcurrency if it has none
+        [[nodiscard]] auto admissionLimitFor(const std::string &method_name) const -> int32_t;
+
+        /// @brief Check whether the server runs in completion-queue (async) mode
+        /// @return true if serverMode is "async"
+        [[nodiscard]] auto isAsyncMode() const noexcept -> bool;
+
+        /// @brief Check whether the server runs in callback mode
+        /// @return true if serverMode is "callback"
+        [[nodiscard]] auto isCallbackMode() const noexcept -> bool;
+
         /// @brief Deserialize object configuration from a YAML file
         /// @param path The file path to the YAML configuration file
         /// @return true if successful, false otherwise
@@ -136,6 +258,17 @@ namespace app_server::auth {
         ///   keepalive-timeout-ms: 5000
         ///   keepalive-permit-without-calls: 1
         ///   server-address: "0.0.0.0:50051"
+        ///   server-mode: "async"
+        ///   completion-queue-count: 4
+        ///   poller-threads-per-queue: 2
+        ///   kdf-worker-threads: 4
+        ///   kdf-queue-size: 256
+        ///   admission-max-concurrency: 256
+        ///   admission-method-limits:
+        ///     AuthenticateUser: 128
+        ///   admission-queue-timeout-ms: 1000
+        ///   admission-target-queue-delay-ms: 100
+        ///   stats-dump-interval-sec: 60
         /// @endcode
         auto deserializedFromYamlFile(const std::filesystem::path &path) -> void override;
 
@@ -185,6 +318,56 @@ namespace app_server::auth {
             /// @return Reference to this builder for method chaining
             [[nodiscard]] auto serverAddress(const std::string &value) -> Builder &;
 
+            /// @brief Set the server threading mode
+            /// @param value "sync", "async" or "callback"
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto serverMode(const std::string &value) -> Builder &;
+
+            /// @brief Set the number of server completion queues
+            /// @param value The number of completion queues
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto completionQueueCount(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the number of poller threads per completion queue
+            /// @param value The number of poller threads per completion queue
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto pollerThreadsPerQueue(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the number of key-derivation worker threads
+            /// @param value The number of threads running password hashing
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto kdfWorkerThreads(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the maximum number of pending key-derivation tasks
+            /// @param value The capacity of the key-derivation queue
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto kdfQueueSize(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the default per-method concurrency cap
+            /// @param value The maximum number of concurrent calls of a method, 0 for unlimited
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto admissionMaxConcurrency(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the per-method concurrency caps
+            /// @param value Concurrency cap by method name, 0 for unlimited
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto admissionMethodLimits(const std::map<std::string, int32_t> &value) -> Builder &;
+
+            /// @brief Set the longest time a call may wait for a key-derivation worker in milliseconds
+            /// @param value The queue timeout in milliseconds, 0 to never shed queued calls
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto admissionQueueTimeoutMs(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the queueing delay the adaptive concurrency limit aims for in milliseconds
+            /// @param value The target queueing delay in milliseconds, 0 to keep the caps fixed
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto admissionTargetQueueDelayMs(int32_t value) noexcept -> Builder &;
+
+            /// @brief Set the interval between server statistics dumps in seconds
+            /// @param value How often per-method latency percentiles are written to the log, 0 disables the dump
+            /// @return Reference to this builder for method chaining
+            [[nodiscard]] auto statsDumpIntervalSec(int32_t value) noexcept -> Builder &;
+
             /// @brief Build the AuthRpcServiceOptions instance with the configured parameters
             /// @return A new AuthRpcServiceOptions instance with the configured values
             [[nodiscard]] auto build() const -> AuthRpcServiceOptions;
@@ -224,6 +407,36 @@ namespace app_server::auth {
             /// @details This parameter specifies the address and port of the gRPC server
             /// Default value is 0.0.0.0:50051
             std::string server_address_;
+
+            /// @brief The server threading mode ("sync", "async" or "callback")
+            std::string server_mode_{"sync"};
+
+            /// @brief Number of server completion queues
+            int32_t completion_queue_count_{1};
+
+            /// @brief Number of poller threads per completion queue
+            int32_t poller_threads_per_queue_{1};
+
+            /// @brief Number of key-derivation worker threads
+            int32_t kdf_worker_threads_{4};
+
+            /// @brief Maximum number of pending key-derivation tasks
+            int32_t kdf_queue_size_{256};
+
+            /// @brief Default per-method concurrency cap
+            int32_t admission_max_concurrency_{0};
+
+            /// @brief Per-method concurrency caps by method name
+            std::map<std::string, int32_t> admission_method_limits_;
+
+            /// @brief Longest wait for a key-derivation worker (in milliseconds)
+            int32_t admission_queue_timeout_ms_{0};
+
+            /// @brief Queueing delay the adaptive limit aims for (in milliseconds)
+            int32_t admission_target_queue_delay_ms_{0};
+
+            /// @brief Interval between server statistics dumps in seconds
+            int32_t stats_dump_interval_sec_{60};
         };
 
         /// @brief Create a new Builder instance for constructing AuthRpcServiceOptions
@@ -265,6 +478,46 @@ namespace app_server::auth {
         /// @details This parameter specifies the address and port of the gRPC server
         /// Default value is 0.0.0.0:50051
         std::string server_address_{"0.0.0.0:50051"};
+
+        /// @brief The server threading mode ("sync", "async" or "callback")
+        /// @details Default value is "sync", which keeps the one-thread-per-RPC behaviour.
+        std::string server_mode_{"sync"};
+
+        /// @brief Number of server completion queues
+        /// @details Default value is 1.
+        int32_t completion_queue_count_{1};
+
+        /// @brief Number of poller threads per completion queue
+        /// @details Default value is 1.
+        int32_t poller_threads_per_queue_{1};
+
+        /// @brief Number of key-derivation worker threads
+        /// @details Default value is 4.
+        int32_t kdf_worker_threads_{4};
+
+        /// @brief Maximum number of pending key-derivation tasks
+        /// @details Default value is 256.
+        int32_t kdf_queue_size_{256};
+
+        /// @brief Default per-method concurrency cap
+        /// @details Default value is 0, which admits every call.
+        int32_t admission_max_concurrency_{0};
+
+        /// @brief Per-method concurrency caps by method name
+        /// @details Empty by default, so every method uses admission_max_concurrency_.
+        std::map<std::string, int32_t> admission_method_limits_;
+
+        /// @brief Longest wait for a key-derivation worker (in milliseconds)
+        /// @details Default value is 0, which never sheds queued calls.
+        int32_t admission_queue_timeout_ms_{0};
+
+        /// @brief Queueing delay the adaptive limit aims for (in milliseconds)
+        /// @details Default value is 0, which keeps the concurrency caps fixed.
+        int32_t admission_target_queue_delay_ms_{0};
+
+        /// @brief Interval between server statistics dumps in seconds
+        /// @details Default value is 60 (one minute).
+        int32_t stats_dump_interval_sec_{60};
     };
 }
 
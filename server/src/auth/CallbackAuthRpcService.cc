@@ -0,0 +1,275 @@
+#include "CallbackAuthRpcService.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <fmt/format.h>
+#include <glog/logging.h>
+#include <google/protobuf/arena.h>
+
+namespace server_app::auth {
+    /// @brief Pooled state of a single unary AuthService call
+    /// @tparam RequestType Request message type of the method
+    /// @tparam ResponseType Response message type of the method
+    /// @details The messages live on an arena whose first block is part of this object, so a typical
+    /// call needs no memory beyond it. gRPC obtains the call from the pool before deserializing the
+    /// request and hands it back through Release once the response has been sent; the arena is then
+    /// reset and the call returned to its pool. Between the two the call passes admission control and
+    /// runs the handler, either on the gRPC thread or, for password hashing methods, on the
+    /// key-derivation executor which then finishes the call itself. The admission permit is held until
+    /// the response is sent, and the latency from admission until then is recorded together with the
+    /// handler's phase split.
+    template<typename RequestType, typename ResponseType>
+    class CallbackAuthRpcService::ArenaCall final : public grpc::MessageHolder<RequestType, ResponseType> {
+    public:
+        using HandlerMethod = grpc::Status (AuthRpcService::*)(const RequestType *, ResponseType *);
+
+        explicit ArenaCall(ArenaCallPool<RequestType, ResponseType> &pool) : pool_(pool), arena_(arenaOptions(block_)) {
+        }
+
+        /// @brief Serve the call whose messages gRPC obtained from the pool
+        /// @param context Server context of the call, carrying the pooled call as its allocator state
+        /// @param handler Service implementation that performs the actual work
+        /// @param method Method of the call
+        /// @param handler_method Handler of the method
+        /// @param offload Whether the handler must run on the key-derivation executor
+        /// @return Reactor of the call, finished now or later by a key-derivation worker
+        [[nodiscard]] static auto serve(grpc::CallbackServerContext *const context, AuthRpcService &handler, const RpcMethod method, const HandlerMethod handler_method, const bool offload) -> grpc::ServerUnaryReactor * {
+            auto *const reactor = context->DefaultReactor();
+            static_cast<ArenaCall *>(context->GetRpcAllocatorState())->start(reactor, handler, method, handler_method, offload);
+            return reactor;
+        }
+
+        /// @brief Create empty messages on the arena for the next call
+        auto prepare() -> void {
+            this->set_request(google::protobuf::Arena::Create<RequestType>(&arena_));
+            this->set_response(google::protobuf::Arena::Create<ResponseType>(&arena_));
+        }
+
+        /// @brief Discard the messages and return the call to its pool
+        auto Release() -> void override;
+
+    private:
+        /// @brief Size of the arena block embedded in every call, enough for the messages of a typical request
+        static constexpr size_t INITIAL_BLOCK_SIZE = 1024;
+
+        /// @brief Build arena options that start with the embedded block
+        /// @param block Embedded block
+        /// @return Arena options
+        [[nodiscard]] static auto arenaOptions(std::array<std::byte, INITIAL_BLOCK_SIZE> &block) noexcept -> google::protobuf::ArenaOptions {
+            google::protobuf::ArenaOptions options;
+            options.initial_block = reinterpret_cast<char *>(block.data());
+            options.initial_block_size = block.size();
+            return options;
+        }
+
+        /// @brief Admit the call and run or queue its handler
+        auto start(grpc::ServerUnaryReactor *const reactor, AuthRpcService &handler, const RpcMethod method, const HandlerMethod handler_method, const bool offload) -> void {
+            reactor_ = reactor;
+            handler_ = &handler;
+            method_ = method;
+            handler_method_ = handler_method;
+            timing_ = {};
+
+            permit_ = handler.TryAdmit(method);
+            if (!permit_) {
+                finish(AuthRpcService::RejectOverloaded(this->response()));
+                return;
+            }
+            started_at_ = std::chrono::steady_clock::now();
+
+            if (!offload) {
+                process();
+                return;
+            }
+
+            // Password hashing must not occupy a gRPC thread, the worker finishes the call
+            if (!handler.TrySubmitKdf([this] {
+                timing_.queue = std::chrono::steady_clock::now() - started_at_;
+                // Shed the call before hashing if its client has most likely given up already
+                if (!handler_->AdmitQueued(method_, started_at_)) {
+                    recordLatency();
+                    finish(AuthRpcService::RejectOverloaded(this->response()));
+                    return;
+                }
+                process();
+            })) {
+                finish(AuthRpcService::RejectBusy(this->response()));
+            }
+        }
+
+        /// @brief Run the handler and send its response
+        auto process() -> void {
+            grpc::Status status;
+            try {
+                status = AuthRpcService::RunTimed([this] { return (handler_->*handler_method_)(this->request(), this->response()); }, timing_);
+            } catch (const std::exception &e) {
+                this->response()->set_success(false);
+                this->response()->set_message(fmt::format("System error: {}", e.what()));
+                this->response()->set_error_code(500);
+                status = grpc::Status{grpc::StatusCode::INTERNAL, e.what()};
+            }
+            recordLatency();
+            finish(status);
+        }
+
+        /// @brief Record the latency of the call from admission until now
+        auto recordLatency() noexcept -> void {
+            timing_.total = std::chrono::steady_clock::now() - started_at_;
+            handler_->RecordLatency(method_, timing_);
+        }
+
+        /// @brief Send the response; the call may be released as soon as this returns
+        /// @param status Status to send to the client
+        auto finish(const grpc::Status &status) -> void {
+            permit_.reset();
+            reactor_->Finish(status);
+        }
+
+        ArenaCallPool<RequestType, ResponseType> &pool_;
+        alignas(std::max_align_t) std::array<std::byte, INITIAL_BLOCK_SIZE> block_;
+        google::protobuf::Arena arena_;
+        grpc::ServerUnaryReactor *reactor_{nullptr};
+        AuthRpcService *handler_{nullptr};
+        RpcMethod method_{};
+        HandlerMethod handler_method_{nullptr};
+        std::optional<AdmissionController::Permit> permit_;
+        std::chrono::steady_clock::time_point started_at_;
+        RpcLatencyStats::CallTiming timing_;
+    };
+
+    /// @brief Message allocator of one method, recycling calls instead of allocating them
+    /// @tparam RequestType Request message type of the method
+    /// @tparam ResponseType Response message type of the method
+    /// @details The pool grows to the method's peak concurrency; at most MAX_IDLE_CALLS released calls
+    /// are kept for reuse, the rest are freed.
+    template<typename RequestType, typename ResponseType>
+    class CallbackAuthRpcService::ArenaCallPool final : public ICallPool, public grpc::MessageAllocator<RequestType, ResponseType> {
+    public:
+        ArenaCallPool() {
+            idle_.reserve(MAX_IDLE_CALLS);
+        }
+
+        auto AllocateMessages() -> grpc::MessageHolder<RequestType, ResponseType> * override {
+            std::unique_ptr<ArenaCall<RequestType, ResponseType> > call;
+            {
+                std::lock_guard lock(mutex_);
+                if (!idle_.empty()) {
+                    call = std::move(idle_.back());
+                    idle_.pop_back();
+                }
+            }
+            if (!call) {
+                call = std::make_unique<ArenaCall<RequestType, ResponseType> >(*this);
+            }
+            call->prepare();
+            return call.release();
+        }
+
+        /// @brief Take back a released call
+        /// @param call Call whose arena has been reset
+        auto recycle(ArenaCall<RequestType, ResponseType> *const call) -> void {
+            std::unique_ptr<ArenaCall<RequestType, ResponseType> > released(call);
+            std::lock_guard lock(mutex_);
+            if (idle_.size() < MAX_IDLE_CALLS) {
+                idle_.push_back(std::move(released));
+            }
+        }
+
+    private:
+        /// @brief Maximum number of released calls kept for reuse
+        static constexpr size_t MAX_IDLE_CALLS = 256;
+
+        std::mutex mutex_;
+        std::vector<std::unique_ptr<ArenaCall<RequestType, ResponseType> > > idle_;
+    };
+
+    template<typename RequestType, typename ResponseType>
+    auto CallbackAuthRpcService::ArenaCall<RequestType, ResponseType>::Release() -> void {
+        // Destroys the messages and rewinds the arena to its embedded block
+        arena_.Reset();
+        pool_.recycle(this);
+    }
+
+    CallbackAuthRpcService::HybridService::HybridService(AuthRpcService &handler) noexcept : handler_(handler) {
+    }
+
+    auto CallbackAuthRpcService::HybridService::RegisterUser(::grpc::CallbackServerContext *const context, const ::rpc::RegisterUserRequest * /*request*/, ::rpc::AuthResponse * /*response*/) -> ::grpc::ServerUnaryReactor * {
+        return ArenaCall<::rpc::RegisterUserRequest, ::rpc::AuthResponse>::serve(context, handler_, RpcMethod::RegisterUser, &AuthRpcService::HandleRegisterUser, true);
+    }
+
+    auto CallbackAuthRpcService::HybridService::AuthenticateUser(::grpc::CallbackServerContext *const context, const ::rpc::AuthenticateUserRequest * /*request*/, ::rpc::AuthResponse * /*response*/) -> ::grpc::ServerUnaryReactor * {
+        return ArenaCall<::rpc::AuthenticateUserRequest, ::rpc::AuthResponse>::serve(context, handler_, RpcMethod::AuthenticateUser, &AuthRpcService::HandleAuthenticateUser, true);
+    }
+
+    auto CallbackAuthRpcService::HybridService::ChangePassword(::grpc::CallbackServerContext *const context, const ::rpc::ChangePasswordRequest * /*request*/, ::rpc::AuthResponse * /*response*/) -> ::grpc::ServerUnaryReactor * {
+        return ArenaCall<::rpc::ChangePasswordRequest, ::rpc::AuthResponse>::serve(context, handler_, RpcMethod::ChangePassword, &AuthRpcService::HandleChangePassword, true);
+    }
+
+    auto CallbackAuthRpcService::HybridService::ResetPassword(::grpc::CallbackServerContext *const context, const ::rpc::ResetPasswordRequest * /*request*/, ::rpc::AuthResponse * /*response*/) -> ::grpc::ServerUnaryReactor * {
+        return ArenaCall<::rpc::ResetPasswordRequest, ::rpc::AuthResponse>::serve(context, handler_, RpcMethod::ResetPassword, &AuthRpcService::HandleResetPassword, true);
+    }
+
+    auto CallbackAuthRpcService::HybridService::DeleteUser(::grpc::CallbackServerContext *const context, const ::rpc::DeleteUserRequest * /*request*/, ::rpc::AuthResponse * /*response*/) -> ::grpc::ServerUnaryReactor * {
+        return ArenaCall<::rpc::DeleteUserRequest, ::rpc::AuthResponse>::serve(context, handler_, RpcMethod::DeleteUser, &AuthRpcService::HandleDeleteUser, false);
+    }
+
+    auto CallbackAuthRpcService::HybridService::UserExists(::grpc::CallbackServerContext *const context, const ::rpc::UserExistsRequest * /*request*/, ::rpc::AuthResponse * /*response*/) -> ::grpc::ServerUnaryReactor * {
+        return ArenaCall<::rpc::UserExistsRequest, ::rpc::AuthResponse>::serve(context, handler_, RpcMethod::UserExists, &AuthRpcService::HandleUserExists, false);
+    }
+
+    auto CallbackAuthRpcService::HybridService::BatchUserExists(::grpc::CallbackServerContext *const context, const ::rpc::BatchUserExistsRequest * /*request*/, ::rpc::BatchUserExistsResponse * /*response*/) -> ::grpc::ServerUnaryReactor * {
+        return ArenaCall<::rpc::BatchUserExistsRequest, ::rpc::BatchUserExistsResponse>::serve(context, handler_, RpcMethod::BatchUserExists, &AuthRpcService::HandleBatchUserExists, false);
+    }
+
+    auto CallbackAuthRpcService::HybridService::BatchRegisterUsers(::grpc::CallbackServerContext *const context, const ::rpc::BatchRegisterUsersRequest * /*request*/, ::rpc::BatchRegisterUsersResponse * /*response*/) -> ::grpc::ServerUnaryReactor * {
+        return ArenaCall<::rpc::BatchRegisterUsersRequest, ::rpc::BatchRegisterUsersResponse>::serve(context, handler_, RpcMethod::BatchRegisterUsers, &AuthRpcService::HandleBatchRegisterUsers, true);
+    }
+
+    auto CallbackAuthRpcService::HybridService::ValidateToken(::grpc::CallbackServerContext *const context, const ::rpc::ValidateTokenRequest * /*request*/, ::rpc::ValidateTokenResponse * /*response*/) -> ::grpc::ServerUnaryReactor * {
+        return ArenaCall<::rpc::ValidateTokenRequest, ::rpc::ValidateTokenResponse>::serve(context, handler_, RpcMethod::ValidateToken, &AuthRpcService::HandleValidateToken, false);
+    }
+
+    auto CallbackAuthRpcService::HybridService::GetServerStats(::grpc::CallbackServerContext *const context, const ::rpc::GetServerStatsRequest * /*request*/, ::rpc::GetServerStatsResponse * /*response*/) -> ::grpc::ServerUnaryReactor * {
+        return ArenaCall<::rpc::GetServerStatsRequest, ::rpc::GetServerStatsResponse>::serve(context, handler_, RpcMethod::GetServerStats, &AuthRpcService::HandleGetServerStats, false);
+    }
+
+    auto CallbackAuthRpcService::HybridService::AuthenticateStream(::grpc::ServerContext *context, ::grpc::ServerReaderWriter<::rpc::AuthResponse, ::rpc::AuthenticateUserRequest> *stream) -> ::grpc::Status {
+        return handler_.AuthenticateStream(context, stream);
+    }
+
+    CallbackAuthRpcService::CallbackAuthRpcService(AuthRpcService &handler) noexcept : handler_(handler), service_(handler) {
+    }
+
+    CallbackAuthRpcService::~CallbackAuthRpcService() noexcept = default;
+
+    auto CallbackAuthRpcService::registerWith(grpc::ServerBuilder &builder) -> void {
+        if (!pools_.empty()) {
+            throw std::logic_error("CallbackAuthRpcService::registerWith: service is already registered");
+        }
+
+        service_.SetMessageAllocatorFor_RegisterUser(addPool<rpc::RegisterUserRequest, rpc::AuthResponse>());
+        service_.SetMessageAllocatorFor_AuthenticateUser(addPool<rpc::AuthenticateUserRequest, rpc::AuthResponse>());
+        service_.SetMessageAllocatorFor_ChangePassword(addPool<rpc::ChangePasswordRequest, rpc::AuthResponse>());
+        service_.SetMessageAllocatorFor_ResetPassword(addPool<rpc::ResetPasswordRequest, rpc::AuthResponse>());
+        service_.SetMessageAllocatorFor_DeleteUser(addPool<rpc::DeleteUserRequest, rpc::AuthResponse>());
+        service_.SetMessageAllocatorFor_UserExists(addPool<rpc::UserExistsRequest, rpc::AuthResponse>());
+        service_.SetMessageAllocatorFor_BatchUserExists(addPool<rpc::BatchUserExistsRequest, rpc::BatchUserExistsResponse>());
+        service_.SetMessageAllocatorFor_BatchRegisterUsers(addPool<rpc::BatchRegisterUsersRequest, rpc::BatchRegisterUsersResponse>());
+        service_.SetMessageAllocatorFor_ValidateToken(addPool<rpc::ValidateTokenRequest, rpc::ValidateTokenResponse>());
+        service_.SetMessageAllocatorFor_GetServerStats(addPool<rpc::GetServerStatsRequest, rpc::GetServerStatsResponse>());
+        builder.RegisterService(&service_);
+        LOG(INFO) << fmt::format("Callback AuthService registered with {} arena-backed message pools", pools_.size());
+    }
+
+    template<typename RequestType, typename ResponseType>
+    auto CallbackAuthRpcService::addPool() -> grpc::MessageAllocator<RequestType, ResponseType> * {
+        auto pool = std::make_unique<ArenaCallPool<RequestType, ResponseType> >();
+        auto *const allocator = pool.get();
+        pools_.push_back(std::move(pool));
+        return allocator;
+    }
+}
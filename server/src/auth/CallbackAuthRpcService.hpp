@@ -0,0 +1,118 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/support/message_allocator.h>
+
+#include "generated/RpcService.grpc.pb.h"
+#include "AuthRpcService.hpp"
+
+namespace server_app::auth {
+    /// @brief Callback-API implementation of the AuthService with arena-backed messages
+    /// @details Every unary method is registered with the gRPC callback API and a message allocator
+    /// that hands out pooled calls. Each pooled call owns a protobuf arena with an inline first block,
+    /// so the request, the response and the strings they hold are carved from memory that is reset
+    /// and reused for the next call instead of being allocated per RPC. The pooled call also carries
+    /// the per-call state (admission permit, timing, reactor), so neither accepting a call nor handing
+    /// it to the key-derivation executor allocates. The bidirectional AuthenticateStream stays a sync
+    /// method and runs on the server's sync thread pool. The business logic is delegated to an
+    /// AuthRpcService instance so all server modes share one implementation.
+    class CallbackAuthRpcService final {
+    public:
+        /// @brief Construct a callback service that forwards every call to the given handler
+        /// @param handler Service implementation that performs the actual work
+        explicit CallbackAuthRpcService(AuthRpcService &handler) noexcept;
+
+        /// @brief Destructor releasing the pooled calls
+        /// @details The gRPC server must have been shut down, so no call is in flight anymore.
+        ~CallbackAuthRpcService() noexcept;
+
+        /// @brief Copy constructor (deleted)
+        CallbackAuthRpcService(const CallbackAuthRpcService &) = delete;
+
+        /// @brief Copy assignment operator (deleted)
+        auto operator=(const CallbackAuthRpcService &) -> CallbackAuthRpcService & = delete;
+
+        /// @brief Move constructor (deleted)
+        CallbackAuthRpcService(CallbackAuthRpcService &&) = delete;
+
+        /// @brief Move assignment operator (deleted)
+        auto operator=(CallbackAuthRpcService &&) -> CallbackAuthRpcService & = delete;
+
+        /// @brief Register the callback service and its message allocators with a server builder
+        /// @param builder Server builder that has not been started yet
+        /// @throws std::logic_error if called twice
+        auto registerWith(grpc::ServerBuilder &builder) -> void;
+
+    private:
+        /// @brief Generated service with every unary method switched to the callback API
+        using UnaryCallbackService = rpc::AuthService::WithCallbackMethod_RegisterUser<rpc::AuthService::WithCallbackMethod_AuthenticateUser<rpc::AuthService::WithCallbackMethod_ChangePassword<rpc::AuthService::WithCallbackMethod_ResetPassword<rpc::AuthService::WithCallbackMethod_DeleteUser<rpc::AuthService::WithCallbackMethod_UserExists<rpc::AuthService::WithCallbackMethod_BatchUserExists<rpc::AuthService::WithCallbackMethod_BatchRegisterUsers<rpc::AuthService::WithCallbackMethod_ValidateToken<rpc::AuthService::WithCallbackMethod_GetServerStats<rpc::AuthService::Service> > > > > > > > > >;
+
+        /// @brief Callback unary service that serves AuthenticateStream synchronously through the handler
+        class HybridService final : public UnaryCallbackService {
+        public:
+            /// @brief Construct a service forwarding every method to the given handler
+            /// @param handler Service implementation that performs the actual work
+            explicit HybridService(AuthRpcService &handler) noexcept;
+
+            /// @brief Register new user account
+            [[nodiscard]] auto RegisterUser(::grpc::CallbackServerContext *context, const ::rpc::RegisterUserRequest *request, ::rpc::AuthResponse *response) -> ::grpc::ServerUnaryReactor * override;
+
+            /// @brief Authenticate user credentials
+            [[nodiscard]] auto AuthenticateUser(::grpc::CallbackServerContext *context, const ::rpc::AuthenticateUserRequest *request, ::rpc::AuthResponse *response) -> ::grpc::ServerUnaryReactor * override;
+
+            /// @brief Change user password
+            [[nodiscard]] auto ChangePassword(::grpc::CallbackServerContext *context, const ::rpc::ChangePasswordRequest *request, ::rpc::AuthResponse *response) -> ::grpc::ServerUnaryReactor * override;
+
+            /// @brief Reset user password (administrative)
+            [[nodiscard]] auto ResetPassword(::grpc::CallbackServerContext *context, const ::rpc::ResetPasswordRequest *request, ::rpc::AuthResponse *response) -> ::grpc::ServerUnaryReactor * override;
+
+            /// @brief Delete user account
+            [[nodiscard]] auto DeleteUser(::grpc::CallbackServerContext *context, const ::rpc::DeleteUserRequest *request, ::rpc::AuthResponse *response) -> ::grpc::ServerUnaryReactor * override;
+
+            /// @brief Check if user exists
+            [[nodiscard]] auto UserExists(::grpc::CallbackServerContext *context, const ::rpc::UserExistsRequest *request, ::rpc::AuthResponse *response) -> ::grpc::ServerUnaryReactor * override;
+
+            /// @brief Check which of several users exist
+            [[nodiscard]] auto BatchUserExists(::grpc::CallbackServerContext *context, const ::rpc::BatchUserExistsRequest *request, ::rpc::BatchUserExistsResponse *response) -> ::grpc::ServerUnaryReactor * override;
+
+            /// @brief Register several user accounts in one transaction
+            [[nodiscard]] auto BatchRegisterUsers(::grpc::CallbackServerContext *context, const ::rpc::BatchRegisterUsersRequest *request, ::rpc::BatchRegisterUsersResponse *response) -> ::grpc::ServerUnaryReactor * override;
+
+            /// @brief Validate a session token issued by AuthenticateUser
+            [[nodiscard]] auto ValidateToken(::grpc::CallbackServerContext *context, const ::rpc::ValidateTokenRequest *request, ::rpc::ValidateTokenResponse *response) -> ::grpc::ServerUnaryReactor * override;
+
+            /// @brief Report latency percentiles, admission state and cache counters
+            [[nodiscard]] auto GetServerStats(::grpc::CallbackServerContext *context, const ::rpc::GetServerStatsRequest *request, ::rpc::GetServerStatsResponse *response) -> ::grpc::ServerUnaryReactor * override;
+
+            /// @brief Authenticate a stream of credentials on a sync server thread
+            [[nodiscard]] auto AuthenticateStream(::grpc::ServerContext *context, ::grpc::ServerReaderWriter<::rpc::AuthResponse, ::rpc::AuthenticateUserRequest> *stream) -> ::grpc::Status override;
+
+        private:
+            AuthRpcService &handler_;
+        };
+
+        /// @brief Common interface of the per-method pools, so the service can own them without knowing their message types
+        class ICallPool {
+        public:
+            virtual ~ICallPool() = default;
+        };
+
+        template<typename RequestType, typename ResponseType>
+        class ArenaCall;
+
+        template<typename RequestType, typename ResponseType>
+        class ArenaCallPool;
+
+        /// @brief Create the call pool of one method
+        /// @tparam RequestType Request message type of the method
+        /// @tparam ResponseType Response message type of the method
+        /// @return Message allocator to register for the method, owned by this service
+        template<typename RequestType, typename ResponseType>
+        [[nodiscard]] auto addPool() -> grpc::MessageAllocator<RequestType, ResponseType> *;
+
+        AuthRpcService &handler_;
+        HybridService service_;
+        std::vector<std::unique_ptr<ICallPool> > pools_;
+    };
+}
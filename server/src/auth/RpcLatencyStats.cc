@@ -0,0 +1,17 @@
+#include "RpcLatencyStats.hpp"
+
+namespace server_app::auth {
+    auto RpcLatencyStats::record(const RpcMethod method, const CallTiming &timing) noexcept -> void {
+        auto &histograms = histograms_[static_cast<size_t>(method)];
+        histograms[static_cast<size_t>(LatencyPhase::Total)].record(timing.total);
+        if (timing.queue) {
+            histograms[static_cast<size_t>(LatencyPhase::Queue)].record(*timing.queue);
+        }
+        histograms[static_cast<size_t>(LatencyPhase::Database)].record(timing.phases[static_cast<size_t>(common::time::RequestPhase::Database)]);
+        histograms[static_cast<size_t>(LatencyPhase::KeyDerivation)].record(timing.phases[static_cast<size_t>(common::time::RequestPhase::KeyDerivation)]);
+    }
+
+    auto RpcLatencyStats::snapshot(const RpcMethod method, const LatencyPhase phase) const -> common::time::LatencyHistogram::Snapshot {
+        return histograms_[static_cast<size_t>(method)][static_cast<size_t>(phase)].snapshot();
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "AdmissionController.hpp"
+#include "src/time/LatencyHistogram.hpp"
+#include "src/time/RequestPhaseTimer.hpp"
+
+namespace server_app::auth {
+    /// @brief Parts of a call whose latency is recorded separately
+    enum class LatencyPhase : uint8_t {
+        Total,
+        Queue,
+        Database,
+        KeyDerivation,
+    };
+
+    /// @brief Number of LatencyPhase values, for tables indexed by the enum
+    inline constexpr size_t LATENCY_PHASE_COUNT = static_cast<size_t>(LatencyPhase::KeyDerivation) + 1;
+
+    /// @brief Per-method latency histograms of the AuthService
+    /// @details Every admitted call records its total latency together with the time it waited for a
+    /// key-derivation worker and the time it spent in database calls and key derivation, each into its
+    /// own lock-free histogram, so percentiles of every phase can be read at any time without a profiler.
+    class RpcLatencyStats {
+    public:
+        /// @brief Latency split of one call
+        struct CallTiming {
+            std::chrono::steady_clock::duration total{0}; ///< Time from admission until the response was ready
+            std::optional<std::chrono::steady_clock::duration> queue; ///< Wait for a key-derivation worker, nullopt for calls run inline
+            common::time::RequestPhaseDurations phases{}; ///< Database and key derivation time of the handler
+        };
+
+        /// @brief Construct empty histograms for every method
+        RpcLatencyStats() = default;
+
+        /// @brief Copy constructor (deleted)
+        RpcLatencyStats(const RpcLatencyStats &) = delete;
+
+        /// @brief Copy assignment operator (deleted)
+        auto operator=(const RpcLatencyStats &) -> RpcLatencyStats & = delete;
+
+        /// @brief Record the latency of a finished call
+        /// @param method Method of the call
+        /// @param timing Latency split of the call
+        auto record(RpcMethod method, const CallTiming &timing) noexcept -> void;
+
+        /// @brief Get the latency distribution of one phase of a method
+        /// @param method Method to inspect
+        /// @param phase Phase to inspect
+        /// @return Merged histogram of the phase
+        [[nodiscard]] auto snapshot(RpcMethod method, LatencyPhase phase) const -> common::time::LatencyHistogram::Snapshot;
+
+    private:
+        std::array<std::array<common::time::LatencyHistogram, LATENCY_PHASE_COUNT>, RPC_METHOD_COUNT> histograms_;
+    };
+}
@@ -1,124 +1,200 @@
 #include "PasswordSQL.hpp"
+#include <algorithm>
+#include <bit>
 #include <stdexcept>
+#include <chrono>
+#include <filesystem>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <glog/logging.h>
+#include <fmt/format.h>
+
+#include "time/RequestPhaseTimer.hpp"
 
 namespace server_app::sql {
-    PasswordSQL::PasswordSQL(const std::string &db_path) noexcept(false) : sqlite_manager_{db_path} {
-        /// @brief Create users table if not exists during initialization
-        constexpr std::string_view create_table_sql = R"(
-            CREATE TABLE IF NOT EXISTS users (
-                id INTEGER PRIMARY KEY AUTOINCREMENT,
-                username TEXT UNIQUE NOT NULL,
-                password TEXT NOT NULL,
-                created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
-            );
-        )";
+    /// @brief FNV-1a offset basis for 64-bit hashes
+    static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
 
-        if (const auto result = sqlite_manager_.exec(create_table_sql.data()); result < 0) {
-            LOG(ERROR) << "Failed to initialize users table in database: " << db_path;
+    /// @brief FNV-1a prime for 64-bit hashes
+    static constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+    PasswordSQL::Shard::Shard(const std::string &path, const common::sql::sqlite::SQLiteOptions &sqlite_options, const size_t index, const size_t count) : sqlite_manager{path, sqlite_options} {
+        /// @brief Create users table if not exists during initialization
+        if (const auto result = sqlite_manager.exec(CREATE_USERS_TABLE_SQL); result < 0) {
+            LOG(ERROR) << "Failed to initialize users table in database: " << path;
             throw std::runtime_error("Failed to initialize users table");
         }
-        LOG(INFO) << "PasswordSQL initialized with database: " << db_path;
+        checkShardLayout(sqlite_manager, path, index, count);
+        migrateLegacySchema(sqlite_manager);
+        if (sqlite_options.useGroupCommit()) {
+            batch_writer = std::make_unique<common::sql::sqlite::SQLiteBatchWriter>(sqlite_manager, static_cast<size_t>(sqlite_options.groupCommitMaxBatch()), std::chrono::milliseconds(sqlite_options.groupCommitIntervalMs()));
+        }
     }
 
-    auto PasswordSQL::RegisterUser(const std::string &username, const std::string &password) const noexcept -> bool {
-        /// @brief Validate input parameters
-        if (username.empty() || password.empty()) {
-            LOG(ERROR) << "Registration failed: username or password is empty";
-            return false;
+    PasswordSQL::PasswordSQL(const std::string &db_path, const common::sql::sqlite::SQLiteOptions &sqlite_options) noexcept(false) {
+        const auto shard_count = static_cast<size_t>(std::max(sqlite_options.shardCount(), 1));
+        // A single file left from before sharding would otherwise be ignored, hiding all of its users
+        if (shard_count > 1 && std::filesystem::exists(db_path)) {
+            LOG(ERROR) << "Unsharded database " << db_path << " found while " << shard_count << " shards are configured";
+            throw std::runtime_error(fmt::format("Unsharded database {} found while {} shards are configured, reshard it with script/reshard_users.py", db_path, shard_count));
         }
 
-        try {
-            constexpr std::string_view insert_sql = R"(
-                INSERT INTO users (username, password) VALUES (?, ?);
-            )";
+        shards_.reserve(shard_count);
+        for (size_t shard = 0; shard < shard_count; ++shard) {
+            shards_.push_back(std::make_unique<Shard>(ShardPath(db_path, shard, shard_count), sqlite_options, shard, shard_count));
+        }
+        LOG(INFO) << "PasswordSQL initialized with database: " << db_path << " (shards: " << shard_count << ", journal mode: " << sqlite_options.journalMode() << ", readers per shard: " << shards_.front()->sqlite_manager.readerCount() << ", group commit batch: " << sqlite_options.groupCommitMaxBatch() << ")";
+    }
 
-            if (const auto result = sqlite_manager_.exec(insert_sql.data(), {username, password}); result > 0) {
-                LOG(INFO) << "User registered successfully: " << username;
-                return true;
-            } else {
-                LOG(WARNING) << "User registration affected no rows for user: " << username;
-                return false;
-            }
-        } catch (const std::exception &e) {
-            LOG(ERROR) << "Failed to register user " << username << ": " << e.what();
-            return false;
+    auto PasswordSQL::checkShardLayout(const common::sql::sqlite::SQLiteManager &sqlite_manager, const std::string &path, const size_t index, const size_t count) -> void {
+        static_cast<void>(sqlite_manager.exec(CREATE_SHARD_LAYOUT_TABLE_SQL));
+        static_cast<void>(sqlite_manager.exec("INSERT OR IGNORE INTO shard_layout (id, shard_index, shard_count) VALUES (0, ?, ?);", {static_cast<int64_t>(index), static_cast<int64_t>(count)}));
+
+        const auto layout = sqlite_manager.query("SELECT shard_index, shard_count FROM shard_layout WHERE id = 0;");
+        if (layout.empty() || layout[0].size() < 2) {
+            throw std::runtime_error(fmt::format("Failed to read the shard layout of {}", path));
+        }
+        if (layout[0][0] != std::to_string(index) || layout[0][1] != std::to_string(count)) {
+            LOG(ERROR) << "Database " << path << " holds shard " << layout[0][0] << " of " << layout[0][1] << ", but shard " << index << " of " << count << " is configured";
+            throw std::runtime_error(fmt::format("Database {} holds shard {} of {}, but shard {} of {} is configured, reshard it with script/reshard_users.py", path, layout[0][0], layout[0][1], index, count));
         }
     }
 
-    auto PasswordSQL::AuthenticateUser(const std::string &username, const std::string &password) const noexcept -> bool {
-        /// @brief Validate input parameters
-        if (username.empty() || password.empty()) {
-            LOG(ERROR) << "Authentication failed: username or password is empty";
-            return false;
+    auto PasswordSQL::migrateLegacySchema(const common::sql::sqlite::SQLiteManager &sqlite_manager) -> void {
+        constexpr std::string_view legacy_column_sql = R"(
+            SELECT 1 FROM pragma_table_info('users') WHERE name = 'password';
+        )";
+        if (sqlite_manager.query(legacy_column_sql).empty()) {
+            return;
         }
 
+        LOG(INFO) << "Migrating users table from salt:hash text to binary credential columns";
+
+        // Legacy rows hold the raw salt, a ':' separator and the raw hash in one TEXT value
+        constexpr size_t salt_size = common::crypto::CryptoToolKit::SALT_SIZE;
+        constexpr size_t hash_size = common::crypto::CryptoToolKit::HASH_SIZE;
+        const std::string copy_sql = fmt::format(R"(
+            INSERT INTO users (id, username, salt, hash, kdf_id, iterations, created_at)
+            SELECT id, username, substr(CAST(password AS BLOB), 1, {0}), substr(CAST(password AS BLOB), {1}, {2}), {3}, {4}, created_at
+            FROM users_legacy
+            WHERE length(CAST(password AS BLOB)) = {5} AND substr(CAST(password AS BLOB), {6}, 1) = X'3A';
+        )", salt_size, salt_size + 2, hash_size, static_cast<int>(common::auth::KdfId::Pbkdf2HmacSha256), common::crypto::CryptoToolKit::DEFAULT_ITERATIONS, salt_size + 1 + hash_size, salt_size + 1);
+
+        const std::vector<std::string> migration = {
+            "ALTER TABLE users RENAME TO users_legacy;",
+            std::string(CREATE_USERS_TABLE_SQL),
+            copy_sql,
+            "DELETE FROM users_legacy WHERE id IN (SELECT id FROM users);"
+        };
+
+        static_cast<void>(sqlite_manager.exec("BEGIN IMMEDIATE;"));
         try {
-            constexpr std::string_view select_sql = R"(
-                SELECT 1 FROM users WHERE username = ? AND password = ?;
-            )";
+            for (const auto &sql: migration) {
+                static_cast<void>(sqlite_manager.exec(sql));
+            }
+            static_cast<void>(sqlite_manager.exec("COMMIT;"));
+        } catch (const std::exception &e) {
+            try {
+                static_cast<void>(sqlite_manager.exec("ROLLBACK;"));
+            } catch (const std::exception &) {
+                // The failed statement may already have ended the transaction
+            }
+            LOG(ERROR) << "Failed to migrate users table: " << e.what();
+            throw std::runtime_error(fmt::format("Failed to migrate users table: {}", e.what()));
+        }
+
+        const auto remaining = sqlite_manager.query("SELECT COUNT(*) FROM users_legacy;");
+        if (!remaining.empty() && !remaining[0].empty() && remaining[0][0] != "0") {
+            LOG(WARNING) << remaining[0][0] << " users with malformed credentials could not be migrated and were kept in table users_legacy";
+            return;
+        }
+        static_cast<void>(sqlite_manager.exec("DROP TABLE users_legacy;"));
+        LOG(INFO) << "Users table migrated to binary credential columns";
+    }
 
-            const auto result = sqlite_manager_.query(select_sql.data(), {username, password});
-            const bool authenticated = !result.empty();
+    auto PasswordSQL::credentialParams(const common::auth::CredentialRecord &credentials, const std::string_view username) -> std::vector<common::sql::sqlite::SQLiteManager::Value> {
+        return {
+            common::sql::sqlite::SQLiteManager::Blob(credentials.salt.begin(), credentials.salt.end()),
+            common::sql::sqlite::SQLiteManager::Blob(credentials.hash.begin(), credentials.hash.end()),
+            static_cast<int64_t>(credentials.kdf_id),
+            static_cast<int64_t>(credentials.iterations),
+            std::string(username)
+        };
+    }
 
-            if (authenticated) {
-                LOG(INFO) << "User authenticated successfully: " << username;
-            } else {
-                LOG(WARNING) << "Authentication failed for user: " << username;
-            }
+    auto PasswordSQL::readCredentials(const common::sql::sqlite::SQLiteManager::PreparedStatement &stmt, const int first_column) noexcept -> std::optional<common::auth::CredentialRecord> {
+        common::auth::CredentialRecord credentials;
+        const auto salt = stmt.columnBlob(first_column);
+        const auto hash = stmt.columnBlob(first_column + 1);
+        if (salt.size() != credentials.salt.size() || hash.size() != credentials.hash.size()) {
+            return std::nullopt;
+        }
+        std::ranges::copy(salt, credentials.salt.begin());
+        std::ranges::copy(hash, credentials.hash.begin());
+        credentials.kdf_id = static_cast<common::auth::KdfId>(stmt.columnInt64(first_column + 2));
+        credentials.iterations = static_cast<uint32_t>(stmt.columnInt64(first_column + 3));
+        return credentials;
+    }
 
-            return authenticated;
-        } catch (const std::exception &e) {
-            LOG(ERROR) << "Authentication failed for user " << username << ": " << e.what();
-            return false;
+    auto PasswordSQL::execWrite(const Shard &shard, const std::string_view sql, std::vector<common::sql::sqlite::SQLiteManager::Value> params) -> int {
+        if (shard.batch_writer) {
+            return shard.batch_writer->submit(std::string(sql), std::move(params)).get();
         }
+        return shard.sqlite_manager.exec(sql, params);
     }
 
-    auto PasswordSQL::ChangePassword(const std::string &username, const std::string &old_password, const std::string &new_password) const noexcept -> bool {
+    auto PasswordSQL::shardFor(const std::string_view username) const noexcept -> const Shard & {
+        return *shards_[ShardIndex(username, shards_.size())];
+    }
+
+    auto PasswordSQL::RegisterUser(const std::string_view username, const common::auth::CredentialRecord &credentials) const noexcept -> RegisterResult {
+        const common::time::ScopedPhaseTimer phase_timer(common::time::RequestPhase::Database);
         /// @brief Validate input parameters
-        if (username.empty() || old_password.empty() || new_password.empty()) {
-            LOG(ERROR) << "Password change failed: username or password is empty";
-            return false;
+        if (username.empty()) {
+            LOG(ERROR) << "Registration failed: username is empty";
+            return RegisterResult::Failed;
         }
 
         try {
-            /// @brief First check if the old credentials are correct
-            if (!AuthenticateUser(username, old_password)) {
-                LOG(WARNING) << "Password change failed: invalid old credentials for user " << username;
-                return false;
-            }
-
-            constexpr std::string_view update_sql = R"(
-                UPDATE users SET password = ? WHERE username = ?;
+            constexpr std::string_view insert_sql = R"(
+                INSERT INTO users (salt, hash, kdf_id, iterations, username) VALUES (?, ?, ?, ?, ?);
             )";
 
-            if (const auto affected_rows = sqlite_manager_.exec(update_sql.data(), {new_password, username}); affected_rows > 0) {
-                LOG(INFO) << "Password changed successfully for user: " << username;
-                return true;
+            if (const auto result = execWrite(shardFor(username), insert_sql, credentialParams(credentials, username)); result > 0) {
+                LOG(INFO) << "User registered successfully: " << username;
+                return RegisterResult::Registered;
+            } else {
+                LOG(WARNING) << "User registration affected no rows for user: " << username;
+                return RegisterResult::Failed;
             }
-
-            LOG(WARNING) << "Password change affected no rows for user: " << username;
-            return false;
+        } catch (const common::sql::sqlite::SQLiteManager::Error &e) {
+            if (e.code() == SQLITE_CONSTRAINT_UNIQUE) {
+                LOG(INFO) << "Registration rejected, user already exists: " << username;
+                return RegisterResult::AlreadyExists;
+            }
+            LOG(ERROR) << "Failed to register user " << username << ": " << e.what();
+            return RegisterResult::Failed;
         } catch (const std::exception &e) {
-            LOG(ERROR) << "Failed to change password for user " << username << ": " << e.what();
-            return false;
+            LOG(ERROR) << "Failed to register user " << username << ": " << e.what();
+            return RegisterResult::Failed;
         }
     }
 
-    auto PasswordSQL::ResetPassword(const std::string &username, const std::string &new_password) const noexcept -> bool {
+    auto PasswordSQL::ResetPassword(const std::string_view username, const common::auth::CredentialRecord &credentials) const noexcept -> bool {
+        const common::time::ScopedPhaseTimer phase_timer(common::time::RequestPhase::Database);
         /// @brief Validate input parameters
-        if (username.empty() || new_password.empty()) {
-            LOG(ERROR) << "Password reset failed: username or new password is empty";
+        if (username.empty()) {
+            LOG(ERROR) << "Password reset failed: username is empty";
             return false;
         }
 
         try {
             constexpr std::string_view update_sql = R"(
-                UPDATE users SET password = ? WHERE username = ?;
+                UPDATE users SET salt = ?, hash = ?, kdf_id = ?, iterations = ? WHERE username = ?;
             )";
 
-            if (const auto affected_rows = sqlite_manager_.exec(update_sql.data(), {new_password, username}); affected_rows > 0) {
+            if (const auto affected_rows = execWrite(shardFor(username), update_sql, credentialParams(credentials, username)); affected_rows > 0) {
                 LOG(INFO) << "Password reset successfully for user: " << username;
                 return true;
             }
@@ -131,7 +207,8 @@ namespace server_app::sql {
         }
     }
 
-    auto PasswordSQL::DeleteUser(const std::string &username) const noexcept -> bool {
+    auto PasswordSQL::DeleteUser(const std::string_view username) const noexcept -> bool {
+        const common::time::ScopedPhaseTimer phase_timer(common::time::RequestPhase::Database);
         /// @brief Validate input parameters
         if (username.empty()) {
             LOG(ERROR) << "User deletion failed: username is empty";
@@ -143,7 +220,7 @@ namespace server_app::sql {
                 DELETE FROM users WHERE username = ?;
             )";
 
-            if (const auto affected_rows = sqlite_manager_.exec(delete_sql.data(), {username}); affected_rows > 0) {
+            if (const auto affected_rows = execWrite(shardFor(username), delete_sql, {std::string(username)}); affected_rows > 0) {
                 LOG(INFO) << "User deleted successfully: " << username;
                 return true;
             }
@@ -156,7 +233,8 @@ namespace server_app::sql {
         }
     }
 
-    auto PasswordSQL::UserExists(const std::string &username) const noexcept -> bool {
+    auto PasswordSQL::UserExists(const std::string_view username) const noexcept -> bool {
+        const common::time::ScopedPhaseTimer phase_timer(common::time::RequestPhase::Database);
         /// @brief Validate input parameters
         if (username.empty()) {
             LOG(ERROR) << "User exists check failed: username is empty";
@@ -168,8 +246,10 @@ namespace server_app::sql {
                 SELECT 1 FROM users WHERE username = ?;
             )";
 
-            const auto result = sqlite_manager_.query(select_sql.data(), {username});
-            const bool exists = !result.empty();
+            // Bound as a view, the lookup does not copy the username
+            auto stmt = shardFor(username).sqlite_manager.prepareRead(select_sql);
+            stmt.bind(1, username);
+            const bool exists = stmt.step();
 
             if (exists) {
                 LOG(INFO) << "User exists: " << username;
@@ -184,11 +264,111 @@ namespace server_app::sql {
         }
     }
 
-    auto PasswordSQL::GetUser(const std::string &username) const noexcept -> std::string {
+    auto PasswordSQL::BatchRegisterUsers(const std::vector<std::pair<std::string_view, common::auth::CredentialRecord> > &users) const noexcept -> std::vector<RegisterResult> {
+        const common::time::ScopedPhaseTimer phase_timer(common::time::RequestPhase::Database);
+        std::vector<RegisterResult> registered(users.size(), RegisterResult::Failed);
+        // Each shard commits its own part of the batch in one transaction
+        std::vector<std::vector<common::sql::sqlite::SQLiteManager::BatchStatement> > statements(shards_.size());
+        std::vector<std::vector<size_t> > positions(shards_.size());
+
+        for (size_t i = 0; i < users.size(); ++i) {
+            const auto &[username, credentials] = users[i];
+            /// @brief Validate input parameters
+            if (username.empty()) {
+                LOG(ERROR) << "Batch registration skipped an entry: username is empty";
+                continue;
+            }
+            const auto shard = ShardIndex(username, shards_.size());
+            statements[shard].push_back({"INSERT INTO users (salt, hash, kdf_id, iterations, username) VALUES (?, ?, ?, ?, ?);", credentialParams(credentials, username)});
+            positions[shard].push_back(i);
+        }
+
+        size_t succeeded = 0;
+        for (size_t shard = 0; shard < shards_.size(); ++shard) {
+            if (statements[shard].empty()) {
+                continue;
+            }
+            try {
+                const auto results = shards_[shard]->sqlite_manager.execBatch(statements[shard]);
+                for (size_t i = 0; i < results.size(); ++i) {
+                    if (results[i].ok() && results[i].affected_rows > 0) {
+                        registered[positions[shard][i]] = RegisterResult::Registered;
+                        ++succeeded;
+                    } else if (results[i].error_code == SQLITE_CONSTRAINT_UNIQUE) {
+                        registered[positions[shard][i]] = RegisterResult::AlreadyExists;
+                    } else {
+                        LOG(WARNING) << "Batch registration failed for user " << users[positions[shard][i]].first << ": " << results[i].error;
+                    }
+                }
+            } catch (const std::exception &e) {
+                LOG(ERROR) << "Failed to register " << statements[shard].size() << " users of shard " << shard << ": " << e.what();
+            }
+        }
+        LOG(INFO) << "Batch registered " << succeeded << " of " << users.size() << " users";
+        return registered;
+    }
+
+    auto PasswordSQL::BatchUserExists(const std::vector<std::string_view> &usernames) const noexcept -> std::vector<bool> {
+        const common::time::ScopedPhaseTimer phase_timer(common::time::RequestPhase::Database);
+        std::vector<bool> exists(usernames.size(), false);
+        if (usernames.empty()) {
+            return exists;
+        }
+
+        try {
+            std::vector<std::unordered_map<std::string_view, std::vector<size_t> > > shard_positions(shards_.size());
+            for (size_t i = 0; i < usernames.size(); ++i) {
+                shard_positions[ShardIndex(usernames[i], shards_.size())][usernames[i]].push_back(i);
+            }
+
+            std::vector<std::string> params;
+            params.reserve(MAX_IN_PARAMETERS);
+            for (size_t shard = 0; shard < shards_.size(); ++shard) {
+                const auto &positions = shard_positions[shard];
+                auto it = positions.begin();
+                while (it != positions.end()) {
+                    params.clear();
+                    for (; it != positions.end() && params.size() < MAX_IN_PARAMETERS; ++it) {
+                        params.emplace_back(it->first);
+                    }
+
+                    // Round the placeholder count up to a power of two and pad with a repeated name,
+                    // so only a handful of distinct statements ever enter the statement cache
+                    const size_t placeholders = std::bit_ceil(params.size());
+                    params.resize(placeholders, params.back());
+                    std::string select_sql = "SELECT username FROM users WHERE username IN (?";
+                    for (size_t i = 1; i < placeholders; ++i) {
+                        select_sql += ", ?";
+                    }
+                    select_sql += ");";
+
+                    for (const auto &row: shards_[shard]->sqlite_manager.query(select_sql, params)) {
+                        if (row.empty()) {
+                            continue;
+                        }
+                        if (const auto found = positions.find(row[0]); found != positions.end()) {
+                            for (const auto position: found->second) {
+                                exists[position] = true;
+                            }
+                        }
+                    }
+                }
+            }
+
+            LOG(INFO) << "Batch checked existence of " << usernames.size() << " users";
+            return exists;
+        } catch (const std::exception &e) {
+            LOG(ERROR) << "Failed to check existence of " << usernames.size() << " users: " << e.what();
+            return std::vector<bool>(usernames.size(), false);
+        }
+    }
+
+    auto PasswordSQL::GetUser(const std::string_view username) const noexcept -> std::optional<std::string> {
+        const common::time::ScopedPhaseTimer phase_timer(common::time::RequestPhase::Database);
         /// @brief Validate input parameters
         if (username.empty()) {
             LOG(ERROR) << "Get user failed: username is empty";
-            return {};
+            return std::nullopt;
         }
 
         try {
@@ -196,35 +376,55 @@ namespace server_app::sql {
                 SELECT username FROM users WHERE username = ?;
             )";
 
-            if (const auto result = sqlite_manager_.query(select_sql.data(), {username}); !result.empty() && !result[0].empty()) {
-                LOG(INFO) << "User retrieved successfully: " << username;
-                return result[0][0];
+            auto stmt = shardFor(username).sqlite_manager.prepareRead(select_sql);
+            stmt.bind(1, username);
+            if (!stmt.step()) {
+                LOG(WARNING) << "User not found: " << username;
+                return std::nullopt;
             }
 
-            LOG(WARNING) << "User not found: " << username;
-            return {};
+            LOG(INFO) << "User retrieved successfully: " << username;
+            return stmt.columnText(0);
         } catch (const std::exception &e) {
             LOG(ERROR) << "Failed to get user " << username << ": " << e.what();
-            return {};
+            return std::nullopt;
         }
     }
 
-    auto PasswordSQL::GetAllUsers() const noexcept -> std::vector<std::string> {
+    auto PasswordSQL::GetCredentials(const std::string_view username) const noexcept -> std::optional<common::auth::CredentialRecord> {
+        const common::time::ScopedPhaseTimer phase_timer(common::time::RequestPhase::Database);
+        /// @brief Validate input parameters
+        if (username.empty()) {
+            LOG(ERROR) << "Get credentials failed: username is empty";
+            return std::nullopt;
+        }
+
         try {
             constexpr std::string_view select_sql = R"(
-                SELECT username FROM users ORDER BY username;
+                SELECT salt, hash, kdf_id, iterations FROM users WHERE username = ?;
             )";
 
-            const auto result = sqlite_manager_.query(select_sql.data());
-            std::vector<std::string> users;
-            users.reserve(result.size()); // Reserve space for efficiency
+            auto stmt = shardFor(username).sqlite_manager.prepareRead(select_sql);
+            stmt.bind(1, username);
+            if (!stmt.step()) {
+                LOG(WARNING) << "User not found: " << username;
+                return std::nullopt;
+            }
 
-            for (const auto &row: result) {
-                if (!row.empty()) {
-                    users.push_back(row[0]);
-                }
+            auto credentials = readCredentials(stmt, 0);
+            if (!credentials) {
+                LOG(ERROR) << "Malformed credentials stored for user " << username << ": salt " << stmt.columnBlob(0).size() << " bytes, hash " << stmt.columnBlob(1).size() << " bytes";
             }
+            return credentials;
+        } catch (const std::exception &e) {
+            LOG(ERROR) << "Failed to get credentials of user " << username << ": " << e.what();
+            return std::nullopt;
+        }
+    }
 
+    auto PasswordSQL::GetAllUsers() const noexcept -> std::vector<std::string> {
+        try {
+            auto users = LoadAllUsernames();
             LOG(INFO) << "Retrieved " << users.size() << " users from database";
             return users;
         } catch (const std::exception &e) {
@@ -232,4 +432,81 @@ namespace server_app::sql {
             return {};
         }
     }
+
+    auto PasswordSQL::LoadAllUsernames() const -> std::vector<std::string> {
+        constexpr std::string_view select_sql = R"(
+            SELECT username FROM users ORDER BY username;
+        )";
+
+        std::vector<std::string> users;
+        for (const auto &shard: shards_) {
+            const auto result = shard->sqlite_manager.query(select_sql);
+            users.reserve(users.size() + result.size()); // Reserve space for efficiency
+
+            for (const auto &row: result) {
+                if (!row.empty()) {
+                    users.push_back(row[0]);
+                }
+            }
+        }
+        return users;
+    }
+
+    auto PasswordSQL::ShardCount() const noexcept -> size_t {
+        return shards_.size();
+    }
+
+    auto PasswordSQL::ShardIndex(const std::string_view username, const size_t shard_count) noexcept -> size_t {
+        uint64_t hash = FNV_OFFSET_BASIS;
+        for (const auto c: username) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= FNV_PRIME;
+        }
+        return static_cast<size_t>(hash % shard_count);
+    }
+
+    auto PasswordSQL::ShardPath(const std::string &db_path, const size_t shard, const size_t shard_count) -> std::string {
+        if (shard_count <= 1) {
+            return db_path;
+        }
+        const std::filesystem::path path(db_path);
+        auto shard_path = path;
+        shard_path.replace_filename(fmt::format("{}.{}{}", path.stem().string(), shard, path.extension().string()));
+        return shard_path.string();
+    }
+
+    auto PasswordSQL::UserIdRange(const size_t shard) const -> std::optional<std::pair<int64_t, int64_t> > {
+        constexpr std::string_view select_sql = R"(
+            SELECT MIN(id), MAX(id), COUNT(*) FROM users;
+        )";
+
+        auto stmt = shards_.at(shard)->sqlite_manager.prepareRead(select_sql);
+        if (!stmt.step() || stmt.columnInt64(2) == 0) {
+            return std::nullopt;
+        }
+        return std::make_pair(stmt.columnInt64(0), stmt.columnInt64(1));
+    }
+
+    auto PasswordSQL::LoadCredentialsRange(const size_t shard, const int64_t first_id, const int64_t last_id, const CredentialVisitor &visit) const -> size_t {
+        constexpr std::string_view select_sql = R"(
+            SELECT username, salt, hash, kdf_id, iterations FROM users WHERE id BETWEEN ? AND ?;
+        )";
+
+        auto stmt = shards_.at(shard)->sqlite_manager.prepareRead(select_sql);
+        stmt.bind(1, first_id);
+        stmt.bind(2, last_id);
+
+        size_t visited = 0;
+        while (stmt.step()) {
+            auto username = stmt.columnText(0);
+            const auto credentials = readCredentials(stmt, 1);
+            if (!credentials) {
+                LOG(ERROR) << "Skipping malformed credentials stored for user " << username;
+                continue;
+            }
+            visit(std::move(username), *credentials);
+            ++visited;
+        }
+        return visited;
+    }
 }
@@ -1,20 +1,39 @@
 #pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+#include "auth/CredentialRecord.hpp"
+#include "sql/sqlite/SQLiteBatchWriter.hpp"
 #include "sql/sqlite/SQLiteManager.hpp"
 
 namespace server_app::sql {
     /// @brief Manages user authentication and password operations using SQLite database
+    /// @details Credentials are stored as typed columns: salt and hash as BLOBs, key derivation
+    /// function and iteration count as INTEGERs. Tables created by earlier versions, which kept
+    /// "salt:hash" in a single TEXT column, are migrated when the database is opened.
+    ///
+    /// The users can be sharded across several database files by the FNV-1a hash of their username.
+    /// Each shard has its own writer connection, reader pool and group-commit writer, so writes for
+    /// different shards proceed in parallel. Every file records which shard of how many it holds, and
+    /// opening it with another layout fails instead of silently hiding users; script/reshard_users.py
+    /// moves an existing store to a new shard count offline.
     class PasswordSQL {
     public:
         /// @brief Default constructor deleted to prevent uninitialized instances
         PasswordSQL() = delete;
 
         /// @brief Constructs PasswordSQL and initializes database connection
-        /// @param db_path Path to the SQLite database file
-        /// @throws std::runtime_error if database initialization fails
-        explicit PasswordSQL(const std::string &db_path) noexcept(false);
+        /// @param db_path Path to the SQLite database file, with several shards the base name of the shard files
+        /// @param sqlite_options Connection pragmas, reader pool and shard configuration
+        /// @throws std::runtime_error if database initialization or schema migration fails, or a file
+        /// holds another shard layout than the configured one
+        explicit PasswordSQL(const std::string &db_path, const common::sql::sqlite::SQLiteOptions &sqlite_options = common::sql::sqlite::SQLiteOptions()) noexcept(false);
 
         /// @brief Copy constructor deleted to prevent copying
         PasswordSQL(const PasswordSQL &) = delete;
@@ -31,52 +50,192 @@ namespace server_app::sql {
         /// @brief Default destructor
         ~PasswordSQL() = default;
 
-        /// @brief Registers a new user with username and password
+        /// @brief Outcome of storing a new user
+        enum class RegisterResult {
+            Registered, ///< The user was stored
+            AlreadyExists, ///< The username is taken, reported by the UNIQUE constraint of the users table
+            Failed ///< The user could not be stored
+        };
+
+        /// @brief Registers a new user with its credentials
         /// @param username Username to register
-        /// @param password Password for the user
-        /// @return true if registration successful, false otherwise
-        [[nodiscard]] auto RegisterUser(const std::string &username, const std::string &password) const noexcept -> bool;
-
-        /// @brief Authenticates a user with provided credentials
-        /// @param username Username to authenticate
-        /// @param password Password for the user
-        /// @return true if authentication successful, false otherwise
-        [[nodiscard]] auto AuthenticateUser(const std::string &username, const std::string &password) const noexcept -> bool;
-
-        /// @brief Changes password for a user after validating old password
-        /// @param username Username whose password needs to be changed
-        /// @param old_password Current password for validation
-        /// @param new_password New password to set
-        /// @return true if password changed successfully, false otherwise
-        [[nodiscard]] auto ChangePassword(const std::string &username, const std::string &old_password, const std::string &new_password) const noexcept -> bool;
-
-        /// @brief Resets password for a user without validating old password
-        /// @param username Username whose password needs to be reset
-        /// @param new_password New password to set
-        /// @return true if password reset successfully, false otherwise
-        [[nodiscard]] auto ResetPassword(const std::string &username, const std::string &new_password) const noexcept -> bool;
+        /// @param credentials Salt, hash and key derivation parameters
+        /// @return Registered, AlreadyExists if the username is taken, Failed otherwise
+        /// @details The database is authoritative for duplicates, so concurrent registrations of one name cannot both succeed.
+        [[nodiscard]] auto RegisterUser(std::string_view username, const common::auth::CredentialRecord &credentials) const noexcept -> RegisterResult;
+
+        /// @brief Replaces the credentials of an existing user
+        /// @param username Username whose credentials need to be replaced
+        /// @param credentials New salt, hash and key derivation parameters
+        /// @return true if credentials replaced successfully, false otherwise
+        [[nodiscard]] auto ResetPassword(std::string_view username, const common::auth::CredentialRecord &credentials) const noexcept -> bool;
 
         /// @brief Deletes a user from the database
         /// @param username Username to delete
         /// @return true if user deleted successfully, false otherwise
-        [[nodiscard]] auto DeleteUser(const std::string &username) const noexcept -> bool;
+        [[nodiscard]] auto DeleteUser(std::string_view username) const noexcept -> bool;
 
         /// @brief Checks if a user exists in the database
         /// @param username Username to check
         /// @return true if user exists, false otherwise
-        [[nodiscard]] auto UserExists(const std::string &username) const noexcept -> bool;
+        [[nodiscard]] auto UserExists(std::string_view username) const noexcept -> bool;
+
+        /// @brief Registers several users in a single transaction
+        /// @param users Username and credentials pairs to register
+        /// @return Registration result for each user, in input order
+        /// @details Each insert runs in its own savepoint, so a failing user does not roll back the others.
+        [[nodiscard]] auto BatchRegisterUsers(const std::vector<std::pair<std::string_view, common::auth::CredentialRecord> > &users) const noexcept -> std::vector<RegisterResult>;
+
+        /// @brief Checks which of several users exist in the database
+        /// @param usernames Usernames to check
+        /// @return Existence of each user, in input order
+        /// @details Usernames are looked up with IN queries of at most MAX_IN_PARAMETERS placeholders.
+        [[nodiscard]] auto BatchUserExists(const std::vector<std::string_view> &usernames) const noexcept -> std::vector<bool>;
 
         /// @brief Retrieves a user's username from the database
         /// @param username Username to retrieve
-        /// @return Username if found, empty string otherwise
-        [[nodiscard]] auto GetUser(const std::string &username) const noexcept -> std::string;
+        /// @return Username if found, nullopt if the user does not exist or the query fails
+        /// @details A single query answers both whether the user exists and who it is.
+        [[nodiscard]] auto GetUser(std::string_view username) const noexcept -> std::optional<std::string>;
+
+        /// @brief Retrieves a user's credentials from the database
+        /// @param username Username to retrieve
+        /// @return Credentials if found and well-formed, nullopt otherwise
+        /// @details Columns are copied straight into the record, no intermediate strings are built.
+        [[nodiscard]] auto GetCredentials(std::string_view username) const noexcept -> std::optional<common::auth::CredentialRecord>;
 
         /// @brief Retrieves all usernames from the database
         /// @return Vector containing all usernames
         [[nodiscard]] auto GetAllUsers() const noexcept -> std::vector<std::string>;
 
+        /// @brief Retrieves all usernames from the database, reporting failures
+        /// @return Vector containing all usernames
+        /// @throws std::runtime_error if the query fails
+        /// @details Unlike GetAllUsers, an empty result always means the table is empty.
+        [[nodiscard]] auto LoadAllUsernames() const -> std::vector<std::string>;
+
+        /// @brief Visitor receiving one stored user and its credentials
+        using CredentialVisitor = std::function<void(std::string username, const common::auth::CredentialRecord &credentials)>;
+
+        /// @brief Get the number of database files the users are sharded across
+        /// @return Shard count, at least 1
+        [[nodiscard]] auto ShardCount() const noexcept -> size_t;
+
+        /// @brief Select the shard a username is stored in
+        /// @param username Username
+        /// @param shard_count Number of shards
+        /// @return Index of the shard, the 64-bit FNV-1a hash of the username modulo the shard count
+        /// @details script/reshard_users.py computes the same function; both must change together.
+        [[nodiscard]] static auto ShardIndex(std::string_view username, size_t shard_count) noexcept -> size_t;
+
+        /// @brief Derive the path of a shard file
+        /// @param db_path Configured database path
+        /// @param shard Index of the shard
+        /// @param shard_count Number of shards
+        /// @return db_path itself for a single shard, otherwise the shard index inserted before the
+        /// extension ("users.db" becomes "users.0.db", "users.1.db", ...)
+        [[nodiscard]] static auto ShardPath(const std::string &db_path, size_t shard, size_t shard_count) -> std::string;
+
+        /// @brief Retrieves the smallest and largest row id of the users table of one shard
+        /// @param shard Index of the shard
+        /// @return First and last row id, nullopt if the table is empty
+        /// @throws std::runtime_error if the query fails
+        /// @details Row ids are not dense, but splitting this range gives chunks that LoadCredentialsRange
+        /// reads with an index range scan, so several chunks can be streamed in parallel.
+        [[nodiscard]] auto UserIdRange(size_t shard) const -> std::optional<std::pair<int64_t, int64_t> >;
+
+        /// @brief Streams the users of one shard whose row id lies in a range together with their credentials
+        /// @param shard Index of the shard
+        /// @param first_id First row id of the range
+        /// @param last_id Last row id of the range, inclusive
+        /// @param visit Called once per user, on the calling thread
+        /// @return Number of users visited; rows with malformed credentials are skipped
+        /// @throws std::runtime_error if the query fails
+        /// @details Rows are read one at a time on a pooled reader connection, which stays borrowed
+        /// until the range is exhausted.
+        auto LoadCredentialsRange(size_t shard, int64_t first_id, int64_t last_id, const CredentialVisitor &visit) const -> size_t;
+
     private:
-        /// @brief SQLite manager instance for database operations
-        common::sql::sqlite::SQLiteManager sqlite_manager_;
+        /// @brief Maximum number of placeholders bound to one IN query
+        static constexpr size_t MAX_IN_PARAMETERS = 256;
+
+        /// @brief Schema of the users table with typed credential columns
+        static constexpr std::string_view CREATE_USERS_TABLE_SQL = R"(
+            CREATE TABLE IF NOT EXISTS users (
+                id INTEGER PRIMARY KEY AUTOINCREMENT,
+                username TEXT UNIQUE NOT NULL,
+                salt BLOB NOT NULL,
+                hash BLOB NOT NULL,
+                kdf_id INTEGER NOT NULL,
+                iterations INTEGER NOT NULL,
+                created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
+            );
+        )";
+
+        /// @brief Records which shard of how many a database file holds
+        static constexpr std::string_view CREATE_SHARD_LAYOUT_TABLE_SQL = R"(
+            CREATE TABLE IF NOT EXISTS shard_layout (
+                id INTEGER PRIMARY KEY CHECK (id = 0),
+                shard_index INTEGER NOT NULL,
+                shard_count INTEGER NOT NULL
+            );
+        )";
+
+        /// @brief One database file with its connections and writer
+        struct Shard {
+            /// @brief Open a shard file, creating and migrating its schema
+            /// @param path Path of the shard file
+            /// @param sqlite_options Connection pragmas and reader pool configuration
+            /// @param index Index of the shard
+            /// @param count Number of shards
+            /// @throws std::runtime_error if the schema cannot be set up or the file holds another shard
+            Shard(const std::string &path, const common::sql::sqlite::SQLiteOptions &sqlite_options, size_t index, size_t count);
+
+            common::sql::sqlite::SQLiteManager sqlite_manager;
+            std::unique_ptr<common::sql::sqlite::SQLiteBatchWriter> batch_writer; ///< Null when group commit is disabled, declared after the manager so it is stopped before the connection closes
+        };
+
+        /// @brief Select the shard a username is stored in
+        /// @param username Username
+        /// @return Shard holding the user
+        [[nodiscard]] auto shardFor(std::string_view username) const noexcept -> const Shard &;
+
+        /// @brief Migrate a users table that stores "salt:hash" in a TEXT password column
+        /// @param sqlite_manager Connection of the shard to migrate
+        /// @throws std::runtime_error if the migration fails, in which case the table is left untouched
+        /// @details Rows whose credentials do not have the expected layout cannot be migrated; they are
+        /// kept in a users_legacy table instead of being dropped.
+        static auto migrateLegacySchema(const common::sql::sqlite::SQLiteManager &sqlite_manager) -> void;
+
+        /// @brief Record the shard layout in a new file and check it against an existing one
+        /// @param sqlite_manager Connection of the shard
+        /// @param path Path of the shard file, for error messages
+        /// @param index Configured index of the shard
+        /// @param count Configured number of shards
+        /// @throws std::runtime_error if the file was created for another layout
+        static auto checkShardLayout(const common::sql::sqlite::SQLiteManager &sqlite_manager, const std::string &path, size_t index, size_t count) -> void;
+
+        /// @brief Build the parameters shared by credential inserts and updates
+        /// @param credentials Credentials to bind
+        /// @param username Username, bound last
+        /// @return Salt, hash, key derivation function, iterations and username, in that order
+        [[nodiscard]] static auto credentialParams(const common::auth::CredentialRecord &credentials, std::string_view username) -> std::vector<common::sql::sqlite::SQLiteManager::Value>;
+
+        /// @brief Copy credential columns out of the current row
+        /// @param stmt Statement positioned on a row
+        /// @param first_column Index of the salt column, followed by hash, key derivation function and iterations
+        /// @return Credentials, nullopt if the salt or hash has an unexpected size
+        [[nodiscard]] static auto readCredentials(const common::sql::sqlite::SQLiteManager::PreparedStatement &stmt, int first_column) noexcept -> std::optional<common::auth::CredentialRecord>;
+
+        /// @brief Execute a mutation, through the group-commit writer when it is enabled
+        /// @param shard Shard to write to
+        /// @param sql SQL statement to execute
+        /// @param params Parameter values for the statement
+        /// @return Number of affected rows once the statement committed
+        /// @throws std::runtime_error if execution or commit fails
+        [[nodiscard]] static auto execWrite(const Shard &shard, std::string_view sql, std::vector<common::sql::sqlite::SQLiteManager::Value> params) -> int;
+
+        /// @brief Shards indexed by ShardIndex
+        std::vector<std::unique_ptr<Shard> > shards_;
     };
 }
@@ -1,5 +1,8 @@
 #include "src/task/ServerTask.hpp"
 
+#include <chrono>
+#include <memory>
+#include <string>
 #include <fmt/format.h>
 #include <glog/logging.h>
 
@@ -7,6 +10,38 @@
 #include "src/auth/AuthRpcService.hpp"
 
 namespace app_server::task {
+    /// @brief Translate the admission settings of the gRPC options into controller limits
+    /// @param options Loaded gRPC options
+    /// @return Per-method caps and queueing thresholds
+    static auto makeAdmissionLimits(const auth::AuthRpcServiceOptions &options) -> server_app::auth::AdmissionController::Limits {
+        server_app::auth::AdmissionController::Limits limits;
+        for (size_t i = 0; i < server_app::auth::RPC_METHOD_COUNT; ++i) {
+            const auto method_name = server_app::auth::rpcMethodName(static_cast<server_app::auth::RpcMethod>(i));
+            limits.max_concurrency[i] = static_cast<uint32_t>(options.admissionLimitFor(std::string(method_name)));
+        }
+        limits.queue_timeout = std::chrono::milliseconds(options.admissionQueueTimeoutMs());
+        limits.target_queue_delay = std::chrono::milliseconds(options.admissionTargetQueueDelayMs());
+        return limits;
+    }
+
+    /// @brief Timer task that periodically writes the server statistics to the log
+    class ServerStatsDumpTask final : public common::interfaces::ITimerTask {
+    public:
+        explicit ServerStatsDumpTask(server_app::auth::AuthRpcService &service) noexcept : service_(service) {
+        }
+
+        auto execute() -> void override {
+            try {
+                service_.LogServerStats();
+            } catch (const std::exception &e) {
+                LOG(ERROR) << "Failed to dump server statistics: " << e.what();
+            }
+        }
+
+    private:
+        server_app::auth::AuthRpcService &service_;
+    };
+
     ServerTask::ServerTask(std::string name) noexcept : timer_(std::move(name)) {
     }
 
@@ -18,8 +53,23 @@ namespace app_server::task {
         LOG(INFO) << fmt::format("Initializing ServerTask with config path: {}, loading gRPC configuration from: {}", application_dev_config_path_, application_dev_config_path_);
 
         grpc_options_.deserializedFromYamlFile(application_dev_config_path_);
+        sqlite_options_.deserializedFromYamlFile(application_dev_config_path_);
+        authenticator_options_.deserializedFromYamlFile(application_dev_config_path_);
 
         LOG(INFO) << fmt::format("gRPC configuration loaded successfully - Max Connection Idle: {}ms, Max Connection Age: {}ms, Keepalive Time: {}ms, Keepalive Timeout: {}ms, Permit Without Calls: {}, Server Address: {}", grpc_options_.maxConnectionIdleMs(), grpc_options_.maxConnectionAgeMs(), grpc_options_.keepaliveTimeMs(), grpc_options_.keepaliveTimeoutMs(), grpc_options_.keepalivePermitWithoutCalls(), grpc_options_.serverAddress());
+        LOG(INFO) << fmt::format("gRPC threading configuration - Server Mode: {}, Completion Queues: {}, Pollers Per Queue: {}, KDF Workers: {}, KDF Queue Size: {}", grpc_options_.serverMode(), grpc_options_.completionQueueCount(), grpc_options_.pollerThreadsPerQueue(), grpc_options_.kdfWorkerThreads(), grpc_options_.kdfQueueSize());
+        LOG(INFO) << fmt::format("gRPC admission configuration - Max Concurrency: {}, Method Limits: {}, Queue Timeout: {}ms, Target Queue Delay: {}ms", grpc_options_.admissionMaxConcurrency(), grpc_options_.admissionMethodLimits().size(), grpc_options_.admissionQueueTimeoutMs(), grpc_options_.admissionTargetQueueDelayMs());
+        LOG(INFO) << fmt::format("gRPC monitoring configuration - Stats Dump Interval: {}s", grpc_options_.statsDumpIntervalSec());
+        LOG(INFO) << fmt::format("SQLite configuration loaded successfully - Journal Mode: {}, Synchronous: {}, Mmap Size: {}, Cache Size: {}, Busy Timeout: {}ms, Reader Pool Size: {}, Shard Count: {}", sqlite_options_.journalMode(), sqlite_options_.synchronous(), sqlite_options_.mmapSize(), sqlite_options_.cacheSize(), sqlite_options_.busyTimeoutMs(), sqlite_options_.readerPoolSize(), sqlite_options_.shardCount());
+        LOG(INFO) << fmt::format("Authenticator configuration loaded successfully - Negative Cache: {}, Expected Users: {}, False Positive Rate: {}, Rebuild Interval: {}s, KDF Iterations: {}, Rehash On Login: {}, Session Token TTL: {}s, Lockout Table Size: {}, Lockout Duration: {}s, Warm-Up Threads: {}", authenticator_options_.negativeCacheEnabled(), authenticator_options_.negativeCacheExpectedUsers(), authenticator_options_.negativeCacheFalsePositiveRate(), authenticator_options_.negativeCacheRebuildIntervalSec(), authenticator_options_.kdfIterations(), authenticator_options_.kdfRehashOnLogin(), authenticator_options_.sessionTokenTtlSec(), authenticator_options_.lockoutTableSize(), authenticator_options_.lockoutDurationSec(), authenticator_options_.warmUpThreads());
+
+        // Opening the database and warming the caches happens before the server accepts any call,
+        // so the first requests after a deploy are served from memory
+        LOG(INFO) << "Creating authentication service";
+        const auto started = std::chrono::steady_clock::now();
+        auth_service_ = std::make_unique<server_app::auth::AuthRpcService>("./users.db", sqlite_options_, authenticator_options_, static_cast<size_t>(grpc_options_.kdfWorkerThreads()), static_cast<size_t>(grpc_options_.kdfQueueSize()), makeAdmissionLimits(grpc_options_));
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - started);
+        LOG(INFO) << fmt::format("Authentication service ready in {}ms", elapsed.count());
     }
 
     auto ServerTask::run() -> void {
@@ -63,9 +113,21 @@ namespace app_server::task {
         LOG(INFO) << fmt::format("Channel arguments set - Max Connection Idle: {}ms, Max Connection Age: {}ms, Max Connection Age Grace: {}ms, Keepalive Time: {}ms, Keepalive Timeout: {}ms, Keepalive Permit Without Calls: {}", grpc_options_.maxConnectionIdleMs(), grpc_options_.maxConnectionAgeMs(), grpc_options_.maxConnectionAgeGraceMs(), grpc_options_.keepaliveTimeMs(), grpc_options_.keepaliveTimeoutMs(), grpc_options_.keepalivePermitWithoutCalls());
 
         LOG(INFO) << "Registering RPC service implementation";
-        server_app::auth::AuthRpcService service("./users.db");
-        builder.RegisterService(&service);
-        LOG(INFO) << "Service registered successfully";
+        if (grpc_options_.isAsyncMode()) {
+            async_auth_service_ = std::make_unique<server_app::auth::AsyncAuthRpcService>(*auth_service_);
+            async_auth_service_->registerWith(builder, grpc_options_.completionQueueCount());
+        } else {
+            // The sync options also size the threads of the callback mode's AuthenticateStream
+            builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::NUM_CQS, grpc_options_.completionQueueCount());
+            builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::MIN_POLLERS, grpc_options_.pollerThreadsPerQueue());
+            if (grpc_options_.isCallbackMode()) {
+                callback_auth_service_ = std::make_unique<server_app::auth::CallbackAuthRpcService>(*auth_service_);
+                callback_auth_service_->registerWith(builder);
+            } else {
+                builder.RegisterService(auth_service_.get());
+            }
+        }
+        LOG(INFO) << fmt::format("Service registered successfully in {} mode", grpc_options_.serverMode());
 
         LOG(INFO) << "Building and starting gRPC server";
         server_ = builder.BuildAndStart();
@@ -75,6 +137,15 @@ namespace app_server::task {
             return false;
         }
 
+        if (async_auth_service_) {
+            async_auth_service_->start(grpc_options_.pollerThreadsPerQueue());
+        }
+
+        if (grpc_options_.statsDumpIntervalSec() > 0) {
+            stats_dumper_ = std::make_unique<common::thread::PeriodicActuator>(std::make_shared<ServerStatsDumpTask>(*auth_service_), std::chrono::seconds(grpc_options_.statsDumpIntervalSec()));
+            stats_dumper_->start();
+        }
+
         LOG(INFO) << fmt::format("Server listening on {}, gRPC server started and waiting for connections...", server_address);
         server_->Wait();
 
@@ -84,9 +155,18 @@ namespace app_server::task {
 
     auto ServerTask::exit() const -> void {
         LOG(INFO) << "Shutting down service task...";
+        if (stats_dumper_) {
+            stats_dumper_->stop();
+        }
         if (server_) {
             LOG(INFO) << "Initiating gRPC server shutdown";
             server_->Shutdown();
+            if (auth_service_) {
+                auth_service_->DrainKdfExecutor();
+            }
+            if (async_auth_service_) {
+                async_auth_service_->shutdown();
+            }
             LOG(INFO) << "gRPC server shutdown complete.";
         } else {
             LOG(WARNING) << "Server object is null during shutdown. Nothing to shutdown.";
@@ -4,6 +4,12 @@
 #include <grpcpp/server_builder.h>
 
 #include "src/auth/AuthRpcServiceOptions.hpp"
+#include "src/auth/AsyncAuthRpcService.hpp"
+#include "src/auth/AuthRpcService.hpp"
+#include "src/auth/CallbackAuthRpcService.hpp"
+#include "auth/UserAuthenticatorOptions.hpp"
+#include "sql/sqlite/SQLiteOptions.hpp"
+#include "src/thread/PeriodicActuator.hpp"
 #include "src/time/FunctionProfiler.hpp"
 #include "task/interface/ITask.h"
 
@@ -30,7 +36,8 @@ namespace app_server::task {
         auto operator=(ServerTask &&) -> ServerTask & = delete;
 
         /// @brief Initialize the service task and its associated resources
-        /// @details Sets up logging, loads configuration, and validates gRPC parameters
+        /// @details Sets up logging, loads configuration, validates gRPC parameters and creates the
+        /// authentication service, preloading its caches when warm-up threads are configured
         auto init() -> void;
 
         /// @brief Run the main task
@@ -44,8 +51,14 @@ namespace app_server::task {
     private:
         const std::string application_dev_config_path_{"../../server/src/application-dev.yml"};
         auth::AuthRpcServiceOptions grpc_options_;
+        common::sql::sqlite::SQLiteOptions sqlite_options_;
+        common::auth::UserAuthenticatorOptions authenticator_options_;
         common::time::FunctionProfiler timer_;
+        std::unique_ptr<server_app::auth::AuthRpcService> auth_service_;
+        std::unique_ptr<server_app::auth::AsyncAuthRpcService> async_auth_service_;
+        std::unique_ptr<server_app::auth::CallbackAuthRpcService> callback_auth_service_;
         std::unique_ptr<grpc::Server> server_;
+        std::unique_ptr<common::thread::PeriodicActuator> stats_dumper_; ///< Null when the periodic stats dump is disabled
 
         /// @brief Establish a gRPC connection to the specified service
         /// @details Configures and starts the gRPC server with specified options